@@ -32,6 +32,6 @@ if sys.platform == "win32":
         os.environ["PATH"] = os.path.abspath(openvino_dlls) + ";" + os.environ["PATH"]
 
 from .ie_api import *
-__all__ = ['IENetwork', "TensorDesc", "IECore", "Blob", "PreProcessInfo", "get_version"]
+__all__ = ['IENetwork', "TensorDesc", "IECore", "Blob", "PreProcessInfo", "AsyncInferQueue", "get_version"]
 __version__ = get_version()
 
@@ -794,7 +794,9 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
-    #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
+    #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer.
+    #          The arrays share memory with output blobs of the first infer request, so the next inference
+    #          overwrites them. Use `numpy.ndarray.copy()` to keep the results.
     #
     #  Usage example:\n
     #  ```python
@@ -815,7 +817,7 @@ cdef class ExecutableNetwork:
         current_request.infer(inputs)
         res = {}
         for name, value in current_request.output_blobs.items():
-            res[name] = deepcopy(value.buffer)
+            res[name] = value.buffer
         return res
 
 
@@ -965,7 +967,12 @@ cdef class ExecutableNetwork:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        cdef int c_num_requests = num_requests
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -1040,14 +1047,15 @@ cdef class InferRequest:
                 input_blobs[input] = blob
         return input_blobs
 
-    ## Dictionary that maps output layer names to corresponding Blobs
+    ## Dictionary that maps output layer names to corresponding Blobs.
+    #  Blobs share memory with the infer request outputs, so the next inference overwrites their data
     @property
     def output_blobs(self):
         output_blobs = {}
         for output in self._outputs_list:
             blob = Blob()
             deref(self.impl).getBlobPtr(output.encode(), blob._ptr)
-            output_blobs[output] = deepcopy(blob)
+            output_blobs[output] = blob
         return output_blobs
 
     ## Dictionary that maps input layer names to corresponding preprocessing information
@@ -1086,6 +1094,30 @@ cdef class InferRequest:
         else:
             deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
         self._user_blobs[blob_name] = blob
+
+    ## Sets `numpy.ndarray` as input or output data of the infer request without copying.
+    #  The infer request reads input data from the array or writes output data to it directly
+    #  and keeps a reference to the array until another blob is set.
+    #  @param blob_name: A name of input or output blob
+    #  @param array: C-contiguous `numpy.ndarray` with the number of elements and the data type of the blob
+    #  @return None
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=2)
+    #  result = np.zeros(shape=(1, 10), dtype=np.float32)
+    #  exec_net.requests[0].set_array("data", image)
+    #  exec_net.requests[0].set_array("fc_out", result)
+    #  exec_net.requests[0].infer()
+    #  ```
+    def set_array(self, blob_name : str, array : np.ndarray):
+        if blob_name not in self._inputs_list and blob_name not in self._outputs_list:
+            raise ValueError(f"No input or output with name {blob_name} found in network")
+        if not array.flags['C_CONTIGUOUS']:
+            raise ValueError(f"Array for {blob_name} blob should be C-contiguous to be used without copying")
+        current_blob = Blob()
+        deref(self.impl).getBlobPtr(blob_name.encode(), current_blob._ptr)
+        self.set_blob(blob_name, Blob(current_blob.tensor_desc, array))
     ## Starts synchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
@@ -1106,7 +1138,8 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
@@ -1125,7 +1158,8 @@ cdef class InferRequest:
             self._fill_inputs(inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -1159,7 +1193,11 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1250,10 +1288,121 @@ cdef class InferRequest:
     def _fill_inputs(self, inputs):
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
-            if self.input_blobs[k].tensor_desc.precision == "FP16":
-                self.input_blobs[k].buffer[:] = v.view(dtype=np.int16)
+            blob = Blob()
+            deref(self.impl).getBlobPtr(k.encode(), blob._ptr)
+            if blob.tensor_desc.precision == "FP16":
+                blob.buffer[:] = v.view(dtype=np.int16)
             else:
-                self.input_blobs[k].buffer[:] = v
+                blob.buffer[:] = v
+
+
+## This class owns a pool of infer requests of `ExecutableNetwork` and runs asynchronous jobs on idle requests.
+#  Completion of a job is tracked without GIL. The job callback is called by the thread which starts the next job
+#  or waits for all jobs, before the request of the job is reused.
+#
+#  Usage example:\n
+#  ```python
+#  ie_core = IECore()
+#  net = ie_core.read_network(model=path_to_xml_file, weights=path_to_bin_file)
+#  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=0)
+#  results = {}
+#  infer_queue = AsyncInferQueue(exec_net)
+#  infer_queue.set_callback(lambda request, image_id: results.update({image_id: request.output_blobs['prob'].buffer.copy()}))
+#  for image_id, image in enumerate(images):
+#      infer_queue.start_async({'data': image}, image_id)
+#  infer_queue.wait_all()
+#  ```
+cdef class AsyncInferQueue:
+    ## Class constructor
+    #  @param exec_net: `ExecutableNetwork` to create infer requests of the queue
+    #  @param jobs: Number of infer requests of the queue. If 0, the optimal number of requests
+    #               reported by the device is used
+    #  @return Instance of AsyncInferQueue class
+    def __init__(self, ExecutableNetwork exec_net, int jobs = 0):
+        self.impl.reset(new C.AsyncInferQueue(deref(exec_net.impl), jobs))
+        self._exec_net = exec_net
+        self._callback = None
+        self._requests = []
+        for i in range(deref(self.impl).requests.size()):
+            infer_request = InferRequest()
+            infer_request.impl = &(deref(self.impl).requests[i])
+            infer_request._inputs_list = list(exec_net.input_info.keys())
+            infer_request._outputs_list = list(exec_net.outputs.keys())
+            self._requests.append(infer_request)
+        self._userdata = [None] * len(self._requests)
+
+    def __dealloc__(self):
+        # waits for running jobs, callbacks of the finished jobs are not called
+        with nogil:
+            self.impl.reset()
+
+    def __len__(self):
+        return len(self._requests)
+
+    def __iter__(self):
+        return iter(self._requests)
+
+    ## Returns `InferRequest` of the queue by index. The requests are owned by the queue and
+    #  should not be started directly
+    def __getitem__(self, i):
+        return self._requests[i]
+
+    ## Sets a function called on completion of every job
+    #  @param callback: A function with `InferRequest` of the job and user data of the job as arguments
+    #  @return None
+    def set_callback(self, callback):
+        self._callback = callback
+
+    ## Starts asynchronous inference on an idle request. If all requests are busy, waits for an idle one
+    #  without GIL and calls callbacks of the finished jobs
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
+    #                 input data for the layer
+    #  @param userdata: Data passed to the callback of the job
+    #  @return None
+    def start_async(self, inputs = None, userdata = None):
+        cdef int request_id
+        cdef size_t index
+        self._run_callbacks()
+        while True:
+            with nogil:
+                request_id = deref(self.impl).getIdleRequestId()
+            if request_id >= 0:
+                break
+            self._run_callbacks()
+        index = request_id
+        try:
+            if inputs is not None:
+                self._requests[request_id]._fill_inputs(inputs)
+        except:
+            deref(self.impl).setRequestIdle(index)
+            raise
+        self._userdata[request_id] = userdata
+        with nogil:
+            deref(self.impl).startAsync(index)
+
+    ## Waits for all jobs of the queue without GIL and calls callbacks of the finished jobs
+    #  @return None
+    def wait_all(self):
+        with nogil:
+            deref(self.impl).waitAll()
+        self._run_callbacks()
+
+    def _run_callbacks(self):
+        cdef int status = 0
+        cdef int request_id
+        while True:
+            request_id = deref(self.impl).popCompletedRequestId(status)
+            if request_id < 0:
+                return
+            userdata = self._userdata[request_id]
+            self._userdata[request_id] = None
+            try:
+                if status != StatusCode.OK:
+                    raise RuntimeError(f"Async infer request {request_id} failed with status code {status}")
+                if self._callback is not None:
+                    self._callback(self._requests[request_id], userdata)
+            finally:
+                deref(self.impl).setRequestIdle(<size_t> request_id)
 
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
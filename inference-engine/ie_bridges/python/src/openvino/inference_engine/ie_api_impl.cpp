@@ -528,6 +528,107 @@ void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests)
     }
 }
 
+void async_infer_queue_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
+    InferenceEnginePython::InferRequestWrap *requestWrap;
+    InferenceEngine::ResponseDesc dsc;
+    request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
+    auto end_time = Time::now();
+    auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
+    requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
+    auto queue = static_cast<InferenceEnginePython::AsyncInferQueue *>(requestWrap->user_data);
+    queue->setRequestCompleted(requestWrap->index, static_cast<int>(code));
+}
+
+InferenceEnginePython::AsyncInferQueue::AsyncInferQueue(IEExecNetwork &exec_network, int jobs) {
+    if (0 == jobs) {
+        jobs = getOptimalNumberOfRequests(exec_network.actual);
+    }
+    if (jobs < 0) {
+        THROW_IE_EXCEPTION << "Number of jobs should be positive, got " << jobs;
+    }
+    request_queue_ptr = std::make_shared<IdleInferRequestQueue>();
+    // requests refer to their wrappers, so the vector is never resized after that
+    requests.resize(jobs);
+    InferenceEngine::ResponseDesc response;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        InferRequestWrap &infer_request = requests[i];
+        infer_request.index = i;
+        infer_request.request_queue_ptr = request_queue_ptr;
+        infer_request.user_callback = nullptr;
+        infer_request.user_data = this;
+        IE_CHECK_CALL(exec_network.actual->CreateInferRequest(infer_request.request_ptr, &response));
+        IE_CHECK_CALL(infer_request.request_ptr->SetUserData(&infer_request, &response));
+        infer_request.request_ptr->SetCompletionCallback(async_infer_queue_callback);
+        idle_ids.push(i);
+    }
+}
+
+InferenceEnginePython::AsyncInferQueue::~AsyncInferQueue() {
+    waitAll();
+}
+
+int InferenceEnginePython::AsyncInferQueue::getIdleRequestId() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] {return !idle_ids.empty() || !completed_ids.empty();});
+    if (idle_ids.empty())
+        return -1;
+    auto index = idle_ids.front();
+    idle_ids.pop();
+    return static_cast<int>(index);
+}
+
+int InferenceEnginePython::AsyncInferQueue::popCompletedRequestId(int &status) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (completed_ids.empty())
+        return -1;
+    auto completed = completed_ids.front();
+    completed_ids.pop();
+    status = completed.second;
+    return static_cast<int>(completed.first);
+}
+
+void InferenceEnginePython::AsyncInferQueue::startAsync(size_t index) {
+    InferRequestWrap &infer_request = requests.at(index);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running++;
+    }
+    InferenceEngine::ResponseDesc response;
+    infer_request.start_time = Time::now();
+    auto code = infer_request.request_ptr->StartAsync(&response);
+    if (code != InferenceEngine::StatusCode::OK) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running--;
+            idle_ids.push(index);
+        }
+        cv.notify_all();
+        THROW_IE_EXCEPTION << response.msg;
+    }
+}
+
+void InferenceEnginePython::AsyncInferQueue::setRequestIdle(size_t index) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        idle_ids.push(index);
+    }
+    cv.notify_all();
+}
+
+void InferenceEnginePython::AsyncInferQueue::setRequestCompleted(size_t index, int status) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running--;
+        completed_ids.emplace(index, status);
+    }
+    cv.notify_all();
+}
+
+void InferenceEnginePython::AsyncInferQueue::waitAll() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] {return 0 == running;});
+}
+
 InferenceEnginePython::IENetwork
 InferenceEnginePython::IECore::readNetwork(const std::string& modelPath, const std::string& binPath) {
     InferenceEngine::CNNNetwork net = actual.ReadNetwork(modelPath, binPath);
@@ -153,6 +153,34 @@ struct IEExecNetwork {
 };
 
 
+// Owns infer requests of the executable network and runs jobs on idle ones.
+// Completion of a job is recorded by a plugin thread without any Python calls,
+// the job callback is run later by the thread which starts the next job or waits for all jobs.
+struct AsyncInferQueue {
+    std::vector<InferRequestWrap> requests;
+    IdleInferRequestQueue::Ptr request_queue_ptr;
+    std::queue<size_t> idle_ids;
+    // ids and statuses of finished jobs which callbacks have not been run yet
+    std::queue<std::pair<size_t, int>> completed_ids;
+    size_t running = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    AsyncInferQueue(IEExecNetwork &exec_network, int jobs);
+    ~AsyncInferQueue();
+
+    // Waits for an idle request or a finished job, returns -1 if there is no idle request
+    int getIdleRequestId();
+    // Returns -1 if there are no finished jobs
+    int popCompletedRequestId(int &status);
+
+    void startAsync(size_t index);
+    void setRequestIdle(size_t index);
+    void setRequestCompleted(size_t index, int status);
+    void waitAll();
+};
+
+
 struct IECore {
     InferenceEngine::Core actual;
     explicit IECore(const std::string & xmlConfigFile = std::string());
@@ -0,0 +1,106 @@
+"""
+ Copyright (C) 2018-2021 Intel Corporation
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+"""
+
+import numpy as np
+import os
+import pytest
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+path_to_image = image_path()
+test_net_xml, test_net_bin = model_path(is_myriad)
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_image)
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w)) / 255
+    image = image.transpose((2, 0, 1)).astype(np.float32)
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def test_create_queue(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    infer_queue = ie.AsyncInferQueue(exec_net, 3)
+    assert len(infer_queue) == 3
+    assert all(isinstance(request, ie.InferRequest) for request in infer_queue)
+
+
+def test_start_async_with_callback(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    results = {}
+
+    def callback(request, job_id):
+        results[job_id] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    infer_queue = ie.AsyncInferQueue(exec_net, 2)
+    infer_queue.set_callback(callback)
+    num_jobs = 10
+    for job_id in range(num_jobs):
+        infer_queue.start_async({'data': img}, job_id)
+    infer_queue.wait_all()
+    assert results == {job_id: 2 for job_id in range(num_jobs)}
+
+
+def test_wait_all_without_jobs(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    infer_queue = ie.AsyncInferQueue(exec_net, 2)
+    infer_queue.wait_all()
+
+
+def test_callback_exception_releases_request(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+
+    def callback(request, userdata):
+        raise ValueError(userdata)
+
+    infer_queue = ie.AsyncInferQueue(exec_net, 1)
+    infer_queue.set_callback(callback)
+    infer_queue.start_async({'data': img}, "error in callback")
+    with pytest.raises(ValueError) as e:
+        infer_queue.wait_all()
+    assert "error in callback" in str(e.value)
+    # the request is idle again after the failed callback
+    infer_queue.set_callback(None)
+    infer_queue.start_async({'data': img})
+    infer_queue.wait_all()
+
+
+def test_negative_jobs_number(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    with pytest.raises(RuntimeError) as e:
+        ie.AsyncInferQueue(exec_net, -1)
+    assert "Number of jobs should be positive" in str(e.value)
@@ -283,12 +283,15 @@ def test_infer_modify_outputs(device):
     status_end = request.wait()
     assert status_end == ie.StatusCode.OK
     assert np.argmax(outputs0['fc_out']) == 2
+    # outputs share memory with the infer request output blobs
+    result = outputs0['fc_out'].copy()
     outputs0['fc_out'][:] = np.zeros(shape=(1, 10), dtype=np.float32)
     outputs1 = request.output_blobs
-    assert np.argmax(outputs1['fc_out'].buffer) == 2
+    assert np.array_equal(outputs1['fc_out'].buffer, outputs0['fc_out'])
     outputs1['fc_out'].buffer[:] = np.ones(shape=(1, 10), dtype=np.float32)
-    outputs2 = request.output_blobs
-    assert np.argmax(outputs2['fc_out'].buffer) == 2
+    assert np.array_equal(request.output_blobs['fc_out'].buffer, np.ones(shape=(1, 10), dtype=np.float32))
+    request.infer({'data': img})
+    assert np.allclose(outputs0['fc_out'], result)
     del exec_net
     del ie_core
     del net
@@ -470,6 +473,57 @@ def test_blob_setter(device):
     assert np.allclose(res_1, res_2, atol=1e-2, rtol=1e-2)
 
 
+def test_set_array(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(network=net, device_name=device, num_requests=1)
+    img = read_image()
+    res_1 = exec_net.infer({"data": img})['fc_out'].copy()
+
+    request = exec_net.requests[0]
+    img_array = np.zeros(shape=(1, 3, 32, 32), dtype=np.float32)
+    result = np.zeros(shape=(1, 10), dtype=np.float32)
+    request.set_array('data', img_array)
+    request.set_array('fc_out', result)
+    # input data is read from the array without copying
+    img_array[:] = img
+    assert np.array_equal(request.input_blobs['data'].buffer, img)
+    request.infer()
+    assert np.allclose(result, res_1, atol=1e-2, rtol=1e-2)
+
+
+def test_set_array_non_contiguous(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(network=net, device_name=device, num_requests=1)
+    img = np.transpose(read_image(), axes=(0, 1, 3, 2))
+    with pytest.raises(ValueError) as e:
+        exec_net.requests[0].set_array('data', img)
+    assert "should be C-contiguous" in str(e.value)
+
+
+def test_infer_in_threads(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    num_requests = 4
+    exec_net = ie_core.load_network(network=net, device_name=device, num_requests=num_requests)
+    img = read_image()
+    results = [None] * num_requests
+
+    def infer(i):
+        request = exec_net.requests[i]
+        request.infer({'data': img})
+        results[i] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    # infer releases GIL, so requests run in parallel
+    threads = [threading.Thread(target=infer, args=(i,)) for i in range(num_requests)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert results == [2] * num_requests
+
+
 def test_blob_setter_with_preprocess(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
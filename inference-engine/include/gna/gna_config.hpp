@@ -107,6 +107,21 @@ DECLARE_GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT);
 * of issuing. Additionally, in this case, software modes do not implement any serializations.
 */
 DECLARE_GNA_CONFIG_KEY(LIB_N_THREADS);
+
+/**
+* @brief The option to keep a separate set of memory states in every infer request, default value is NO.
+* If value is YES, states returned by InferRequest::QueryState() belong to that request only, so one
+* executable network is able to score many independent streams (e.g. utterances) which are switched
+* by requests instead of saving and restoring states manually.
+*
+* Requests with own states are not scored as a batch, in software modes either. Memory layers are embedded into the
+* compiled model, so an executable network scores one request with own states at a time: the request states are
+* copied into the model memory before every inference and copied back after it. Asynchronous requests with own
+* states are started without waiting, but they are scored one after another in the order of starting, so keeping
+* several streams in flight does not increase throughput. To score streams in parallel, load the network several
+* times.
+*/
+DECLARE_GNA_CONFIG_KEY(STATE_PER_REQUEST);
 }  // namespace GNAConfigParams
 
 namespace Metrics {
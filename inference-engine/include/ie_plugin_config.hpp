@@ -143,6 +143,74 @@ DECLARE_METRIC_KEY(NUMBER_OF_WAITING_INFER_REQUESTS, unsigned int);
  */
 DECLARE_METRIC_KEY(NUMBER_OF_EXEC_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Executable network metric to get a std::vector<std::string> of graph transformations statistics collected
+ * while the network was loaded.
+ *
+ * Each entry has "<name>,<depth>,<time_us>,<nodes_visited>,<rewrites>" format, entries go in the execution order
+ * and every transformation is followed by its nested ones, which have greater depth. Time and counters of a
+ * transformation include its nested ones.
+ * String value is "TRANSFORMATIONS_PROFILE"
+ */
+DECLARE_METRIC_KEY(TRANSFORMATIONS_PROFILE, std::vector<std::string>);
+
+/**
+ * @brief Metric to get a std::vector<std::string> of network loading phases statistics.
+ *
+ * Each entry has "<phase>,<time_us>,<peak_rss_kb>" format, where the peak resident set size of the process is taken
+ * at the end of the phase (0 if it is not available on the platform). Entries go in the execution order. Phases of
+ * graphs created for every stream in parallel have "stream_graph." prefix and are summed over streams.
+ * As a device metric it describes the last network loaded to the device.
+ * String value is "LOAD_NETWORK_PROFILE". This can be used as an executable network metric as well
+ */
+DECLARE_METRIC_KEY(LOAD_NETWORK_PROFILE, std::vector<std::string>);
+
+/**
+ * @brief Metric to get an uint64_t value of size in bytes of weights which are stored in the device weights cache
+ * shared between all streams and networks loaded to the device.
+ *
+ * String value is "WEIGHTS_CACHE_BYTES"
+ */
+DECLARE_METRIC_KEY(WEIGHTS_CACHE_BYTES, uint64_t);
+
+/**
+ * @brief Metric to get an uint64_t value of size in bytes of weights which were taken from the device weights cache
+ * instead of allocation of new copies since the device creation.
+ *
+ * String value is "WEIGHTS_CACHE_REUSED_BYTES"
+ */
+DECLARE_METRIC_KEY(WEIGHTS_CACHE_REUSED_BYTES, uint64_t);
+
+/**
+ * @brief Metric to get an unsigned int value of number of threads of streams executors existing in the process.
+ *
+ * String value is "STREAMS_EXECUTORS_THREADS"
+ */
+DECLARE_METRIC_KEY(STREAMS_EXECUTORS_THREADS, unsigned int);
+
+/**
+ * @brief Metric to get an uint64_t value of number of primitives which were taken from the process wide primitives
+ * cache shared between all streams and networks instead of creation of new ones.
+ *
+ * String value is "PRIMITIVES_CACHE_HITS"
+ */
+DECLARE_METRIC_KEY(PRIMITIVES_CACHE_HITS, uint64_t);
+
+/**
+ * @brief Metric to get an uint64_t value of number of primitives which were not found in the process wide
+ * primitives cache and were created.
+ *
+ * String value is "PRIMITIVES_CACHE_MISSES"
+ */
+DECLARE_METRIC_KEY(PRIMITIVES_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Metric to get an unsigned int value of number of primitives stored in the process wide primitives cache.
+ *
+ * String value is "PRIMITIVES_CACHE_SIZE"
+ */
+DECLARE_METRIC_KEY(PRIMITIVES_CACHE_SIZE, unsigned int);
+
 /**
  * @brief Metric to get a name of network. String value is "NETWORK_NAME".
  */
@@ -158,6 +226,16 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a std::vector<std::string> of queueing statistics of executable network in the shared streams pool.
+ *
+ * Each entry has "<name>,<value>" format, names are "tasks", "queued", "running", "queueing_time_us",
+ * "max_queueing_time_us" and "execution_time_us". The metric is supported if the network is loaded
+ * with KEY_CPU_SHARED_STREAMS set to YES.
+ * String value is "SHARED_STREAMS_STATISTICS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(SHARED_STREAMS_STATISTICS, std::vector<std::string>);
+
 }  // namespace Metrics
 
 /**
@@ -219,6 +297,71 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief Runs inference of the network by streams of a pool shared by all networks loaded with this option.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * The pool has the number of streams chosen for KEY_CPU_THROUGHPUT_STREAMS set to KEY_CPU_THROUGHPUT_AUTO.
+ * An idle stream of the pool takes the next request from the network which got the least stream time
+ * relative to its KEY_CPU_SHARED_STREAMS_WEIGHT, while networks can't occupy more streams than their
+ * KEY_CPU_SHARED_STREAMS_QUOTA.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS);
+
+/**
+ * @brief The key defines a share of the shared streams pool time of the network relative to other networks.
+ *
+ * The paired parameter value should be a positive integer number, the default is 1.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS_WEIGHT);
+
+/**
+ * @brief The key defines a maximal number of the shared streams pool streams running requests of the network.
+ *
+ * The paired parameter value should be a positive integer number, it is limited by KEY_CPU_THROUGHPUT_STREAMS
+ * of the network. 0 (default) means the network streams number.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS_QUOTA);
+
+/**
+ * @brief The key defines a maximal number of primitives in the process wide primitives cache of CPU plugin.
+ *
+ * It is passed to Core::SetConfig(), the paired parameter value should be a non negative integer number.
+ * Least recently used primitives are evicted from the cache, 0 disables the cache. The default is 1024.
+ */
+DECLARE_CONFIG_KEY(CPU_PRIMITIVES_CACHE_CAPACITY);
+
+/**
+ * @brief The key defines a minimal fraction of zero values in constant weights of FullyConnected layers
+ * to execute them by CPU sparse weights kernel instead of dense one.
+ *
+ * It is passed to Core::LoadNetwork(), the paired parameter value should be a floating point number in [0, 1] range.
+ * 0 (default) disables sparse weights kernel.
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_THRESHOLD);
+
+/**
+ * @brief Executes FP32 FullyConnected layers (including MatMul with constant weights) by INT8 GEMM
+ * with activations quantized at runtime, so no offline calibration is needed.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values:
+ * - PluginConfigParams::NO (default) disables dynamic quantization
+ * - PluginConfigParams::CPU_DYNAMIC_QUANTIZATION_PER_TENSOR uses one activations scale for the whole input tensor
+ * - PluginConfigParams::CPU_DYNAMIC_QUANTIZATION_PER_ROW uses a separate activations scale for every input row (token)
+ * Weights are quantized per output channel once at network loading. The option takes effect on CPUs
+ * with avx512_core_vnni support only, on other CPUs the layers are silently executed in FP32.
+ */
+DECLARE_CONFIG_VALUE(CPU_DYNAMIC_QUANTIZATION_PER_TENSOR);
+DECLARE_CONFIG_VALUE(CPU_DYNAMIC_QUANTIZATION_PER_ROW);
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_QUANTIZATION);
+
+/**
+ * @brief The key defines a comma separated list of layer names excluded from dynamic quantization,
+ * these layers are executed in FP32. Empty by default.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_QUANTIZATION_EXCLUDE);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -105,6 +105,35 @@ static const char shape_message[] = "Optional. Set shape for input. For example,
 static const char layout_message[] = "Optional. Prompts how network layouts should be treated by application. "
                                      "For example, \"input1[NCHW],input2[NC]\" or \"[NCHW]\" in case of one input size.";
 
+// @brief message for sweep options
+static const char sweep_nstreams_message[] = "Optional. Comma separated list of streams numbers to sweep over, for example \"1,2,4\". "
+                                             "0 means the device default. Setting any of the -sweep_* options enables the sweep mode: "
+                                             "the network is read once and each combination of the listed values is loaded and "
+                                             "measured in turn, see README for details.";
+
+static const char sweep_nireq_message[] = "Optional. Comma separated list of infer requests numbers to sweep over. "
+                                          "0 means the optimal number of requests reported by the device.";
+
+static const char sweep_batch_message[] = "Optional. Comma separated list of batch sizes to sweep over. 0 means the batch from the model.";
+
+static const char sweep_nthreads_message[] = "Optional. Comma separated list of CPU threads numbers to sweep over. 0 means the device default.";
+
+static const char latency_slo_message[] = "Optional. p99 latency SLO in milliseconds. The sweep mode recommends the configuration with "
+                                          "the best throughput among ones meeting the SLO. By default the best throughput configuration "
+                                          "is recommended.";
+
+// @brief message for open-loop load options
+static const char arrival_message[] = "Optional. Enables open-loop load: requests are started at arrival times of the process "
+                                      "regardless of completion of the previous ones. Supported values: \"constant\", \"poisson\" "
+                                      "(use -rate) and \"trace\" (use -arrival_trace). Arrivals which find all -nireq requests busy "
+                                      "wait for one, this time is reported as queueing delay separately from execution latency.";
+
+static const char rate_message[] = "Optional. Comma separated list of offered loads in requests per second for the constant or "
+                                   "poisson arrivals, for example \"50,100,200\". Each load is applied for -t seconds.";
+
+static const char arrival_trace_message[] = "Optional. Path to a file with arrival timestamps in milliseconds, one per line, "
+                                            "to replay with the trace arrivals.";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -198,6 +227,25 @@ DEFINE_string(layout, "", layout_message);
 /// @brief Define flag for quantization bits (default 16)
 DEFINE_int32(qb, 16, gna_qb_message);
 
+/// @brief Define flags for the open-loop load <br>
+DEFINE_string(arrival, "", arrival_message);
+
+DEFINE_string(rate, "", rate_message);
+
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief Define flags for the sweep mode grid <br>
+DEFINE_string(sweep_nstreams, "", sweep_nstreams_message);
+
+DEFINE_string(sweep_nireq, "", sweep_nireq_message);
+
+DEFINE_string(sweep_b, "", sweep_batch_message);
+
+DEFINE_string(sweep_nthreads, "", sweep_nthreads_message);
+
+/// @brief Define flag for the latency SLO used by the sweep mode recommendation <br>
+DEFINE_double(latency_slo, 0.0, latency_slo_message);
+
 /**
 * @brief This function show a help message
 */
@@ -237,4 +285,14 @@ static void showUsage() {
     std::cout << "    -load_config              " << load_config_message << std::endl;
 #endif
     std::cout << "    -qb                       " << gna_qb_message << std::endl;
+    std::cout << std::endl << "  Open-loop load options:" << std::endl;
+    std::cout << "    -arrival \"<type>\"       " << arrival_message << std::endl;
+    std::cout << "    -rate \"<list>\"          " << rate_message << std::endl;
+    std::cout << "    -arrival_trace \"<path>\" " << arrival_trace_message << std::endl;
+    std::cout << std::endl << "  Sweep options:" << std::endl;
+    std::cout << "    -sweep_nstreams \"<list>\"  " << sweep_nstreams_message << std::endl;
+    std::cout << "    -sweep_nireq \"<list>\"     " << sweep_nireq_message << std::endl;
+    std::cout << "    -sweep_b \"<list>\"         " << sweep_batch_message << std::endl;
+    std::cout << "    -sweep_nthreads \"<list>\"  " << sweep_nthreads_message << std::endl;
+    std::cout << "    -latency_slo \"<float>\"    " << latency_slo_message << std::endl;
 }
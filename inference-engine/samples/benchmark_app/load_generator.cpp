@@ -0,0 +1,116 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "infer_request_wrap.hpp"
+#include "load_generator.hpp"
+#include "utils.hpp"
+
+namespace benchmark_app {
+    std::vector<double> parseRates(const std::string& rates_string) {
+        std::vector<double> rates;
+        for (auto& value : split(rates_string, ',')) {
+            if (value.empty())
+                continue;
+            size_t parsed = 0;
+            double rate = 0.0;
+            try {
+                rate = std::stod(value, &parsed);
+            } catch (const std::exception&) {
+                parsed = 0;
+            }
+            if (parsed != value.size() || rate <= 0.0)
+                throw std::logic_error("Can't parse rates string: " + rates_string);
+            rates.push_back(rate);
+        }
+        return rates;
+    }
+
+    std::vector<double> readArrivalTrace(const std::string& trace_path) {
+        std::ifstream file(trace_path);
+        if (!file)
+            throw std::logic_error("Can't open arrival trace file: " + trace_path);
+
+        std::vector<double> arrivals;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line.front() == '#')
+                continue;
+            arrivals.push_back(std::stod(line));
+        }
+        if (arrivals.empty())
+            throw std::logic_error("Arrival trace file is empty: " + trace_path);
+
+        std::sort(arrivals.begin(), arrivals.end());
+        const double first = arrivals.front();
+        for (auto& arrival : arrivals)
+            arrival -= first;
+        return arrivals;
+    }
+
+    std::vector<double> makeArrivalTimes(const std::string& arrival, double rate, double duration_ms) {
+        const double mean_interval_ms = 1000.0 / rate;
+        std::vector<double> arrivals;
+        if (arrival == constantArrival) {
+            for (double time = 0.0; time < duration_ms; time += mean_interval_ms)
+                arrivals.push_back(time);
+        } else if (arrival == poissonArrival) {
+            // fixed seed makes runs with the same options comparable
+            std::mt19937 generator(0);
+            std::exponential_distribution<double> interval(1.0 / mean_interval_ms);
+            for (double time = 0.0; time < duration_ms; time += interval(generator))
+                arrivals.push_back(time);
+        } else {
+            throw std::logic_error("Unsupported arrival process: " + arrival);
+        }
+        return arrivals;
+    }
+
+    LoadResult runOpenLoop(InferRequestsQueue& inferRequestsQueue, const std::vector<double>& arrivals, size_t batchSize) {
+        inferRequestsQueue.resetTimes();
+
+        const auto startTime = Time::now();
+        for (auto arrival : arrivals) {
+            const auto arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(
+                std::chrono::duration<double, std::milli>(arrival));
+            std::this_thread::sleep_until(arrivalTime);
+
+            // blocks while all requests are busy, the arrival is queued meanwhile
+            auto inferRequest = inferRequestsQueue.getIdleRequest();
+            inferRequest->wait();
+            inferRequest->startAsync(arrivalTime);
+        }
+        inferRequestsQueue.waitAll();
+
+        const auto latencies = inferRequestsQueue.getLatencies();
+        const auto queueingTimes = inferRequestsQueue.getQueueingTimes();
+        std::vector<double> totalTimes(latencies.size());
+        std::transform(latencies.begin(), latencies.end(), queueingTimes.begin(), totalTimes.begin(), std::plus<double>());
+
+        LoadResult result;
+        result.iterations = arrivals.size();
+        result.duration = inferRequestsQueue.getDurationInMilliseconds();
+        result.offered_rate = (arrivals.size() > 1 && arrivals.back() > 0.0) ? 1000.0 * (arrivals.size() - 1) / arrivals.back() : 0.0;
+        result.throughput = batchSize * 1000.0 * arrivals.size() / result.duration;
+        result.queueing_p50 = getPercentileValue(queueingTimes, 50.0);
+        result.queueing_p90 = getPercentileValue(queueingTimes, 90.0);
+        result.queueing_p99 = getPercentileValue(queueingTimes, 99.0);
+        result.execution_p50 = getPercentileValue(latencies, 50.0);
+        result.execution_p90 = getPercentileValue(latencies, 90.0);
+        result.execution_p99 = getPercentileValue(latencies, 99.0);
+        result.total_p50 = getPercentileValue(totalTimes, 50.0);
+        result.total_p90 = getPercentileValue(totalTimes, 90.0);
+        result.total_p99 = getPercentileValue(totalTimes, 99.0);
+        return result;
+    }
+}  // namespace benchmark_app
@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class InferRequestsQueue;
+
+// @brief open-loop arrival processes
+static constexpr char constantArrival[] = "constant";
+static constexpr char poissonArrival[] = "poisson";
+static constexpr char traceArrival[] = "trace";
+
+namespace benchmark_app {
+    /// @brief Latencies of the open-loop load at one offered rate, all times are in milliseconds
+    struct LoadResult {
+        double offered_rate = 0.0;
+        double throughput = 0.0;
+        size_t iterations = 0;
+        double duration = 0.0;
+        double queueing_p50 = 0.0;
+        double queueing_p90 = 0.0;
+        double queueing_p99 = 0.0;
+        double execution_p50 = 0.0;
+        double execution_p90 = 0.0;
+        double execution_p99 = 0.0;
+        double total_p50 = 0.0;
+        double total_p90 = 0.0;
+        double total_p99 = 0.0;
+    };
+
+    /// @brief Parses comma separated list of positive rates in requests per second like "100,200.5"
+    std::vector<double> parseRates(const std::string& rates_string);
+
+    /// @brief Reads arrival timestamps in milliseconds, one per line, and returns them relative to the first one
+    std::vector<double> readArrivalTrace(const std::string& trace_path);
+
+    /// @brief Generates arrival times in milliseconds from the start for the constant or Poisson process
+    std::vector<double> makeArrivalTimes(const std::string& arrival, double rate, double duration_ms);
+
+    /// @brief Starts requests at the given arrival times regardless of completion of the previous ones.
+    ///        Arrivals which find no idle request wait for one, this wait is reported as the queueing time.
+    LoadResult runOpenLoop(InferRequestsQueue& inferRequestsQueue, const std::vector<double>& arrivals, size_t batchSize);
+}  // namespace benchmark_app
@@ -23,12 +23,16 @@
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
+#include "sweep.hpp"
 #include "utils.hpp"
 
 using namespace InferenceEngine;
 
 static const size_t progressBarDefaultTotalCount = 1000;
 
+static const uint32_t sweepDefaultDurationInSeconds = 10;
+
 uint64_t getDurationInMilliseconds(uint32_t duration) {
     return duration * 1000LL;
 }
@@ -37,6 +41,15 @@ uint64_t getDurationInNanoseconds(uint32_t duration) {
     return duration * 1000000000LL;
 }
 
+bool isOpenLoopMode() {
+    return !FLAGS_arrival.empty();
+}
+
+bool isSweepMode() {
+    return !FLAGS_sweep_nstreams.empty() || !FLAGS_sweep_nireq.empty() ||
+           !FLAGS_sweep_b.empty() || !FLAGS_sweep_nthreads.empty();
+}
+
 bool ParseAndCheckCommandLine(int argc, char *argv[]) {
     // ---------------------------Parsing and validating input arguments--------------------------------------
     slog::info << "Parsing input parameters" << slog::endl;
@@ -67,6 +80,40 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (isOpenLoopMode()) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop load supports only async API");
+        }
+        if (FLAGS_arrival == constantArrival || FLAGS_arrival == poissonArrival) {
+            if (FLAGS_rate.empty())
+                throw std::logic_error("-rate option is required for " + FLAGS_arrival + " arrivals");
+        } else if (FLAGS_arrival == traceArrival) {
+            if (FLAGS_arrival_trace.empty())
+                throw std::logic_error("-arrival_trace option is required for trace arrivals");
+        } else {
+            throw std::logic_error("only " + std::string(constantArrival) + "/" + std::string(poissonArrival) + "/" +
+                                   std::string(traceArrival) + " arrivals are supported (invalid -arrival option value)");
+        }
+        if (isSweepMode()) {
+            throw std::logic_error("Open-loop load can't be combined with the sweep mode");
+        }
+    }
+
+    if (isSweepMode()) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Sweep mode supports only async API");
+        }
+        if (fileExt(FLAGS_m) == "blob") {
+            throw std::logic_error("Sweep mode requires a model to read, compiled network can't be reconfigured");
+        }
+        if ((FLAGS_d.find("MULTI") != std::string::npos) || (FLAGS_d.find("HETERO") != std::string::npos)) {
+            throw std::logic_error("Sweep mode supports only a single device");
+        }
+        if (!FLAGS_sweep_nthreads.empty() && (FLAGS_d != "CPU")) {
+            throw std::logic_error("-sweep_nthreads option is supported only for CPU device");
+        }
+    }
+
     return true;
 }
 
@@ -103,6 +150,208 @@ T getMedianValue(const std::vector<T> &vec) {
            (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
 }
 
+/**
+* @brief Applies the open-loop load for each offered rate or replays the arrival trace and reports latencies vs load
+*/
+static void runOpenLoopLoad(InferRequestsQueue& inferRequestsQueue, size_t batchSize, uint32_t duration_seconds,
+                            std::shared_ptr<StatisticsReport> statistics) {
+    using namespace benchmark_app;
+
+    std::vector<std::vector<double>> loads;
+    if (FLAGS_arrival == traceArrival) {
+        loads.push_back(readArrivalTrace(FLAGS_arrival_trace));
+        slog::info << "Replaying " << loads.back().size() << " arrivals from " << FLAGS_arrival_trace << slog::endl;
+    } else {
+        if (FLAGS_niter != 0) {
+            slog::warn << "-niter option is ignored for open-loop load, each rate is applied for "
+                       << duration_seconds << " seconds" << slog::endl;
+        }
+        for (auto rate : parseRates(FLAGS_rate))
+            loads.push_back(makeArrivalTimes(FLAGS_arrival, rate, static_cast<double>(getDurationInMilliseconds(duration_seconds))));
+    }
+
+    std::vector<LoadResult> results;
+    for (auto& arrivals : loads) {
+        auto result = runOpenLoop(inferRequestsQueue, arrivals, batchSize);
+        slog::info << "Offered load " << result.offered_rate << " req/s -> " << result.throughput << " FPS, "
+                   << "queueing p50/p90/p99 " << result.queueing_p50 << "/" << result.queueing_p90 << "/" << result.queueing_p99
+                   << " ms, execution p50/p90/p99 " << result.execution_p50 << "/" << result.execution_p90 << "/"
+                   << result.execution_p99 << " ms" << slog::endl;
+        results.push_back(result);
+    }
+
+    StatisticsReport loadReport(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder});
+    loadReport.dumpLoadResults(results);
+    if (statistics) {
+        statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                  {
+                                          {"arrival process", FLAGS_arrival},
+                                          {"number of parallel infer requests", std::to_string(inferRequestsQueue.requests.size())},
+                                  });
+        for (auto& result : results) {
+            std::stringstream ss;
+            ss << std::fixed << std::setprecision(2) << result.offered_rate;
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {"throughput at " + ss.str() + " req/s", std::to_string(result.throughput)},
+                                              {"total latency p99 (ms) at " + ss.str() + " req/s", std::to_string(result.total_p99)},
+                                      });
+        }
+    }
+
+    std::cout << std::setw(14) << "offered req/s" << std::setw(12) << "FPS"
+              << std::setw(28) << "queueing p50/p90/p99 (ms)" << std::setw(29) << "execution p50/p90/p99 (ms)"
+              << std::setw(25) << "total p50/p90/p99 (ms)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (auto& result : results) {
+        auto triple = [] (double p50, double p90, double p99) {
+            std::stringstream ss;
+            ss << std::fixed << std::setprecision(2) << p50 << "/" << p90 << "/" << p99;
+            return ss.str();
+        };
+        std::cout << std::setw(14) << result.offered_rate << std::setw(12) << result.throughput
+                  << std::setw(28) << triple(result.queueing_p50, result.queueing_p90, result.queueing_p99)
+                  << std::setw(29) << triple(result.execution_p50, result.execution_p90, result.execution_p99)
+                  << std::setw(25) << triple(result.total_p50, result.total_p90, result.total_p99) << std::endl;
+    }
+}
+
+/**
+* @brief Loads and measures the network for each configuration of the sweep grid and reports the Pareto table
+*/
+static void runSweep(Core& ie, CNNNetwork& cnnNetwork, const std::string& device_name,
+                     const benchmark_app::InputsInfo& app_inputs_info,
+                     const std::vector<std::string>& inputFiles,
+                     std::shared_ptr<StatisticsReport> statistics) {
+    using namespace benchmark_app;
+
+    const auto grid = makeSweepGrid(parseSweepValues(FLAGS_sweep_nstreams), parseSweepValues(FLAGS_sweep_nireq),
+                                    parseSweepValues(FLAGS_sweep_b), parseSweepValues(FLAGS_sweep_nthreads));
+    const std::string streams_key = device_name + "_THROUGHPUT_STREAMS";
+    if (!parseSweepValues(FLAGS_sweep_nstreams).empty()) {
+        std::vector<std::string> supported_config_keys = ie.GetMetric(device_name, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        if (std::find(supported_config_keys.begin(), supported_config_keys.end(), streams_key) == supported_config_keys.end()) {
+            throw std::logic_error("Device " + device_name + " doesn't support config key '" + streams_key + "'!");
+        }
+    }
+    const uint32_t duration_seconds = (FLAGS_t != 0) ? FLAGS_t : sweepDefaultDurationInSeconds;
+    if (FLAGS_niter != 0) {
+        slog::warn << "-niter option is ignored in sweep mode, each configuration is measured for "
+                   << duration_seconds << " seconds" << slog::endl;
+    }
+
+    // ----------------- 7-9. Loading the model, setting runtime parameters and creating requests ------------------
+    next_step("for each sweep configuration");
+    next_step("for each sweep configuration");
+    next_step("for each sweep configuration");
+
+    // ----------------- 10. Measuring performance ------------------------------------------------------------------
+    next_step("sweep over " + std::to_string(grid.size()) + " configurations, limits: " +
+              std::to_string(getDurationInMilliseconds(duration_seconds)) + " ms duration each");
+
+    auto get_config_value = [] (ExecutableNetwork& exeNetwork, const std::string& key, uint32_t requested) {
+        try {
+            return exeNetwork.GetConfig(key).as<std::string>();
+        } catch (const std::exception&) {
+            return requested != 0 ? std::to_string(requested) : std::string("default");
+        }
+    };
+
+    std::vector<SweepResult> results;
+    for (size_t i = 0; i < grid.size(); i++) {
+        const auto& point = grid[i];
+
+        // the network is read once and only reshaped when the batch changes
+        auto point_inputs_info = app_inputs_info;
+        if (point.batch != 0) {
+            for (auto& item : point_inputs_info) {
+                auto batch_index = item.second.layout.find("N");
+                if (batch_index != std::string::npos)
+                    item.second.shape[batch_index] = point.batch;
+            }
+        }
+        InferenceEngine::ICNNNetwork::InputShapes shapes;
+        for (auto& item : point_inputs_info)
+            shapes[item.first] = item.second.shape;
+        if (shapes != cnnNetwork.getInputShapes()) {
+            slog::info << "Reshaping network: " << getShapesString(shapes) << slog::endl;
+            cnnNetwork.reshape(shapes);
+        }
+        size_t batchSize = (!FLAGS_layout.empty()) ? getBatchSize(point_inputs_info) : cnnNetwork.getBatchSize();
+
+        std::map<std::string, std::string> load_config;
+        if (point.nstreams != 0)
+            load_config[streams_key] = std::to_string(point.nstreams);
+        if (point.nthreads != 0)
+            load_config[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(point.nthreads);
+        auto exeNetwork = ie.LoadNetwork(cnnNetwork, device_name, load_config);
+
+        uint32_t nireq = point.nireq;
+        if (nireq == 0)
+            nireq = exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+
+        auto result = measureSweepPoint(exeNetwork, nireq, batchSize, inputFiles, point_inputs_info,
+                                        getDurationInNanoseconds(duration_seconds));
+        result.nstreams = get_config_value(exeNetwork, streams_key, point.nstreams);
+        result.nthreads = (device_name == "CPU") ? get_config_value(exeNetwork, CONFIG_KEY(CPU_THREADS_NUM), point.nthreads) :
+                                                   std::string("default");
+        slog::info << "Sweep configuration " << i + 1 << "/" << grid.size() << ": "
+                   << result.nstreams << " streams, " << result.nireq << " requests, batch " << result.batch
+                   << ", " << result.nthreads << " threads -> " << result.throughput << " FPS, latency p50/p90/p99 "
+                   << result.latency_p50 << "/" << result.latency_p90 << "/" << result.latency_p99 << " ms" << slog::endl;
+        results.push_back(result);
+    }
+
+    markParetoOptimal(results);
+    const size_t recommended = recommendForLatencySLO(results, FLAGS_latency_slo);
+
+    // ----------------- 11. Dumping statistics report -------------------------------------------------------------
+    next_step();
+
+    StatisticsReport sweepReport(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder});
+    sweepReport.dumpSweepResults(results, recommended);
+
+    const auto& best = results[recommended];
+    if (statistics) {
+        statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                  {
+                                          {"target device", device_name},
+                                          {"number of sweep configurations", std::to_string(grid.size())},
+                                          {"duration per configuration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
+                                  });
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {
+                                          {"recommended number of streams", best.nstreams},
+                                          {"recommended number of parallel infer requests", std::to_string(best.nireq)},
+                                          {"recommended batch size", std::to_string(best.batch)},
+                                          {"recommended number of threads", best.nthreads},
+                                          {"throughput", std::to_string(best.throughput)},
+                                          {"latency p99 (ms)", std::to_string(best.latency_p99)},
+                                  });
+        statistics->dump();
+    }
+
+    std::cout << std::setw(10) << "nstreams" << std::setw(8) << "nireq" << std::setw(8) << "batch"
+              << std::setw(10) << "nthreads" << std::setw(14) << "throughput" << std::setw(10) << "p50 (ms)"
+              << std::setw(10) << "p90 (ms)" << std::setw(10) << "p99 (ms)" << std::setw(8) << "pareto" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& result = results[i];
+        std::cout << std::setw(10) << result.nstreams << std::setw(8) << result.nireq << std::setw(8) << result.batch
+                  << std::setw(10) << result.nthreads << std::setw(14) << result.throughput
+                  << std::setw(10) << result.latency_p50 << std::setw(10) << result.latency_p90
+                  << std::setw(10) << result.latency_p99 << std::setw(8) << (result.pareto ? "*" : "")
+                  << (i == recommended ? "  <- recommended" : "") << std::endl;
+    }
+    std::cout << "Recommended configuration";
+    if (FLAGS_latency_slo > 0.0)
+        std::cout << " for p99 latency SLO " << FLAGS_latency_slo << " ms";
+    std::cout << ": -nstreams " << best.nstreams << " -nireq " << best.nireq << " -b " << best.batch;
+    if (device_name == "CPU" && best.nthreads != "default")
+        std::cout << " -nthreads " << best.nthreads;
+    std::cout << " (" << best.throughput << " FPS, p99 latency " << best.latency_p99 << " ms)" << std::endl;
+}
+
 /**
 * @brief The entry point of the benchmark application
 */
@@ -380,6 +629,12 @@ int main(int argc, char *argv[]) {
                     item.second->setPrecision(app_inputs_info.at(item.first).precision);
                 }
             }
+
+            if (isSweepMode()) {
+                runSweep(ie, cnnNetwork, device_name, app_inputs_info, inputFiles, statistics);
+                return 0;
+            }
+
             // ----------------- 7. Loading the model to the device --------------------------------------------------------
             next_step();
             startTime = Time::now();
@@ -512,6 +767,9 @@ int main(int argc, char *argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (isOpenLoopMode()) {
+                ss << ", open-loop " << FLAGS_arrival << " arrivals";
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -548,6 +806,18 @@ int main(int argc, char *argv[]) {
                                         });
         inferRequestsQueue.resetTimes();
 
+        if (isOpenLoopMode()) {
+            runOpenLoopLoad(inferRequestsQueue, batchSize,
+                            (duration_seconds != 0) ? duration_seconds : deviceDefaultDeviceDurationInSeconds(device_name),
+                            statistics);
+
+            // ----------------- 11. Dumping statistics report -------------------------------------------------------------
+            next_step();
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
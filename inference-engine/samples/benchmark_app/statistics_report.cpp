@@ -7,6 +7,7 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <fstream>
 
 #include "statistics_report.hpp"
 
@@ -132,3 +133,66 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpLoadResults(const std::vector<benchmark_app::LoadResult>& results) {
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_load_report.csv");
+    dumper << "offered rate (req/s)" << "throughput" << "iterations" << "duration (ms)";
+    dumper << "queueing p50 (ms)" << "queueing p90 (ms)" << "queueing p99 (ms)";
+    dumper << "execution p50 (ms)" << "execution p90 (ms)" << "execution p99 (ms)";
+    dumper << "total p50 (ms)" << "total p90 (ms)" << "total p99 (ms)";
+    dumper.endLine();
+    for (auto& result : results) {
+        dumper << result.offered_rate << result.throughput << result.iterations << result.duration;
+        dumper << result.queueing_p50 << result.queueing_p90 << result.queueing_p99;
+        dumper << result.execution_p50 << result.execution_p90 << result.execution_p99;
+        dumper << result.total_p50 << result.total_p90 << result.total_p99;
+        dumper.endLine();
+    }
+    slog::info << "Open-loop load report is stored to " << dumper.getFilename() << slog::endl;
+}
+
+void StatisticsReport::dumpSweepResults(const std::vector<benchmark_app::SweepResult>& results, size_t recommended) {
+    static const char* columns[] = { "nstreams", "nireq", "batch", "nthreads", "iterations", "duration (ms)", "throughput",
+                                     "latency p50 (ms)", "latency p90 (ms)", "latency p99 (ms)", "pareto", "recommended" };
+
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_sweep_report.csv");
+    for (auto column : columns) {
+        dumper << column;
+    }
+    dumper.endLine();
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& result = results[i];
+        dumper << result.nstreams << result.nireq << result.batch << result.nthreads << result.iterations;
+        dumper << result.duration << result.throughput << result.latency_p50 << result.latency_p90 << result.latency_p99;
+        dumper << (result.pareto ? "YES" : "NO") << (i == recommended ? "YES" : "NO");
+        dumper.endLine();
+    }
+    slog::info << "Sweep report is stored to " << dumper.getFilename() << slog::endl;
+
+    const std::string jsonFilename = _config.report_folder + _separator + "benchmark_sweep_report.json";
+    std::ofstream json(jsonFilename);
+    if (!json) {
+        slog::warn << "Cannot create " << jsonFilename << slog::endl;
+        return;
+    }
+    auto dump_result = [&json] (const benchmark_app::SweepResult& result) {
+        json << "{\"nstreams\": \"" << result.nstreams << "\", \"nireq\": " << result.nireq
+             << ", \"batch\": " << result.batch << ", \"nthreads\": \"" << result.nthreads << "\""
+             << ", \"iterations\": " << result.iterations << ", \"duration_ms\": " << result.duration
+             << ", \"throughput\": " << result.throughput << ", \"latency_p50_ms\": " << result.latency_p50
+             << ", \"latency_p90_ms\": " << result.latency_p90 << ", \"latency_p99_ms\": " << result.latency_p99
+             << ", \"pareto\": " << (result.pareto ? "true" : "false") << "}";
+    };
+    json << "{\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        json << (i == 0 ? "\n    " : ",\n    ");
+        dump_result(results[i]);
+    }
+    json << "\n  ],\n  \"recommended\": ";
+    if (recommended < results.size())
+        dump_result(results[recommended]);
+    else
+        json << "null";
+    json << "\n}\n";
+    slog::info << "Sweep report is stored to " << jsonFilename << slog::endl;
+}
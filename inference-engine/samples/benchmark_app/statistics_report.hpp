@@ -14,6 +14,9 @@
 #include <samples/slog.hpp>
 #include <samples/csv_dumper.hpp>
 
+#include "load_generator.hpp"
+#include "sweep.hpp"
+
 // @brief statistics reports types
 static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
@@ -57,6 +60,10 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    void dumpLoadResults(const std::vector<benchmark_app::LoadResult>& results);
+
+    void dumpSweepResults(const std::vector<benchmark_app::SweepResult>& results, size_t recommended);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
@@ -0,0 +1,138 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <samples/slog.hpp>
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "sweep.hpp"
+
+using namespace InferenceEngine;
+
+namespace benchmark_app {
+    std::vector<uint32_t> parseSweepValues(const std::string& values_string) {
+        std::vector<uint32_t> values;
+        for (auto& value : split(values_string, ',')) {
+            if (value.empty())
+                continue;
+            if (value.find_first_not_of("0123456789") != std::string::npos)
+                throw std::logic_error("Can't parse sweep values string: " + values_string);
+            values.push_back(static_cast<uint32_t>(std::stoul(value)));
+        }
+        return values;
+    }
+
+    std::vector<SweepConfig> makeSweepGrid(const std::vector<uint32_t>& nstreams,
+                                           const std::vector<uint32_t>& nireq,
+                                           const std::vector<uint32_t>& batch,
+                                           const std::vector<uint32_t>& nthreads) {
+        auto orDefault = [] (const std::vector<uint32_t>& values) {
+            return values.empty() ? std::vector<uint32_t>{0} : values;
+        };
+        std::vector<SweepConfig> grid;
+        // batch is the outermost loop since its change requires the network reshape
+        for (auto b : orDefault(batch)) {
+            for (auto threads : orDefault(nthreads)) {
+                for (auto streams : orDefault(nstreams)) {
+                    for (auto requests : orDefault(nireq)) {
+                        SweepConfig config;
+                        config.nstreams = streams;
+                        config.nireq = requests;
+                        config.batch = b;
+                        config.nthreads = threads;
+                        grid.push_back(config);
+                    }
+                }
+            }
+        }
+        return grid;
+    }
+
+    SweepResult measureSweepPoint(ExecutableNetwork& exeNetwork,
+                                  uint32_t nireq,
+                                  size_t batchSize,
+                                  const std::vector<std::string>& inputFiles,
+                                  InputsInfo& app_inputs_info,
+                                  uint64_t duration_nanoseconds) {
+        InferRequestsQueue inferRequestsQueue(exeNetwork, nireq);
+        fillBlobs(inputFiles, batchSize, app_inputs_info, inferRequestsQueue.requests);
+
+        // warming up - out of scope
+        auto inferRequest = inferRequestsQueue.getIdleRequest();
+        inferRequest->startAsync();
+        inferRequestsQueue.waitAll();
+        inferRequest->wait();
+        inferRequestsQueue.resetTimes();
+
+        size_t iteration = 0;
+        auto startTime = Time::now();
+        uint64_t execTime = 0;
+        // keep all requests in flight and stop on the requests number boundary as the regular async mode does
+        while (execTime < duration_nanoseconds || iteration % nireq != 0) {
+            inferRequest = inferRequestsQueue.getIdleRequest();
+            inferRequest->wait();
+            inferRequest->startAsync();
+            iteration++;
+            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        }
+        inferRequestsQueue.waitAll();
+
+        const auto latencies = inferRequestsQueue.getLatencies();
+        SweepResult result;
+        result.nireq = nireq;
+        result.batch = batchSize;
+        result.iterations = iteration;
+        result.duration = inferRequestsQueue.getDurationInMilliseconds();
+        result.throughput = batchSize * 1000.0 * iteration / result.duration;
+        result.latency_p50 = getPercentileValue(latencies, 50.0);
+        result.latency_p90 = getPercentileValue(latencies, 90.0);
+        result.latency_p99 = getPercentileValue(latencies, 99.0);
+        return result;
+    }
+
+    void markParetoOptimal(std::vector<SweepResult>& results) {
+        auto dominates = [] (const SweepResult& lhs, const SweepResult& rhs) {
+            const bool notWorse = lhs.throughput >= rhs.throughput &&
+                                  lhs.latency_p50 <= rhs.latency_p50 &&
+                                  lhs.latency_p90 <= rhs.latency_p90 &&
+                                  lhs.latency_p99 <= rhs.latency_p99;
+            const bool better = lhs.throughput > rhs.throughput ||
+                                lhs.latency_p50 < rhs.latency_p50 ||
+                                lhs.latency_p90 < rhs.latency_p90 ||
+                                lhs.latency_p99 < rhs.latency_p99;
+            return notWorse && better;
+        };
+        for (auto& result : results) {
+            result.pareto = std::none_of(results.begin(), results.end(), [&] (const SweepResult& other) {
+                return dominates(other, result);
+            });
+        }
+    }
+
+    size_t recommendForLatencySLO(const std::vector<SweepResult>& results, double latency_slo) {
+        if (results.empty())
+            throw std::logic_error("Sweep results are empty");
+        size_t best = results.size();
+        for (size_t i = 0; i < results.size(); i++) {
+            if (latency_slo > 0.0 && results[i].latency_p99 > latency_slo)
+                continue;
+            if (best == results.size() || results[i].throughput > results[best].throughput)
+                best = i;
+        }
+        if (best != results.size())
+            return best;
+
+        slog::warn << "No configuration meets p99 latency SLO " << latency_slo << " ms, "
+                   << "the configuration with the lowest p99 latency is recommended" << slog::endl;
+        return static_cast<size_t>(std::distance(results.begin(),
+            std::min_element(results.begin(), results.end(), [] (const SweepResult& lhs, const SweepResult& rhs) {
+                return lhs.latency_p99 < rhs.latency_p99;
+            })));
+    }
+}  // namespace benchmark_app
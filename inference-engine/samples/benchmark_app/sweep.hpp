@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "utils.hpp"
+
+namespace benchmark_app {
+    /// @brief One point of the sweep grid, zero values mean that the device default is used
+    struct SweepConfig {
+        uint32_t nstreams = 0;
+        uint32_t nireq = 0;
+        size_t batch = 0;
+        uint32_t nthreads = 0;
+    };
+
+    /// @brief Measured performance of one sweep point with the effective values of its parameters
+    struct SweepResult {
+        std::string nstreams;
+        uint32_t nireq = 0;
+        size_t batch = 0;
+        std::string nthreads;
+        size_t iterations = 0;
+        double duration = 0.0;
+        double throughput = 0.0;
+        double latency_p50 = 0.0;
+        double latency_p90 = 0.0;
+        double latency_p99 = 0.0;
+        bool pareto = false;
+    };
+
+    /// @brief Parses comma separated list of non-negative integers like "1,2,4"
+    std::vector<uint32_t> parseSweepValues(const std::string& values_string);
+
+    /// @brief Builds cartesian product of the lists, an empty list means the device default only
+    std::vector<SweepConfig> makeSweepGrid(const std::vector<uint32_t>& nstreams,
+                                           const std::vector<uint32_t>& nireq,
+                                           const std::vector<uint32_t>& batch,
+                                           const std::vector<uint32_t>& nthreads);
+
+    /// @brief Runs inference with all requests of the network in flight for the given time and measures it
+    SweepResult measureSweepPoint(InferenceEngine::ExecutableNetwork& exeNetwork,
+                                  uint32_t nireq,
+                                  size_t batchSize,
+                                  const std::vector<std::string>& inputFiles,
+                                  InputsInfo& app_inputs_info,
+                                  uint64_t duration_nanoseconds);
+
+    /// @brief Marks results which are not dominated by another result in throughput and p50/p90/p99 latencies
+    void markParetoOptimal(std::vector<SweepResult>& results);
+
+    /// @brief Returns index of the result with the best throughput among ones meeting the p99 latency SLO
+    ///        or index of the result with the lowest p99 latency if no one meets it
+    size_t recommendForLatencySLO(const std::vector<SweepResult>& results, double latency_slo);
+}  // namespace benchmark_app
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <map>
@@ -33,6 +35,16 @@ std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& sha
 size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string &s, char delim);
 
+template <typename T>
+T getPercentileValue(std::vector<T> values, double percent) {
+    // nearest-rank method, so the value is always one of the measured ones
+    if (values.empty())
+        return T();
+    std::sort(values.begin(), values.end());
+    auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * values.size()));
+    return values[std::min(std::max(rank, static_cast<size_t>(1)), values.size()) - 1];
+}
+
 template <typename T>
 std::map<std::string, std::string> parseInputParameters(const std::string parameter_string,
                                                         const std::map<std::string, T>& input_info) {
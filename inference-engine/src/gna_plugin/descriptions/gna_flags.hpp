@@ -18,5 +18,6 @@ struct GNAFlags {
     bool sw_fp32 = false;
     bool fake_quantized = false;
     bool performance_counting = false;
+    bool state_per_request = false;
 };
 }  // namespace GNAPluginNS
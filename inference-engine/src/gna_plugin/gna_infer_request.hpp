@@ -7,6 +7,8 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <future>
+#include <chrono>
 
 #include "cpp_interfaces/impl/ie_infer_async_request_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
@@ -18,6 +20,67 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
  protected:
     std::shared_ptr<GNAPlugin> plg;
     uint32_t inferRequestIdx = -1;
+    // memory states of this request, nullptr if the request uses states of the model
+    std::shared_ptr<memory::GNAStateSet> states;
+    // result of the last scoring with own memory states, false if it was aborted by QoS
+    std::shared_future<bool> statesTask;
+
+    bool IsStatesTaskBusy() const {
+        return statesTask.valid() && statesTask.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready;
+    }
+
+    /**
+     * @brief Scores the request with own memory states on the plugin executor. Restoring, scoring and saving
+     * of states are done by the task, so the caller doesn't wait for streams scored before this one.
+     */
+    void StartAsyncWithStates() {
+        auto promise = std::make_shared<std::promise<bool>>();
+        statesTask = promise->get_future().share();
+        plg->GetStateSetsExecutor()->run([this, promise] {
+            auto status = InferenceEngine::OK;
+            std::exception_ptr exception;
+            bool completed = false;
+            try {
+                execDataPreprocessing(_inputs);
+                completed = plg->Infer(_inputs, _outputs, *states);
+                status = completed ? InferenceEngine::OK : InferenceEngine::INFER_NOT_STARTED;
+            } catch (...) {
+                exception = std::current_exception();
+                status = InferenceEngine::GENERAL_ERROR;
+            }
+            // the same as for the default asynchronous pipeline, the callback is called before the request is ready
+            if (_callback) {
+                auto infer_request = _publicInterface.lock();
+                IE_ASSERT(infer_request != nullptr);
+                try {
+                    _callback(infer_request, status);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+            }
+            if (exception) {
+                promise->set_exception(exception);
+            } else {
+                promise->set_value(completed);
+            }
+        });
+    }
+
+    InferenceEngine::StatusCode WaitWithStates(int64_t millis_timeout) {
+        if (!statesTask.valid()) {
+            return InferenceEngine::INFER_NOT_STARTED;
+        } else if (millis_timeout < -1) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str;
+        }
+
+        if (millis_timeout == InferenceEngine::IInferRequest::WaitMode::RESULT_READY) {
+            statesTask.wait();
+        } else if (statesTask.wait_for(std::chrono::milliseconds(millis_timeout)) != std::future_status::ready) {
+            return InferenceEngine::RESULT_NOT_READY;
+        }
+        // rethrows the scoring error, if any
+        return statesTask.get() ? InferenceEngine::OK : InferenceEngine::INFER_NOT_STARTED;
+    }
 
  public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
@@ -39,12 +102,32 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
             _inputs[input.first] =
                 plg->GetInputBlob(input.first, input.second->getTensorDesc().getPrecision());
         }
+
+        states = plg->CreateStateSet();
+    }
+
+    ~GNAInferRequest() {
+        // the scoring task refers to blobs and states of this request
+        if (statesTask.valid()) {
+            statesTask.wait();
+        }
     }
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of IInferRequest while request is ongoing (running or waiting in queue)
      */
     void InferImpl() override {
+        if (states) {
+            if (IsStatesTaskBusy()) {
+                THROW_IE_EXCEPTION_WITH_STATUS(REQUEST_BUSY);
+            }
+            execDataPreprocessing(_inputs);
+            std::promise<bool> result;
+            result.set_value(plg->Infer(_inputs, _outputs, *states));
+            statesTask = result.get_future().share();
+            return;
+        }
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
         // result returned from sync infer wait method
@@ -73,6 +156,13 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
      */
     void StartAsyncImpl() override {
+        if (states) {
+            if (IsStatesTaskBusy()) {
+                THROW_IE_EXCEPTION_WITH_STATUS(REQUEST_BUSY);
+            }
+            StartAsyncWithStates();
+            return;
+        }
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
         inferRequestIdx = plg->QueueInference(_inputs, _outputs);
@@ -87,6 +177,9 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
 
 
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override {
+        if (states) {
+            return WaitWithStates(millis_timeout);
+        }
         if (inferRequestIdx == -1) {
             return InferenceEngine::INFER_NOT_STARTED;
         } else if (millis_timeout < -1) {
@@ -112,6 +205,9 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
 
     IE_SUPPRESS_DEPRECATED_START
     std::vector<InferenceEngine::IVariableStateInternal::Ptr>  QueryState() override {
+        if (states) {
+            return states->QueryState();
+        }
         auto pluginStates = plg->QueryState();
         std::vector<InferenceEngine::IVariableStateInternal::Ptr> state(pluginStates.begin(), pluginStates.end());
         return plg->QueryState();
@@ -20,6 +20,7 @@
 
 #include <legacy/graph_tools.hpp>
 #include <cpp_interfaces/exception2status.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 #include <legacy/net_pass.h>
 #include <debug.h>
 #include <gna/gna_config.hpp>
@@ -1369,6 +1370,19 @@ bool GNAPlugin::Infer(const InferenceEngine::BlobMap &input, InferenceEngine::Bl
     return  Wait(QueueInference(input, result));
 }
 
+bool GNAPlugin::Infer(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result, memory::GNAStateSet &states) {
+    std::lock_guard<std::mutex> lock(stateSetsMutex);
+    states.Restore();
+    // the stream keeps states updated by scoring even if it fails, the model memory is taken by the next stream
+    struct SaveStatesGuard {
+        memory::GNAStateSet& states;
+        ~SaveStatesGuard() {
+            states.Save();
+        }
+    } saveStatesGuard{states};
+    return Infer(input, result);
+}
+
 static InferenceEngine::Layout GetLayoutForDims(const InferenceEngine::SizeVector &dims) {
     switch (dims.size()) {
     case 1: return C;
@@ -1410,6 +1424,21 @@ std::vector<InferenceEngine::VariableStateInternal::Ptr>  GNAPlugin::QueryState(
     return memoryStates;
 }
 
+std::shared_ptr<memory::GNAStateSet> GNAPlugin::CreateStateSet() {
+    if (!gnaFlags->state_per_request || graphCompiler.memory_connection.empty()) {
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stateSetsMutex);
+        if (!stateSetsExecutor) {
+            // the model memory holds states of one stream at a time, so a single stream is enough
+            stateSetsExecutor = std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+                InferenceEngine::IStreamsExecutor::Config{"GNAStateSetsExecutor"});
+        }
+    }
+    return std::make_shared<memory::GNAStateSet>(graphCompiler.memory_connection);
+}
+
 std::string GNAPlugin::GetName() const noexcept {
     return _pluginName;
 }
@@ -12,8 +12,10 @@
 #include <memory>
 #include <vector>
 #include <tuple>
+#include <mutex>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include "cpp_interfaces/impl/ie_variable_state_internal.hpp"
+#include <threading/ie_itask_executor.hpp>
 #include "descriptions/gna_flags.hpp"
 #include "descriptions/gna_input_desc.hpp"
 #include "descriptions/gna_output_desc.hpp"
@@ -23,6 +25,7 @@
 #include "gna_plugin_policy.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_plugin_config.hpp"
+#include "memory/gna_state_set.hpp"
 #include <legacy/ie_util_internal.hpp>
 
 #if GNA_LIB_VER == 2
@@ -86,6 +89,14 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     InferenceEngine::OutputsDataMap outputsDataMap;
     std::vector<InferenceEngine::VariableStateInternal::Ptr> memoryStates;
     bool trivialTopology = false;
+    /**
+     * @brief serializes scoring of requests which bring their own memory states into the shared model memory
+     */
+    std::mutex stateSetsMutex;
+    /**
+     * @brief runs asynchronous scoring of requests with own memory states, created with the first such request
+     */
+    InferenceEngine::ITaskExecutor::Ptr stateSetsExecutor;
 
  public:
     explicit GNAPlugin(const std::map<std::string, std::string>& configMap);
@@ -110,6 +121,10 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
                                   const std::map<std::string, std::string> &config_map,
                                   InferenceEngine::RemoteContext::Ptr context) override { THROW_GNA_EXCEPTION << "Not implemented"; }
     bool Infer(const InferenceEngine::Blob &input, InferenceEngine::Blob &result);
+    /**
+     * @brief Scores the input with the given memory states swapped into the model, updated states are saved back
+     */
+    bool Infer(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result, memory::GNAStateSet &states);
     void SetCore(InferenceEngine::ICore*) noexcept override {}
     InferenceEngine::ICore* GetCore() const noexcept override {return nullptr;}
     void Reset();
@@ -163,6 +178,17 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      */
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr>  QueryState();
+    /**
+     * @brief Creates memory states of a separate stream if the model has states and they are kept per request
+     * @return nullptr if requests share the model states
+     */
+    std::shared_ptr<memory::GNAStateSet> CreateStateSet();
+    /**
+     * @brief Executor of asynchronous requests with own memory states, valid once such a request is created
+     */
+    InferenceEngine::ITaskExecutor::Ptr GetStateSetsExecutor() const {
+        return stateSetsExecutor;
+    }
 
      /**
       * test-wise API
@@ -210,6 +210,15 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                 log << "EXCLUSIVE_ASYNC_REQUESTS should be YES/NO, but not" << value;
                 THROW_GNA_EXCEPTION << "EXCLUSIVE_ASYNC_REQUESTS should be YES/NO, but not" << value;
             }
+        } else if (key == GNA_CONFIG_KEY(STATE_PER_REQUEST)) {
+            if (value == PluginConfigParams::YES) {
+                gnaFlags.state_per_request = true;
+            } else if (value == PluginConfigParams::NO) {
+                gnaFlags.state_per_request = false;
+            } else {
+                log << "GNA state per request should be YES/NO, but not " << value;
+                THROW_GNA_EXCEPTION << "GNA state per request should be YES/NO, but not " << value;
+            }
         } else {
             THROW_GNA_EXCEPTION << as_status << NOT_FOUND << "Incorrect GNA Plugin config. Key " << item.first
                                 << " not supported";
@@ -276,6 +285,8 @@ void Config::AdjustKeyMapValues() {
     keyConfigMap[GNA_CONFIG_KEY(LIB_N_THREADS)] = std::to_string(gnaFlags.gna_lib_async_threads_num);
     keyConfigMap[CONFIG_KEY(SINGLE_THREAD)] =
             gnaFlags.gna_openmp_multithreading ? PluginConfigParams::NO: PluginConfigParams::YES;
+    keyConfigMap[GNA_CONFIG_KEY(STATE_PER_REQUEST)] =
+            gnaFlags.state_per_request ? PluginConfigParams::YES: PluginConfigParams::NO;
 }
 
 std::string Config::GetParameter(const std::string& name) const {
@@ -117,7 +117,7 @@ namespace memory {
                 InferenceEngine::SizeVector({ 1, elements }),
                 InferenceEngine::NC));
             result_blob->allocate();
-            std::memcpy(state->gna_ptr, result_blob->buffer(), state->reserved_size);
+            std::memcpy(result_blob->buffer(), state->gna_ptr, state->reserved_size);
 
             return result_blob;
         }
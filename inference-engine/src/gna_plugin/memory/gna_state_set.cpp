@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gna_state_set.hpp"
+
+#include <cstring>
+#include "gna_memory_state.hpp"
+
+namespace GNAPluginNS {
+namespace memory {
+
+GNAStateSet::GNAStateSet(const MemoryConnection& connections) {
+    slots.reserve(connections.size());
+    for (auto&& connection : connections) {
+        const auto& modelLayer = connection.second;
+        if (modelLayer.gna_ptr == nullptr) {
+            THROW_GNA_EXCEPTION << "Memory layer " << connection.first << " is not allocated";
+        }
+        // new stream starts from zero states, the same as after Reset()
+        slots.push_back({modelLayer.gna_ptr, modelLayer.reserved_size, std::vector<uint8_t>(modelLayer.reserved_size, 0)});
+
+        // the layer copy keeps quantization info of the model one but points to the stream storage
+        auto streamLayer = std::make_shared<GNAMemoryLayer>(modelLayer);
+        streamLayer->gna_ptr = slots.back().storage.data();
+        states.push_back(std::make_shared<GNAVariableState>(connection.first, streamLayer));
+    }
+}
+
+void GNAStateSet::Restore() const {
+    for (auto&& slot : slots) {
+        std::memcpy(slot.modelPtr, slot.storage.data(), slot.size);
+    }
+}
+
+void GNAStateSet::Save() {
+    for (auto&& slot : slots) {
+        std::memcpy(slot.storage.data(), slot.modelPtr, slot.size);
+    }
+}
+
+}  // namespace memory
+}  // namespace GNAPluginNS
@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cpp_interfaces/impl/ie_variable_state_internal.hpp>
+#include "gna_data_types.hpp"
+
+namespace GNAPluginNS {
+namespace memory {
+/**
+ * @brief Set of memory states of one stream scored by a shared model.
+ * Every memory layer of the model gets its own storage here, states returned by QueryState() read and write
+ * that storage, so they can be used while the model is busy with other streams.
+ */
+class GNAStateSet {
+ public:
+    explicit GNAStateSet(const MemoryConnection& connections);
+
+    /**
+     * @brief Copies the stream states into memory layers of the model before scoring
+     */
+    void Restore() const;
+    /**
+     * @brief Copies memory layers of the model into the stream states after scoring
+     */
+    void Save();
+
+    std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() const {
+        return states;
+    }
+
+ private:
+    struct Slot {
+        void* modelPtr;
+        size_t size;
+        std::vector<uint8_t> storage;
+    };
+
+    std::vector<Slot> slots;
+    std::vector<InferenceEngine::IVariableStateInternal::Ptr> states;
+};
+}  // namespace memory
+}  // namespace GNAPluginNS
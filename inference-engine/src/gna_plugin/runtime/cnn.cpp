@@ -6,13 +6,14 @@
 #include <cstdint>
 #include <cstdio>
 #include <gna_plugin_log.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
 
-
 void CNNFilter32(intel_dnn_component_t *component) {
     float *ptr_filters = reinterpret_cast<float *>(component->op.conv1D.ptr_filters);
     float *ptr_biases = reinterpret_cast<float *>(component->op.conv1D.ptr_biases);
@@ -32,17 +33,14 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    InferenceEngine::parallel_for(num_filter_outputs, [&](uint32_t j) {
+        const float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            const float *ptr_coef = ptr_filters + i * num_filter_coefficients;
+            ptr_outputs[j * num_filters + i] = ptr_biases[i] + DotProduct32(ptr_in, ptr_coef, num_filter_coefficients);
         }
-    }
+    });
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -102,7 +100,8 @@ void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number
         uint32_t num_pool_step = component->op.maxpool.num_inputs_step;
         uint32_t num_rows_in = num_inputs / component->op.maxpool.num_inputs_stride;
 
-        for (uint32_t i = 0; i < num_columns; i++) {
+        // columns are pooled independently
+        InferenceEngine::parallel_for(num_columns, [&](uint32_t i) {
             int32_t m = 0;
             if (component->op.maxpool.do_sum_not_max) {
                 for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
@@ -125,7 +124,7 @@ void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number
                     m++;
                 }
             }
-        }
+        });
     }
 }
 
@@ -161,21 +160,17 @@ float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsign
     const auto zPW = zeroPadding[1];
     float output = 0;
     for (unsigned kh = 0; kh < KH; kh++) {
+        if (matchesPaddedArea(kh, oh, IH, zPH, cSH)) {
+            continue;
+        }
+        const auto ih = (cSH * oh + kh) - zPH;
         for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
+            if (matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
+                continue;
             }
+            const auto iw = (cSW * ow + kw) - zPW;
+            // channels are innermost both in the image and in the filter
+            output += DotProduct32(image + getQubeIndex(ih, iw, 0u, IW, IC), filter + getQubeIndex(kh, kw, 0u, KW, KC), KC);
         }
     }
     output += bias;
@@ -210,21 +205,19 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
-            }
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    InferenceEngine::parallel_for2d(OC, OW, [&](unsigned oc, unsigned ow) {
+        const auto kernelIndex = oc * kernelStride;
+        for (unsigned oh = 0; oh < OH; oh++) {
+            const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
+            ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
+                ptr_inputs, IH, IW, IC,
+                oh, ow, oc,
+                component->op.conv2D.convStride,
+                component->op.conv2D.zeroPadding);
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
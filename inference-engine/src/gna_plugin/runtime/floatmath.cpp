@@ -1,14 +1,75 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software FP32 runtime
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
+
+#include <ie_parallel.hpp>
 
 #include "floatmath.h"
 
+namespace {
+
+// matrices smaller than this number of multiply-adds are not worth distributing between threads
+constexpr size_t kParallelWorkThreshold = 1 << 15;
+// number of rows of A whose dot products with the same packed column of B are computed together
+constexpr int kRowBlock = 4;
+
+// runs func(i) for every i in [0, n), in parallel only if the whole job is big enough
+template <typename F>
+void for_each_row(int n, size_t work_per_row, const F &func) {
+    if (static_cast<size_t>(n) * work_per_row < kParallelWorkThreshold) {
+        for (int i = 0; i < n; i++) {
+            func(i);
+        }
+    } else {
+        InferenceEngine::parallel_for(n, func);
+    }
+}
+
+// copies columns of B (KxN, row major) into rows of Bt (NxK), so both operands of dot products are contiguous
+const float *pack_columns(const float *B, int K, int N, int ldb, std::vector<float> &buffer) {
+    buffer.resize(static_cast<size_t>(K) * N);
+    for (int k = 0; k < K; k++) {
+        for (int j = 0; j < N; j++) {
+            buffer[static_cast<size_t>(j) * K + k] = B[static_cast<size_t>(k) * ldb + j];
+        }
+    }
+    return buffer.data();
+}
+
+// C[rows[r], :] = beta_c * C[rows[r], :] + alpha * A[a_rows[r], :] * Bt^T, where rows of A and Bt are contiguous
+template <typename RowMap>
+void gemm_packed(int num_rows, int N, int K, float alpha, const float *A, int lda, const float *Bt,
+                 bool accumulate, float beta, float *C, int ldc, const RowMap &a_row) {
+    const int num_blocks = (num_rows + kRowBlock - 1) / kRowBlock;
+    for_each_row(num_blocks, static_cast<size_t>(kRowBlock) * N * K, [&](int block) {
+        const int r_start = block * kRowBlock;
+        const int r_end = std::min(r_start + kRowBlock, num_rows);
+        // rows of a block reuse the same column of Bt while it is hot in L1
+        for (int j = 0; j < N; j++) {
+            const float *b = Bt + static_cast<size_t>(j) * K;
+            for (int r = r_start; r < r_end; r++) {
+                float &c = C[static_cast<size_t>(r) * ldc + j];
+                const float sum = alpha * DotProduct32(A + static_cast<size_t>(a_row(r)) * lda, b, static_cast<uint32_t>(K));
+                c = accumulate ? beta * c + sum : sum;
+            }
+        }
+    });
+}
+
+std::vector<float> &packing_buffer() {
+    static thread_local std::vector<float> buffer;
+    return buffer;
+}
+
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
@@ -19,44 +80,23 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
         throw -1;
     }
 
+    auto identity = [](int i) { return i; };
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        // alpha is ignored and beta only selects accumulation, as the reference implementation did
+        const float *Bt = pack_columns(B, K, N, ldb, packing_buffer());
+        gemm_packed(M, N, K, 1.0f, A, lda, Bt, beta == 1.0, 1.0f, C, ldc, identity);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        gemm_packed(M, N, K, alpha, A, lda, B, true, beta, C, ldc, identity);
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        std::vector<float> At;
+        const float *Ap = pack_columns(A, K, M, lda, At);
+        const float *Bt = pack_columns(B, K, N, ldb, packing_buffer());
+        gemm_packed(M, N, K, 1.0f, Ap, K, Bt, beta == 1.0, 1.0f, C, ldc, identity);
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -97,47 +137,29 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L) {
-    int i, j, k, l;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm_subset!\n");
         throw -1;
     }
 
+    auto listed = [OutputList](int l) { return static_cast<int>(OutputList[l]); };
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        const float *Bt = pack_columns(B, K, N, ldb, packing_buffer());
+        gemm_packed(L, N, K, 1.0f, A, lda, Bt, beta == 1.0, 1.0f, C, ldc, listed);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
-                float sum;
-                j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
+        // here the list selects columns of the output, so rows of A are iterated directly
+        for_each_row(M, static_cast<size_t>(L) * K, [&](int i) {
+            const float *a = A + static_cast<size_t>(i) * lda;
+            for (int l = 0; l < L; l++) {
+                float &c = C[static_cast<size_t>(i) * ldc + l];
+                c = beta * c + alpha * DotProduct32(a, B + static_cast<size_t>(OutputList[l]) * ldb, static_cast<uint32_t>(K));
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        std::vector<float> At;
+        const float *Ap = pack_columns(A, K, M, lda, At);
+        const float *Bt = pack_columns(B, K, N, ldb, packing_buffer());
+        gemm_packed(L, N, K, 1.0f, Ap, K, Bt, beta == 1.0, 1.0f, C, ldc, listed);
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm_subset!\n");
         throw -1;
@@ -153,20 +175,12 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    const uint32_t num_columns = K1 + K2;
+
+    for_each_row(static_cast<int>(N), num_columns, [&](int i) {
+        const float *x = X + static_cast<size_t>(i) * num_columns;
+        C[i] = B[i] + DotProduct32(A1, x, K1) + DotProduct32(A2, x + K1, K2);
+    });
 }
 
 #ifdef __cplusplus
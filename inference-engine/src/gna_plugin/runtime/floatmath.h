@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstdlib>
 #include <cstdio>
 
@@ -62,3 +63,25 @@ void sgemv_split(const uint32_t N,
 #ifdef __cplusplus
 }
 #endif
+
+#ifdef __cplusplus
+// dot product with independent partial sums, so the compiler is able to vectorize it without reassociation
+inline float DotProduct32(const float *a, const float *b, uint32_t n) {
+    constexpr uint32_t lanes = 8;
+    float acc[lanes] = {};
+    uint32_t k = 0;
+    for (; k + lanes <= n; k += lanes) {
+        for (uint32_t l = 0; l < lanes; l++) {
+            acc[l] += a[k + l] * b[k + l];
+        }
+    }
+    float sum = 0.0f;
+    for (uint32_t l = 0; l < lanes; l++) {
+        sum += acc[l];
+    }
+    for (; k < n; k++) {
+        sum += a[k] * b[k];
+    }
+    return sum;
+}
+#endif
@@ -15,11 +15,13 @@
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/runtime/parallel.hpp>
 
 #include <cpp_interfaces/exception2status.hpp>
 #include "ie_plugin_cpp.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
 #include "xml_parse_utils.h"
@@ -529,6 +531,20 @@ Core::Impl::Impl() {
     opsetNames.insert("opset2");
     opsetNames.insert("opset3");
     opsetNames.insert("opset4");
+
+    // nGraph passes run by the Core and by plugins share the threading runtime of Inference Engine
+    static std::once_flag ngraphParallelBackendFlag;
+    std::call_once(ngraphParallelBackendFlag, [] {
+        ngraph::runtime::parallel_set_backend(
+            [](size_t nthr, const std::function<void(size_t, size_t)>& func) {
+                parallel_nt(static_cast<int>(nthr), [&](int ithr, int nthr) {
+                    func(static_cast<size_t>(ithr), static_cast<size_t>(nthr));
+                });
+            },
+            [] {
+                return static_cast<size_t>(parallel_get_max_threads());
+            });
+    });
 }
 
 Core::Impl::~Impl() {}
@@ -126,6 +126,11 @@ void registerReaders() {
     if (irReaderv7)
         readers.emplace("xml", irReaderv7);
 
+    // try to load binary IR reader if library exists
+    auto irBinReader = create_if_exists("IRBin", std::string("inference_engine_ir_bin_reader") + std::string(IE_BUILD_POSTFIX));
+    if (irBinReader)
+        readers.emplace("irb", irBinReader);
+
     initialized = true;
 }
 
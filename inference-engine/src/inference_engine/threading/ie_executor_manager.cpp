@@ -43,6 +43,14 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+SharedStreamsPool::Ptr ExecutorManagerImpl::getSharedStreamsPool(const IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    auto& pool = sharedStreamsPools[config._name];
+    if (nullptr == pool)
+        pool = std::make_shared<SharedStreamsPool>(config);
+    return pool;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -53,14 +61,28 @@ size_t ExecutorManagerImpl::getIdleCPUStreamsExecutorsNumber() {
     return cpuStreamsExecutors.size();
 }
 
+size_t ExecutorManagerImpl::getStreamsThreadsNumber() {
+    std::lock_guard<std::mutex> stream_guard(streamExecutorMutex);
+    std::lock_guard<std::mutex> task_guard(taskExecutorMutex);
+    // executors created by id have the default single stream config
+    size_t threadsNumber = executors.size();
+    for (const auto& it : cpuStreamsExecutors)
+        threadsNumber += it.first._streams;
+    for (const auto& it : sharedStreamsPools)
+        threadsNumber += it.second->GetConfig()._streams;
+    return threadsNumber;
+}
+
 void ExecutorManagerImpl::clear(const std::string& id) {
     std::lock_guard<std::mutex> stream_guard(streamExecutorMutex);
     std::lock_guard<std::mutex> task_guard(taskExecutorMutex);
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedStreamsPools.clear();
     } else {
         executors.erase(id);
+        sharedStreamsPools.erase(id);
         cpuStreamsExecutors.erase(
             std::remove_if(cpuStreamsExecutors.begin(), cpuStreamsExecutors.end(),
                            [&](const std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>& it) {
@@ -123,6 +145,10 @@ size_t ExecutorManager::getIdleCPUStreamsExecutorsNumber() {
     return _impl.getIdleCPUStreamsExecutorsNumber();
 }
 
+size_t ExecutorManager::getStreamsThreadsNumber() {
+    return _impl.getStreamsThreadsNumber();
+}
+
 void ExecutorManager::clear(const std::string& id) {
     _impl.clear(id);
 }
@@ -131,4 +157,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+SharedStreamsPool::Ptr ExecutorManager::getSharedStreamsPool(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedStreamsPool(config);
+}
+
 }  // namespace InferenceEngine
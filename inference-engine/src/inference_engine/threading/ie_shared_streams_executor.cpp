@@ -0,0 +1,199 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "details/ie_exception.hpp"
+#include "threading/ie_cpu_streams_executor.hpp"
+#include "threading/ie_shared_streams_executor.hpp"
+
+namespace InferenceEngine {
+
+using Clock = std::chrono::steady_clock;
+
+struct SharedStreamsPool::Client {
+    explicit Client(const SharedStreamsExecutor::ClientConfig& config) :
+        _config{config},
+        _busySlots(config._quota, false) {
+    }
+
+    SharedStreamsExecutor::ClientConfig             _config;
+    std::queue<std::pair<Task, Clock::time_point>>  _taskQueue;
+    std::vector<bool>                               _busySlots;
+    double                                          _virtualTime = 0.0;
+    SharedStreamsExecutor::Statistics               _statistics;
+};
+
+namespace {
+// the client and its slot of the task running in the current thread
+struct CurrentTask {
+    const void*                         _client;
+    int                                 _slot;
+};
+thread_local CurrentTask currentTask = {nullptr, 0};
+}  // namespace
+
+struct SharedStreamsPool::Impl {
+    explicit Impl(const IStreamsExecutor::Config& config) :
+        _config{config},
+        _streamsExecutor{config} {
+    }
+
+    void Register(Client* client) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        client->_virtualTime = _virtualTime;
+        _clients.push_back(client);
+    }
+
+    void Unregister(Client* client) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _clientCondVar.wait(lock, [&] {
+            return client->_taskQueue.empty() && 0 == client->_statistics._running;
+        });
+        _clients.remove(client);
+    }
+
+    void Enqueue(Client* client, Task task) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            // idle client doesn't accumulate credit of the time it had nothing to run
+            if (client->_taskQueue.empty() && 0 == client->_statistics._running)
+                client->_virtualTime = std::max(client->_virtualTime, _virtualTime);
+            client->_taskQueue.emplace(std::move(task), Clock::now());
+            client->_statistics._queued++;
+        }
+        // every queued task is followed by a dispatch, which runs the task of the most underserved client
+        _streamsExecutor.run([this] {
+            Dispatch();
+        });
+    }
+
+    Client* SelectNext() {
+        Client* next = nullptr;
+        for (auto&& client : _clients) {
+            if (client->_taskQueue.empty() ||
+                client->_statistics._running >= static_cast<uint64_t>(client->_config._quota))
+                continue;
+            if (nullptr == next || client->_virtualTime < next->_virtualTime)
+                next = client;
+        }
+        return next;
+    }
+
+    void Dispatch() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;) {
+            auto client = SelectNext();
+            if (nullptr == client) {
+                // all clients with queued tasks use their quota, a stream finishing their task takes the dispatch
+                _pendingDispatches++;
+                return;
+            }
+            auto task = std::move(client->_taskQueue.front().first);
+            auto queueingTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - client->_taskQueue.front().second).count();
+            client->_taskQueue.pop();
+            auto slot = static_cast<int>(std::distance(client->_busySlots.begin(),
+                std::find(client->_busySlots.begin(), client->_busySlots.end(), false)));
+            client->_busySlots[slot] = true;
+            auto& statistics = client->_statistics;
+            statistics._queued--;
+            statistics._running++;
+            statistics._tasks++;
+            statistics._queueingTime += queueingTime;
+            statistics._maxQueueingTime = std::max<uint64_t>(statistics._maxQueueingTime, queueingTime);
+            _virtualTime = client->_virtualTime;
+            lock.unlock();
+
+            auto start = Clock::now();
+            auto previousTask = currentTask;
+            currentTask = {client, slot};
+            // As for CPUStreamsExecutor, a task has to deliver its exceptions itself (see ITaskExecutor), e.g. via
+            // std::promise. An escaped exception is dropped here to release the slot and keep dispatching.
+            try {
+                task();
+            } catch(...) {}
+            currentTask = previousTask;
+            auto executionTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+            lock.lock();
+            client->_busySlots[slot] = false;
+            statistics._running--;
+            statistics._executionTime += executionTime;
+            client->_virtualTime += static_cast<double>(executionTime) / client->_config._weight;
+            _clientCondVar.notify_all();
+            if (0 == _pendingDispatches)
+                return;
+            _pendingDispatches--;
+        }
+    }
+
+    IStreamsExecutor::Config    _config;
+    std::mutex                  _mutex;
+    std::condition_variable     _clientCondVar;
+    std::list<Client*>          _clients;
+    double                      _virtualTime = 0.0;
+    size_t                      _pendingDispatches = 0;
+    // NOTE: should be the last member, so its threads finish dispatches before other members are destroyed
+    CPUStreamsExecutor          _streamsExecutor;
+};
+
+SharedStreamsPool::SharedStreamsPool(const IStreamsExecutor::Config& config) :
+    _impl{new Impl{config}} {
+}
+
+SharedStreamsPool::~SharedStreamsPool() = default;
+
+const IStreamsExecutor::Config& SharedStreamsPool::GetConfig() const {
+    return _impl->_config;
+}
+
+SharedStreamsExecutor::SharedStreamsExecutor(const SharedStreamsPool::Ptr& pool, const ClientConfig& config) :
+    _pool{pool} {
+    if (nullptr == _pool)
+        THROW_IE_EXCEPTION << "Shared streams pool is not set for " << config._name;
+    if (0 == config._weight)
+        THROW_IE_EXCEPTION << "Weight of " << config._name << " in shared streams pool should be positive";
+    if (config._quota <= 0)
+        THROW_IE_EXCEPTION << "Quota of " << config._name << " in shared streams pool should be positive";
+    _client.reset(new SharedStreamsPool::Client{config});
+    _pool->_impl->Register(_client.get());
+}
+
+SharedStreamsExecutor::~SharedStreamsExecutor() {
+    _pool->_impl->Unregister(_client.get());
+}
+
+void SharedStreamsExecutor::run(Task task) {
+    _pool->_impl->Enqueue(_client.get(), std::move(task));
+}
+
+void SharedStreamsExecutor::Execute(Task task) {
+    _pool->_impl->_streamsExecutor.Execute(std::move(task));
+}
+
+int SharedStreamsExecutor::GetStreamId() {
+    // threads out of the pool, e.g. the main thread, share the first slot
+    return currentTask._client == _client.get() ? currentTask._slot : 0;
+}
+
+int SharedStreamsExecutor::GetNumaNodeId() {
+    return _pool->_impl->_streamsExecutor.GetNumaNodeId();
+}
+
+SharedStreamsExecutor::Statistics SharedStreamsExecutor::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(_pool->_impl->_mutex);
+    return _client->_statistics;
+}
+
+}  // namespace InferenceEngine
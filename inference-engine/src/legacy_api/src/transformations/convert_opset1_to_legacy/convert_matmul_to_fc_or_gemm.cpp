@@ -95,6 +95,27 @@ ngraph::pass::ConvertMatMulToFC::ConvertMatMulToFC() {
             return transpose;
         };
 
+        /*
+         *  is_compressed_weights function checks that weights are kept in low precision and decompressed
+         *  by Convert and per output channel Subtract/Add/Multiply operations with Constants. Such weights
+         *  are not folded (see DisableCompressedWeightsConstantFolding) so plugin can decompress them on the fly.
+         */
+
+        auto is_compressed_weights = [](Output<Node> weights) -> bool {
+            auto node = weights.get_node_shared_ptr();
+            while (std::dynamic_pointer_cast<opset1::Subtract>(node) ||
+                   std::dynamic_pointer_cast<opset1::Add>(node) ||
+                   std::dynamic_pointer_cast<opset1::Multiply>(node)) {
+                if (!std::dynamic_pointer_cast<opset1::Constant>(node->get_input_node_shared_ptr(1))) {
+                    return false;
+                }
+                node = node->get_input_node_shared_ptr(0);
+            }
+            return std::dynamic_pointer_cast<opset1::Convert>(node) &&
+                   std::dynamic_pointer_cast<opset1::Constant>(node->get_input_node_shared_ptr(0)) &&
+                   node->get_rt_info().count("DISABLED_CONSTANT_FOLDING");
+        };
+
         // fc_input_a and fc_input_b - are the final inputs that will be set to FullyConnected of GemmIE operations.
         // So in case of adding new operations that takes matmul inputs we need keep update fc_input_a and
         // fc_input_b updated.
@@ -103,11 +124,12 @@ ngraph::pass::ConvertMatMulToFC::ConvertMatMulToFC() {
         // vector of new nGraph operations
         NodeVector new_ops;
 
-        // Check that if second inputs is Constant operation and it's shape without ones dimensions has length <= 2
-        // we replace MatMul with FullyConnected operation.
+        // Check that if second inputs is Constant operation (or compressed constant weights) and it's shape
+        // without ones dimensions has length <= 2 we replace MatMul with FullyConnected operation.
         // Otherwise we replace MatMul with Gemm.
         if ((std::dynamic_pointer_cast<opset1::Constant>    (fc_input_b.get_node_shared_ptr())  ||
-             std::dynamic_pointer_cast<opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr())) &&
+             std::dynamic_pointer_cast<opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr()) ||
+             is_compressed_weights(fc_input_b)) &&
             std::count_if(shape_b.begin(), shape_b.end(), [](size_t x) {
                 return x != 1;
             }) <= 2) {
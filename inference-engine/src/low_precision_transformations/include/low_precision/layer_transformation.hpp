@@ -12,6 +12,7 @@
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 
 #include "iparams_manager.hpp"
 #include "ilayer_transformations_manager.hpp"
@@ -348,10 +349,7 @@ protected:
     void addSingleNodePattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context) const {
         using namespace ngraph;
 
-        auto is_op_type = [](std::shared_ptr<Node> n) {
-            return !!as_type_ptr<Operation>(n);
-        };
-        auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
+        auto p_node = std::make_shared<pattern::op::WrapType>(Operation::type_info);
 
         addPattern(pass, context, p_node);
     }
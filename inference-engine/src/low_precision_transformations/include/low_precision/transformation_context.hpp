@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <ngraph/ngraph.hpp>
 #include "low_precision/quantization_details.hpp"
@@ -13,6 +15,8 @@ namespace ngraph {
 namespace pass {
 namespace low_precision {
 
+class LayerTransformation;
+
 class TRANSFORMATIONS_API TransformationContext {
 public:
     explicit TransformationContext(std::shared_ptr<Function> function);
@@ -28,6 +32,15 @@ public:
     // To avoid FakeQuantize operation double handling by FakeQuantizeTransformation after ConcatTransformation, FakeQuantizeTransformation
     // has to use this member.
     std::unordered_set<std::string> quantizedFakeQuantizeNames;
+
+    // Execution statistics of transformations which handled matched operations.
+    // Collected only if pass profiling is enabled (see ngraph::pass::PassProfiler).
+    struct TransformationStatistics {
+        std::chrono::nanoseconds time{0};
+        size_t matches = 0;
+        size_t rewrites = 0;
+    };
+    std::unordered_map<const LayerTransformation*, TransformationStatistics> statistics;
 };
 
 } // namespace low_precision
@@ -4,9 +4,10 @@
 
 #include <low_precision/layer_transformation.hpp>
 #include <low_precision/network_helper.hpp>
-
+#include <ngraph/pass/pass_profiler.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <map>
@@ -449,8 +450,25 @@ void LayerTransformation::updateOutput(
 
 void LayerTransformation::addPattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context, std::shared_ptr<Node> patternRoot) const {
     ngraph::graph_rewrite_callback internal_callback = [this, &context](ngraph::pattern::Matcher &m) {
+        // Several transformations can be matched on the same operation. Skip the operation if a previous one has
+        // already replaced it: the operation is not a part of the function anymore.
+        const auto root = m.get_match_root();
+        const auto outputs = root->outputs();
+        if (!outputs.empty() && std::all_of(outputs.begin(), outputs.end(), [](const Output<Node>& output) {
+                return output.get_target_inputs().empty();
+            })) {
+            return false;
+        }
+
+        const bool profile = ngraph::pass::PassProfiler::is_active();
+        const auto start = profile ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
         const bool result = transform(context, m);
-        (void)result;
+        if (profile) {
+            auto& statistics = context.statistics[this];
+            statistics.time += std::chrono::steady_clock::now() - start;
+            statistics.matches++;
+            statistics.rewrites += result ? 1ul : 0ul;
+        }
 #ifdef LPT_DISPLAY_PRECISION
         if (result) {
             auto operationNode = m.get_match_root();
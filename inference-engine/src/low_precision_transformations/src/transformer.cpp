@@ -6,7 +6,9 @@
 #include "low_precision/network_helper.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <limits>
 #include <map>
 #include <memory>
@@ -17,8 +19,13 @@
 #include <utility>
 #include <vector>
 
+#ifndef _WIN32
+#include <cxxabi.h>
+#endif
+
 #include "ngraph_ops/type_relaxed.hpp"
 #include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/pass_profiler.hpp"
 #include "ngraph/opsets/opset6.hpp"
 
 // branch specific transformations
@@ -281,11 +288,7 @@ template <typename BaseOp>
 void make_matcher_type_relaxed(ngraph::pass::GraphRewrite* transformation) {
     using namespace ngraph;
 
-    auto is_op_type = [](std::shared_ptr<Node> n) {
-        return !!as_type_ptr<BaseOp>(n);
-    };
-
-    auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
+    auto p_node = std::make_shared<pattern::op::WrapType>(BaseOp::type_info);
 
     ngraph::graph_rewrite_callback callback = [](ngraph::pattern::Matcher &m) {
         auto l_node = std::dynamic_pointer_cast<BaseOp>(m.get_match_root());
@@ -341,13 +344,73 @@ TypeRelaxedReplacer::TypeRelaxedReplacer() {
 LowPrecisionTransformer::LowPrecisionTransformer(const LowPrecisionTransformations& transformations)
     : transformations(transformations) {}
 
+namespace {
+
+std::string getTransformationName(const LayerTransformation& transformation) {
+    std::string name = typeid(transformation).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled != nullptr) {
+        name = demangled;
+        std::free(demangled);
+    }
+#endif
+    const size_t namespaceEnd = name.rfind("::");
+    return namespaceEnd == std::string::npos ? name : name.substr(namespaceEnd + 2);
+}
+
+// Reports statistics collected by transformations of the step as nested profiles of the step.
+// Transformations of the same type registered for different operations are reported together.
+void reportStatistics(TransformationContext& context) {
+    if (context.statistics.empty()) {
+        return;
+    }
+
+    std::map<std::string, TransformationContext::TransformationStatistics> statistics;
+    for (const auto& it : context.statistics) {
+        auto& transformationStatistics = statistics[getTransformationName(*it.first)];
+        transformationStatistics.time += it.second.time;
+        transformationStatistics.matches += it.second.matches;
+        transformationStatistics.rewrites += it.second.rewrites;
+    }
+    context.statistics.clear();
+
+    std::vector<std::pair<std::string, TransformationContext::TransformationStatistics>> sorted(statistics.begin(), statistics.end());
+    std::stable_sort(sorted.begin(), sorted.end(), [](
+        const std::pair<std::string, TransformationContext::TransformationStatistics>& a,
+        const std::pair<std::string, TransformationContext::TransformationStatistics>& b) {
+        return a.second.time > b.second.time;
+    });
+
+    // matchers of LPT transformations never report success to GraphRewrite, so rewrites of the step are added here
+    size_t rewrites = 0ul;
+    for (const auto& it : sorted) {
+        ngraph::pass::PassProfiler::add_profile(
+            it.first,
+            std::chrono::duration_cast<std::chrono::microseconds>(it.second.time),
+            it.second.matches,
+            it.second.rewrites);
+        rewrites += it.second.rewrites;
+    }
+    ngraph::pass::PassProfiler::add_rewrites(rewrites);
+}
+
+}  // namespace
+
 void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
     if (!isFunctionQuantized(network)) {
         return;
     }
 
-    ngraph::pass::ConstantFolding constantFolding;
-    constantFolding.run_on_function(network);
+    // Every step is reported by ngraph::pass::PassProfiler together with statistics of its transformations
+    ngraph::pass::PassProfilingScope profilingScope("LowPrecisionTransformer");
+
+    {
+        ngraph::pass::PassProfilingScope stepProfilingScope("ConstantFolding");
+        ngraph::pass::ConstantFolding constantFolding;
+        constantFolding.run_on_function(network);
+    }
 
     transformations.setParamsManager(this);
     transformations.setLayerTransformationsManager(this);
@@ -356,46 +419,64 @@ void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
 
     // Extend necessary operations with polymorphic semantics
     {
+        ngraph::pass::PassProfilingScope stepProfilingScope("TypeRelaxedReplacer");
         TypeRelaxedReplacer pass;
         pass.run_on_function(network);
     }
 
+    // Matchers of all transformations have typed roots, so every step below is one traversal of the function
+    // which dispatches operations to transformations by operation type. The steps can not be merged:
+    // each of them expects that the previous one has been applied to the whole function.
+
     {
         // Branch specific transformations
+        ngraph::pass::PassProfilingScope stepProfilingScope("BranchSpecificTransformations");
         GraphRewrite pass;
         registerAllMatchers(transformations.branchSpecificTransformations, pass, context);
         pass.run_on_function(network);
+        reportStatistics(context);
     }
 
     {
         // Step #1: FakeQuantize decomposition transformation execution
+        ngraph::pass::PassProfilingScope stepProfilingScope("DecompositionTransformations");
         GraphRewrite pass;
         registerAllMatchers(transformations.decompositionTransformations, pass, context);
         pass.run_on_function(network);
+        reportStatistics(context);
     }
 
     {
         // Step #2: layer transformations execution
+        ngraph::pass::PassProfilingScope stepProfilingScope("LayerTransformations");
         GraphRewrite pass;
         registerAllMatchers(transformations.transformations, pass, context);
         pass.run_on_function(network);
+        reportStatistics(context);
     }
 
     {
         // Step #3: cleanup transformations execution
+        ngraph::pass::PassProfilingScope stepProfilingScope("CleanupTransformations");
         GraphRewrite pass;
         registerAllMatchers(transformations.cleanupTransformations, pass, context);
         pass.run_on_function(network);
+        reportStatistics(context);
     }
 
     {
         // Step #4: standalone cleanup transformations execution
-
+        // Standalone cleanup transformations handle the operation and its dequantization operations above it only,
+        // so they are applied in one traversal: operations are visited in topological order and for every operation
+        // transformations are tried in the order of registration. An operation replaced by a transformation is
+        // skipped by the next ones.
+        ngraph::pass::PassProfilingScope stepProfilingScope("StandaloneCleanupTransformations");
+        GraphRewrite pass;
         for (auto it : transformations.standaloneCleanupTransformations) {
-            GraphRewrite pass;
             it.transformation->registerMatcherIn(pass, context);
-            pass.run_on_function(network);
         }
+        pass.run_on_function(network);
+        reportStatistics(context);
     }
 
     network->validate_nodes_and_infer_types();
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
@@ -71,6 +72,76 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS) {
+            if (val == PluginConfigParams::YES) sharedStreams = true;
+            else if (val == PluginConfigParams::NO) sharedStreams = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS_WEIGHT) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                val_i = 0;
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS_WEIGHT
+                                   << ". Expected only positive integer numbers";
+            sharedStreamsWeight = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS_QUOTA) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                val_i = -1;
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS_QUOTA
+                                   << ". Expected only non negative integer numbers";
+            sharedStreamsQuota = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_PRIMITIVES_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                val_i = -1;
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PRIMITIVES_CACHE_CAPACITY
+                                   << ". Expected only non negative integer numbers";
+            primitivesCacheCapacity = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                val_f = -1.f;
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                   << ". Expected only floating point numbers in [0, 1] range";
+            sparseWeightsThreshold = val_f;
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION) {
+            if (val == PluginConfigParams::NO)
+                dynamicQuantizationMode = DynamicQuantizationMode::Disabled;
+            else if (val == PluginConfigParams::CPU_DYNAMIC_QUANTIZATION_PER_TENSOR)
+                dynamicQuantizationMode = DynamicQuantizationMode::PerTensor;
+            else if (val == PluginConfigParams::CPU_DYNAMIC_QUANTIZATION_PER_ROW)
+                dynamicQuantizationMode = DynamicQuantizationMode::PerRow;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION
+                                   << ". Expected only NO/" << PluginConfigParams::CPU_DYNAMIC_QUANTIZATION_PER_TENSOR
+                                   << "/" << PluginConfigParams::CPU_DYNAMIC_QUANTIZATION_PER_ROW;
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION_EXCLUDE) {
+            dynamicQuantizationExclude = val;
+            dynamicQuantizationExcludedLayers.clear();
+            std::stringstream layers(val);
+            std::string layer;
+            while (std::getline(layers, layer, ',')) {
+                if (!layer.empty())
+                    dynamicQuantizationExcludedLayers.insert(layer);
+            }
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -89,6 +160,20 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key.compare(PluginConfigInternalParams::KEY_SNIPPETS_MODE) == 0) {
+            if (val == PluginConfigParams::NO)
+                enableSnippets = false;
+            else if (val == PluginConfigParams::YES)
+                enableSnippets = true;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE;
+        } else if (key.compare(PluginConfigInternalParams::KEY_ATTENTION_FUSION_MODE) == 0) {
+            if (val == PluginConfigParams::NO)
+                enableAttentionFusion = false;
+            else if (val == PluginConfigParams::YES)
+                enableAttentionFusion = true;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_ATTENTION_FUSION_MODE;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -144,6 +229,21 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        if (sharedStreams == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS_WEIGHT, std::to_string(sharedStreamsWeight) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS_QUOTA, std::to_string(sharedStreamsQuota) });
+        _config.insert({ PluginConfigParams::KEY_CPU_PRIMITIVES_CACHE_CAPACITY, std::to_string(primitivesCacheCapacity) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, std::to_string(sparseWeightsThreshold) });
+        if (dynamicQuantizationMode == DynamicQuantizationMode::PerTensor)
+            _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION, PluginConfigParams::CPU_DYNAMIC_QUANTIZATION_PER_TENSOR });
+        else if (dynamicQuantizationMode == DynamicQuantizationMode::PerRow)
+            _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION, PluginConfigParams::CPU_DYNAMIC_QUANTIZATION_PER_ROW });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION_EXCLUDE, dynamicQuantizationExclude });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <map>
+#include <set>
 #include <threading/ie_istreams_executor.hpp>
 
 namespace MKLDNNPlugin {
@@ -18,6 +19,12 @@ struct Config {
         On,
     };
 
+    enum DynamicQuantizationMode {
+        Disabled,
+        PerTensor,
+        PerRow,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -25,16 +32,28 @@ struct Config {
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    bool sharedStreams = false;
+    int sharedStreamsWeight = 1;
+    int sharedStreamsQuota = 0;
+    int primitivesCacheCapacity = 1024;
+    float sparseWeightsThreshold = 0.f;
+    DynamicQuantizationMode dynamicQuantizationMode = DynamicQuantizationMode::Disabled;
+    std::string dynamicQuantizationExclude = "";
+    std::set<std::string> dynamicQuantizationExcludedLayers;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
     // Currently INT8 mode is not optimized on ARM, fallback to FP32 mode.
     LPTransformsMode lpTransformsMode = LPTransformsMode::Off;
     bool enforceBF16 = false;
+    bool enableSnippets = false;
 #else
     LPTransformsMode lpTransformsMode = LPTransformsMode::On;
     bool enforceBF16 = true;
+    bool enableSnippets = true;
 #endif
+    // Fused attention is an opt-in until it's validated on real models
+    bool enableAttentionFusion = false;
 
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
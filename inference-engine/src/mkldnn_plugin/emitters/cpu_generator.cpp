@@ -0,0 +1,201 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_ext_emitters.hpp"
+#include "jit_snippets_emitters.hpp"
+
+#include <ie_common.h>
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/vector_to_scalar.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+#define CREATE_EMITTER(e_type) [this](std::shared_ptr<ngraph::Node> n) -> std::shared_ptr<ngraph::snippets::Emitter> { \
+    return std::make_shared<e_type>(h, isa, n); \
+}
+
+CPUTargetMachine::CPUTargetMachine(jit_generator* h, cpu_isa_t isa) : h(h), isa(isa) {}
+
+auto CPUTargetMachine::getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                                std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> {
+    return {
+        // data movement
+        {ngraph::snippets::op::Load::type_info, CREATE_EMITTER(jit_snippets_load_emitter)},
+        {ngraph::snippets::op::ScalarLoad::type_info, CREATE_EMITTER(jit_snippets_load_emitter)},
+        {ngraph::snippets::op::BroadcastLoad::type_info, CREATE_EMITTER(jit_broadcast_load_emitter)},
+        {ngraph::snippets::op::Store::type_info, CREATE_EMITTER(jit_snippets_store_emitter)},
+        {ngraph::snippets::op::ScalarStore::type_info, CREATE_EMITTER(jit_snippets_store_emitter)},
+        {ngraph::snippets::op::BroadcastMove::type_info, CREATE_EMITTER(jit_broadcast_move_emitter)},
+        {ngraph::snippets::op::Scalar::type_info, CREATE_EMITTER(jit_scalar_emitter)},
+        {ngraph::snippets::op::Nop::type_info, CREATE_EMITTER(jit_nop_emitter)},
+
+        // binary
+        {ngraph::opset1::Add::type_info, CREATE_EMITTER(jit_add_emitter)},
+        {ngraph::opset1::Subtract::type_info, CREATE_EMITTER(jit_subtract_emitter)},
+        {ngraph::opset1::Multiply::type_info, CREATE_EMITTER(jit_multiply_emitter)},
+        {ngraph::opset1::Divide::type_info, CREATE_EMITTER(jit_divide_emitter)},
+        {ngraph::opset1::FloorMod::type_info, CREATE_EMITTER(jit_floor_mod_emitter)},
+        {ngraph::opset1::Mod::type_info, CREATE_EMITTER(jit_mod_emitter)},
+        {ngraph::opset1::Maximum::type_info, CREATE_EMITTER(jit_maximum_emitter)},
+        {ngraph::opset1::Minimum::type_info, CREATE_EMITTER(jit_minimum_emitter)},
+        {ngraph::opset1::SquaredDifference::type_info, CREATE_EMITTER(jit_squared_difference_emitter)},
+        {ngraph::opset1::Power::type_info, CREATE_EMITTER(jit_power_dynamic_emitter)},
+        {ngraph::snippets::op::PowerStatic::type_info, CREATE_EMITTER(jit_power_static_emitter)},
+        {ngraph::opset1::Equal::type_info, CREATE_EMITTER(jit_equal_emitter)},
+        {ngraph::opset1::NotEqual::type_info, CREATE_EMITTER(jit_not_equal_emitter)},
+        {ngraph::opset1::Greater::type_info, CREATE_EMITTER(jit_greater_emitter)},
+        {ngraph::opset1::GreaterEqual::type_info, CREATE_EMITTER(jit_greater_equal_emitter)},
+        {ngraph::opset1::Less::type_info, CREATE_EMITTER(jit_less_emitter)},
+        {ngraph::opset1::LessEqual::type_info, CREATE_EMITTER(jit_less_equal_emitter)},
+        {ngraph::opset1::LogicalAnd::type_info, CREATE_EMITTER(jit_logical_and_emitter)},
+        {ngraph::opset1::LogicalOr::type_info, CREATE_EMITTER(jit_logical_or_emitter)},
+        {ngraph::opset1::LogicalXor::type_info, CREATE_EMITTER(jit_logical_xor_emitter)},
+        {ngraph::opset1::Xor::type_info, CREATE_EMITTER(jit_logical_xor_emitter)},
+
+        // unary
+        {ngraph::opset1::LogicalNot::type_info, CREATE_EMITTER(jit_logical_not_emitter)},
+        {ngraph::opset1::Sqrt::type_info, CREATE_EMITTER(jit_sqrt_emitter)},
+        {ngraph::opset1::Negative::type_info, CREATE_EMITTER(jit_negative_emitter)},
+        {ngraph::opset1::Relu::type_info, CREATE_EMITTER(jit_relu_emitter)},
+        {ngraph::opset1::Sigmoid::type_info, CREATE_EMITTER(jit_sigmoid_emitter)},
+        {ngraph::opset1::Tanh::type_info, CREATE_EMITTER(jit_tanh_emitter)},
+        {ngraph::opset1::Exp::type_info, CREATE_EMITTER(jit_exp_emitter)},
+        {ngraph::opset1::Abs::type_info, CREATE_EMITTER(jit_abs_emitter)},
+        {ngraph::opset1::Elu::type_info, CREATE_EMITTER(jit_elu_emitter)},
+        {ngraph::opset1::Clamp::type_info, CREATE_EMITTER(jit_clamp_emitter)},
+    };
+}
+
+#undef CREATE_EMITTER
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : h(new jit_snippet()), isa(isa) {
+    jitters = CPUTargetMachine(h.get(), isa).getJitters();
+}
+
+bool CPUGenerator::isSupported(const std::shared_ptr<const ngraph::Node>& node) {
+    static const auto supported = CPUTargetMachine(nullptr, cpu_isa_t::isa_any).getJitters();
+    return supported.count(node->get_type_info()) != 0;
+}
+
+ngraph::snippets::code CPUGenerator::generate(std::shared_ptr<ngraph::Function>& f) const {
+    using lowered_op = std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>;
+
+    const size_t num_params = f->get_parameters().size();
+    const size_t num_results = f->get_results().size();
+    if (num_params + num_results > SNIPPETS_MAX_NUM_IO)
+        THROW_IE_EXCEPTION << "Snippet has " << num_params + num_results << " inputs and outputs, but only "
+                           << SNIPPETS_MAX_NUM_IO << " are supported";
+
+    // tail is processed by the same body with scalar memory accesses, register assignment is kept by copied rt_info
+    auto tail = ngraph::clone_function(*f);
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
+    manager.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    manager.run_passes(tail);
+
+    std::set<size_t> used_vecs;
+    auto lower = [&](const std::shared_ptr<ngraph::Function>& body) {
+        std::vector<lowered_op> lowered;
+        for (auto n : body->get_ordered_ops()) {
+            if (ngraph::op::is_parameter(n) || ngraph::op::is_output(n))
+                continue;
+
+            auto it = jitters.find(n->get_type_info());
+            if (it == jitters.end())
+                THROW_IE_EXCEPTION << "Snippet operation " << n->get_friendly_name() << " of type " << n->get_type_name()
+                                   << " is not supported by CPU generator";
+
+            auto regs = ngraph::snippets::getRegisters(n);
+            used_vecs.insert(regs.first.begin(), regs.first.end());
+            used_vecs.insert(regs.second.begin(), regs.second.end());
+
+            lowered.emplace_back(it->second(n), regs);
+        }
+        return lowered;
+    };
+
+    auto vector_body = lower(f);
+    auto scalar_body = lower(tail);
+
+    const size_t max_vecs = isa == avx512_common ? 32 : 16;
+    std::vector<size_t> vec_pool;
+    for (size_t idx = 0; idx < max_vecs; idx++) {
+        if (used_vecs.count(idx) == 0)
+            vec_pool.push_back(idx);
+    }
+
+    std::vector<bool> is_advanced;
+    for (const auto& param : f->get_parameters()) {
+        const auto& shape = param->get_shape();
+        is_advanced.push_back(!shape.empty() && shape.back() != 1);
+    }
+    for (const auto& result : f->get_results()) {
+        const auto& shape = result->get_input_shape(0);
+        is_advanced.push_back(!shape.empty() && shape.back() != 1);
+    }
+
+    const size_t vlen = isa == avx512_common ? 64 : isa == avx2 ? 32 : 16;
+    const size_t vec_step = vlen / sizeof(float);
+    const size_t io_start = 8;  // effective addresses assigned by AssignRegisters start from r8
+
+    const Reg64 reg_const_params = abi_param1;
+    const Reg64 reg_work_amount = h->rax;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+    h->preamble();
+
+    for (size_t i = 0; i < num_params + num_results; i++)
+        h->mov(Reg64(static_cast<int>(io_start + i)), h->ptr[reg_const_params + GET_OFF(ptrs) + i * sizeof(void*)]);
+    h->mov(reg_work_amount, h->ptr[reg_const_params + GET_OFF(work_amount)]);
+#undef GET_OFF
+
+    auto emit_loop = [&](const std::vector<lowered_op>& body, size_t step) {
+        Label loop_label;
+        Label exit_label;
+
+        h->L(loop_label);
+        {
+            h->cmp(reg_work_amount, step);
+            h->jl(exit_label, jit_generator::T_NEAR);
+
+            for (const auto& op : body)
+                op.first->emit_code(op.second.first, op.second.second, vec_pool);
+
+            for (size_t i = 0; i < is_advanced.size(); i++) {
+                if (is_advanced[i])
+                    h->add(Reg64(static_cast<int>(io_start + i)), step * sizeof(float));
+            }
+
+            h->sub(reg_work_amount, step);
+            h->jmp(loop_label, jit_generator::T_NEAR);
+        }
+        h->L(exit_label);
+    };
+
+    emit_loop(vector_body, vec_step);
+    emit_loop(scalar_body, 1);
+
+    h->postamble();
+
+    for (const auto& op : vector_body)
+        op.first->emit_data();
+    for (const auto& op : scalar_body)
+        op.first->emit_data();
+
+    h->create_kernel();
+    return h->jit_ker();
+}
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,65 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include <snippets/generator.hpp>
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+// snippet keeps pointers to all its inputs and outputs in r8-r14, so the number of them is limited
+#define SNIPPETS_MAX_NUM_IO 7
+
+struct jit_snippets_call_args {
+    const void* ptrs[SNIPPETS_MAX_NUM_IO];
+    size_t work_amount;
+};
+
+/**
+ * Code buffer the snippet is emitted into. Code is emitted by CPUGenerator before create_kernel() is called.
+ */
+class jit_snippet : public mkldnn::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    jit_snippet() : jit_generator() {}
+
+    void generate() override {}
+};
+
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    CPUTargetMachine(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa);
+
+    auto getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                  std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> override;
+
+private:
+    mkldnn::impl::cpu::x64::jit_generator* h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+/**
+ * Generates x64 kernel for a canonical snippet body. The kernel processes `work_amount` elements along the innermost
+ * dimension: the main loop handles a vector of elements per iteration, the tail loop finishes the rest element by element.
+ * Pointers of inputs and outputs which are broadcasted along the innermost dimension are not advanced.
+ */
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() override = default;
+
+    ngraph::snippets::code generate(std::shared_ptr<ngraph::Function>& f) const override;
+
+    static bool isSupported(const std::shared_ptr<const ngraph::Node>& node);
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,196 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+#include <snippets/snippets_isa.hpp>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+size_t get_effective_address(const std::shared_ptr<ngraph::Node>& n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        THROW_IE_EXCEPTION << "Snippet operation " << n->get_friendly_name() << " has no effective address assigned";
+    return static_cast<size_t>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+}
+
+} // namespace
+
+/// NOP ///
+jit_nop_emitter::jit_nop_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, Precision exec_prc)
+: jit_emitter(host, host_isa, n, exec_prc) {}
+
+size_t jit_nop_emitter::get_inputs_num() const { return 0; }
+
+void jit_nop_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                const emitter_context *emit_context) const {
+}
+
+/// SCALAR ///
+jit_scalar_emitter::jit_scalar_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n, Precision exec_prc)
+: jit_emitter(host, host_isa, n, exec_prc) {
+    auto scalar = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n);
+    if (!scalar)
+        THROW_IE_EXCEPTION << "Cannot create scalar emitter for " << n->get_friendly_name();
+    value = scalar->cast_vector<float>()[0];
+
+    prepare_table();
+}
+
+size_t jit_scalar_emitter::get_inputs_num() const { return 0; }
+
+void jit_scalar_emitter::register_table_entries() {
+    push_arg_entry_of("scalar", float2int(value), true);
+}
+
+void jit_scalar_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                   const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_scalar_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+/// LOAD ///
+jit_snippets_load_emitter::jit_snippets_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                                                     Precision exec_prc)
+: jit_emitter(host, host_isa, n, exec_prc, emitter_in_out_map::gpr_to_vec), ea(get_effective_address(n)) {
+    // input broadcasted along the innermost dimension has a single element per iteration, it is broadcasted later by BroadcastMove
+    const auto& shape = n->get_input_shape(0);
+    const bool is_scalar = ngraph::is_type<ngraph::snippets::op::ScalarLoad>(n) || shape.empty() || shape.back() == 1;
+    const int load_num = is_scalar ? 1 : static_cast<int>(get_vec_length() / exec_prc.size());
+
+    load_emitter.reset(new jit_load_emitter(host, host_isa, nullptr, exec_prc));
+    load_context = std::make_shared<load_emitter_context>(exec_prc, exec_prc, load_num);
+}
+
+size_t jit_snippets_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_snippets_load_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                          const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                          const emitter_context *emit_context) const {
+    load_emitter->emit_code({ea}, {out_vec_idxs[0]}, load_context, pool_vec_idxs, pool_gpr_idxs);
+}
+
+void jit_snippets_load_emitter::emit_data() const {
+    load_emitter->emit_data();
+}
+
+/// BROADCAST LOAD ///
+jit_broadcast_load_emitter::jit_broadcast_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                                                       Precision exec_prc)
+: jit_emitter(host, host_isa, n, exec_prc, emitter_in_out_map::gpr_to_vec), ea(get_effective_address(n)) {}
+
+size_t jit_broadcast_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_broadcast_load_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                           const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                           const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_broadcast_load_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    h->uni_vbroadcastss(vmm_dst, h->ptr[Reg64(static_cast<int>(ea))]);
+}
+
+/// STORE ///
+jit_snippets_store_emitter::jit_snippets_store_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                                                       Precision exec_prc)
+: jit_emitter(host, host_isa, n, exec_prc, emitter_in_out_map::vec_to_gpr), ea(get_effective_address(n)) {
+    // output which is broadcasted along the innermost dimension gets the same element on every iteration
+    const auto& shape = n->get_output_shape(0);
+    const bool is_scalar = ngraph::is_type<ngraph::snippets::op::ScalarStore>(n) || shape.empty() || shape.back() == 1;
+    const int store_num = is_scalar ? 1 : static_cast<int>(get_vec_length() / exec_prc.size());
+
+    store_emitter.reset(new jit_store_emitter(host, host_isa, nullptr, exec_prc));
+    store_context = std::make_shared<store_emitter_context>(exec_prc, exec_prc, store_num);
+}
+
+size_t jit_snippets_store_emitter::get_inputs_num() const { return 1; }
+
+void jit_snippets_store_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                           const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                           const emitter_context *emit_context) const {
+    store_emitter->emit_code({in_vec_idxs[0]}, {ea}, store_context, pool_vec_idxs, pool_gpr_idxs);
+}
+
+void jit_snippets_store_emitter::emit_data() const {
+    store_emitter->emit_data();
+}
+
+/// BROADCAST MOVE ///
+jit_broadcast_move_emitter::jit_broadcast_move_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                                                       Precision exec_prc)
+: jit_emitter(host, host_isa, n, exec_prc) {
+    // broadcasting along outer dimensions is done by the kernel caller with zero strides, so it is just a move
+    const auto& in_shape = n->get_input_shape(0);
+    const auto& out_shape = n->get_output_shape(0);
+    broadcast_innermost = (in_shape.empty() || in_shape.back() == 1) && !out_shape.empty() && out_shape.back() != 1;
+}
+
+size_t jit_broadcast_move_emitter::get_inputs_num() const { return 1; }
+
+void jit_broadcast_move_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                           const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                           const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_broadcast_move_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    if (broadcast_innermost) {
+        h->uni_vbroadcastss(vmm_dst, Xmm(in_vec_idxs[0]));
+    } else if (in_vec_idxs[0] != out_vec_idxs[0]) {
+        h->uni_vmovups(vmm_dst, vmm_src);
+    }
+}
+
+} // namespace MKLDNNPlugin
@@ -17,9 +17,12 @@
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_shared_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
+#include <chrono>
+#include <functional>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -45,6 +48,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights) {
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
+    auto preparationStart = std::chrono::steady_clock::now();
 
     // we are cloning network if we have statistics and we can transform network.
     _clonedNetwork = cloneNetwork(network);
@@ -63,11 +67,35 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
             iter++;
         }
 
-        auto changePrecisionBF16 = [&](Precision current, Precision target) {
+        // Inference precision of the layer may be chosen by per layer profiling (see mixed_precision_tool)
+        // and stored in "inferencePrecision" runtime attribute of the layer. Layers are executed in precision
+        // of their inputs, so the precision is applied to the outputs of its producers (to the input of
+        // the layer itself if it has no outputs like Memory).
+        auto hasInferencePrecision = [](const CNNLayerPtr& layer, const std::string& precision) {
+            return CaselessEq<std::string>()(layer->GetParamAsString("inferencePrecision", ""), precision);
+        };
+        auto feedsInferencePrecision = [&](const CNNLayerPtr& layer, const std::string& precision) {
+            if (layer->outData.empty())
+                return hasInferencePrecision(layer, precision);
+            for (const auto& data : layer->outData) {
+                for (const auto& consumer : getInputTo(data)) {
+                    if (hasInferencePrecision(consumer.second, precision))
+                        return true;
+                }
+            }
+            return false;
+        };
+
+        auto changePrecisionBF16 = [&](Precision current, Precision target, const std::function<bool(const CNNLayerPtr&)>& isApplicable) {
             InputsDataMap inputs = _clonedNetwork.getInputsInfo();
             OutputsDataMap outputs = _clonedNetwork.getOutputsInfo();
             CNNNetworkIterator iter(_clonedNetwork);
             while (iter != CNNNetworkIterator()) {
+                if (!isApplicable(*iter)) {
+                    iter++;
+                    continue;
+                }
+
                 //  check, if memory output node needs to be transformed
                 if (current == Precision::FP32 &&
                     (*iter)->type == "Memory" && (*iter)->outData.size() == 0 &&
@@ -88,13 +116,24 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         };
 
         if (with_cpu_x86_avx512_core() && isFloatModel) {
-            // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
-            // Otherwise, only layers marked as BF16 in '_clonedNetwork' will be performed in bfloat16 mode.
+            // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin
+            // except ones with FP32 inference precision.
+            // Otherwise, only layers marked as BF16 in '_clonedNetwork' or with BF16 inference precision
+            // will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-            if (cfg.enforceBF16 == true)
-                changePrecisionBF16(Precision::FP32, Precision::BF16);
+            if (cfg.enforceBF16 == true) {
+                changePrecisionBF16(Precision::FP32, Precision::BF16, [&](const CNNLayerPtr& layer) {
+                    return !feedsInferencePrecision(layer, "FP32");
+                });
+            } else {
+                changePrecisionBF16(Precision::FP32, Precision::BF16, [&](const CNNLayerPtr& layer) {
+                    return feedsInferencePrecision(layer, "BF16");
+                });
+            }
         } else {
-            changePrecisionBF16(Precision::BF16, Precision::FP32);
+            changePrecisionBF16(Precision::BF16, Precision::FP32, [](const CNNLayerPtr&) {
+                return true;
+            });
         }
     }
 
@@ -225,9 +264,23 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+    } else if (cfg.sharedStreams) {
+        // streams of the pool are shared by all networks, the network streams number limits its concurrently running requests
+        IStreamsExecutor::Config poolConfig{"CPUSharedStreamsExecutor"};
+        poolConfig._threadBindingType = _cfg.streamExecutorConfig._threadBindingType;
+        poolConfig.SetConfig(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, PluginConfigParams::CPU_THROUGHPUT_AUTO);
+        auto pool = InferenceEngine::ExecutorManager::getInstance()->getSharedStreamsPool(
+            IStreamsExecutor::Config::MakeDefaultMultiThreaded(poolConfig));
+        if (0 != _cfg.sharedStreamsQuota)
+            streams = std::min(streams, _cfg.sharedStreamsQuota);
+        // graphs are bound to the network slots in the pool, graphs of slots not taken during the loading
+        // are created by the first request running in the slot
+        _taskExecutor = std::make_shared<SharedStreamsExecutor>(pool,
+            SharedStreamsExecutor::ClientConfig{_name, static_cast<unsigned int>(_cfg.sharedStreamsWeight), streams});
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
@@ -240,18 +293,27 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
-    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    _loadNetworkProfile.add("exec_network_preparation",
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - preparationStart));
+
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
-        for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
-            };
+    {
+        LoadNetworkProfile::Scope profilingScope(_loadNetworkProfile, "stream_graphs_creation");
+        if (_cfg.streamExecutorConfig._streams != 0) {
+            for (auto&& task : tasks) {
+                task = [this] {
+                    MKLDNNExecNetwork::GetGraph();
+                };
+            }
+            _taskExecutor->runAndWait(tasks);
+        } else {
+            MKLDNNExecNetwork::GetGraph();
         }
-        _taskExecutor->runAndWait(tasks);
-    } else {
-        MKLDNNExecNetwork::GetGraph();
+    }
+    // phases of graphs created in parallel are summed, so they can exceed the wall time of the graphs creation
+    for (auto& graph : _graphs) {
+        _loadNetworkProfile.merge(graph.getInitProfile(), "stream_graph.");
     }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -346,6 +408,18 @@ Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     }
 }
 
+void MKLDNNExecNetwork::setTransformationsProfile(const std::vector<std::string> &profile) {
+    _transformationsProfile = profile;
+}
+
+const LoadNetworkProfile& MKLDNNExecNetwork::getLoadNetworkProfile() const {
+    return _loadNetworkProfile;
+}
+
+void MKLDNNExecNetwork::setLoadNetworkProfile(const LoadNetworkProfile &profile) {
+    _loadNetworkProfile = profile;
+}
+
 InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -359,6 +433,10 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(TRANSFORMATIONS_PROFILE));
+        metrics.push_back(METRIC_KEY(LOAD_NETWORK_PROFILE));
+        if (nullptr != std::dynamic_pointer_cast<SharedStreamsExecutor>(_taskExecutor))
+            metrics.push_back(METRIC_KEY(SHARED_STREAMS_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -373,6 +451,25 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(TRANSFORMATIONS_PROFILE)) {
+        IE_SET_METRIC_RETURN(TRANSFORMATIONS_PROFILE, _transformationsProfile);
+    } else if (name == METRIC_KEY(LOAD_NETWORK_PROFILE)) {
+        IE_SET_METRIC_RETURN(LOAD_NETWORK_PROFILE, _loadNetworkProfile.format());
+    } else if (name == METRIC_KEY(SHARED_STREAMS_STATISTICS)) {
+        auto sharedStreamsExecutor = std::dynamic_pointer_cast<SharedStreamsExecutor>(_taskExecutor);
+        if (nullptr == sharedStreamsExecutor)
+            THROW_IE_EXCEPTION << "ExecutableNetwork metric " << name << " is supported only with "
+                               << PluginConfigParams::KEY_CPU_SHARED_STREAMS << " enabled";
+        auto statistics = sharedStreamsExecutor->GetStatistics();
+        std::vector<std::string> entries = {
+            "tasks," + std::to_string(statistics._tasks),
+            "queued," + std::to_string(statistics._queued),
+            "running," + std::to_string(statistics._running),
+            "queueing_time_us," + std::to_string(statistics._queueingTime),
+            "max_queueing_time_us," + std::to_string(statistics._maxQueueingTime),
+            "execution_time_us," + std::to_string(statistics._executionTime),
+        };
+        IE_SET_METRIC_RETURN(SHARED_STREAMS_STATISTICS, entries);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -36,6 +36,12 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void setTransformationsProfile(const std::vector<std::string> &profile);
+
+    const LoadNetworkProfile& getLoadNetworkProfile() const;
+
+    void setLoadNetworkProfile(const LoadNetworkProfile &profile);
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -54,6 +60,8 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    std::vector<std::string>                    _transformationsProfile;
+    LoadNetworkProfile                          _loadNetworkProfile;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -25,6 +25,8 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 
 #include <legacy/graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -104,7 +106,11 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    Replicate(net, extMgr);
+    initProfile = LoadNetworkProfile();
+    {
+        LoadNetworkProfile::Scope profilingScope(initProfile, "replicate");
+        Replicate(net, extMgr);
+    }
     InitGraph();
     status = Ready;
 }
@@ -332,24 +338,43 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
 void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
 
-    SortTopologically();
-    InitNodes();
+    {
+        LoadNetworkProfile::Scope profilingScope(initProfile, "init_nodes");
+        SortTopologically();
+        InitNodes();
+    }
 
-    optimizer.ApplyCommonGraphOptimizations(*this);
-    SortTopologically();
+    {
+        LoadNetworkProfile::Scope profilingScope(initProfile, "graph_optimizations");
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+    }
 
-    InitDescriptors();
+    {
+        LoadNetworkProfile::Scope profilingScope(initProfile, "primitive_descriptors_selection");
+        InitDescriptors();
 
-    InitOptimalPrimitiveDescriptors();
+        InitOptimalPrimitiveDescriptors();
 
-    InitEdges();
+        InitEdges();
+    }
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
-    SortTopologically();
+    {
+        LoadNetworkProfile::Scope profilingScope(initProfile, "graph_optimizations");
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+        SortTopologically();
+    }
 
-    Allocate();
+    {
+        LoadNetworkProfile::Scope profilingScope(initProfile, "memory_allocation");
+        Allocate();
+    }
 
-    CreatePrimitives();
+    {
+        LoadNetworkProfile::Scope profilingScope(initProfile, "primitives_creation");
+        CreatePrimitives();
+        CreateInputReorders();
+    }
 
     SetOriginalLayerNames();
 
@@ -411,6 +436,16 @@ void MKLDNNGraph::SetOriginalLayerNames() {
 void MKLDNNGraph::InitNodes() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitNodes");
     for (auto &node : graphNodes) {
+        if (node->getType() == FullyConnected) {
+            auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+            if (fcNode) {
+                fcNode->setSparseWeightsThreshold(config.sparseWeightsThreshold);
+                if (config.dynamicQuantizationMode != Config::DynamicQuantizationMode::Disabled &&
+                    config.dynamicQuantizationExcludedLayers.count(fcNode->getName()) == 0)
+                    fcNode->setDynamicQuantization(config.dynamicQuantizationMode == Config::DynamicQuantizationMode::PerRow ?
+                                                   DynamicQuantization::PerRow : DynamicQuantization::PerTensor);
+            }
+        }
         node->init();
     }
 }
@@ -618,6 +653,17 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
+    // sharing of memory is lost once edges are allocated, so memory nodes get edges viewing their state in advance
+    for (auto &cluster : edge_clusters) {
+        std::unordered_set<MKLDNNMemoryInputNode*> memoryInputs;
+        for (auto &edge : cluster) {
+            if (auto memoryInput = dynamic_cast<MKLDNNMemoryInputNode*>(edge->getParent().get()))
+                memoryInputs.insert(memoryInput);
+        }
+        if (memoryInputs.size() == 1)
+            (*memoryInputs.begin())->setStateEdges(std::vector<MKLDNNEdgePtr>(cluster.begin(), cluster.end()));
+    }
+
     size_t edge_clusters_count = edge_clusters.size();
 
     for (size_t i = 0; i < edge_clusters_count;) {
@@ -755,6 +801,41 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
+void MKLDNNGraph::CreateInputReorders() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::CreateInputReorders");
+    for (auto& input : inputNodes) {
+        auto& cnnLayer = input.second->getCnnLayer();
+        if (!cnnLayer || cnnLayer->outData.empty())
+            continue;
+        const auto& tensorDesc = cnnLayer->outData[0]->getTensorDesc();
+        // inputs of precisions unsupported by mkldnn are converted by the infer request, their reorders are made at the first use
+        if (!one_of(tensorDesc.getPrecision(), Precision::FP32, Precision::I32, Precision::BF16, Precision::I8, Precision::U8,
+                    Precision::BOOL))
+            continue;
+        auto srcDesc = MKLDNNMemoryDesc{tensorDesc};
+        auto dstDesc = input.second->getChildEdgeAt(0)->getMemory().GetDesc();
+        if (srcDesc == dstDesc)
+            continue;
+        try {
+            GetInputReorder(input.first, srcDesc, dstDesc);
+        } catch (const mkldnn::error& err) {
+            // there is no reorder for these descriptors, pushing such input fails the same way at the first use
+            if (mkldnn_unimplemented != err.status)
+                throw;
+        }
+    }
+}
+
+MKLDNNReorder& MKLDNNGraph::GetInputReorder(const std::string& name, const MKLDNNMemoryDesc& srcDesc, const MKLDNNMemoryDesc& dstDesc) {
+    auto& reorders = inputReorders[name];
+    for (auto& reorder : reorders) {
+        if (reorder.isApplicable(srcDesc, dstDesc))
+            return reorder;
+    }
+    reorders.emplace_back(srcDesc, dstDesc, eng);
+    return reorders.back();
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
@@ -767,11 +848,17 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
 
         if (ext_data_ptr != inter_data_ptr) {
             auto ext_tdesc = MKLDNNMemoryDesc {in->getTensorDesc()};
+            auto& inter_mem = input->second->getChildEdgeAt(0)->getMemory();
 
-            auto ext_mem = MKLDNNMemory(eng);
-            ext_mem.Create(ext_tdesc, ext_data_ptr, false);
+            if (ext_tdesc == inter_mem.GetDesc()) {
+                auto ext_mem = MKLDNNMemory(eng);
+                ext_mem.Create(ext_tdesc, ext_data_ptr, false);
 
-            input->second->getChildEdgeAt(0)->getMemory().SetData(ext_mem, 0, false);
+                inter_mem.SetData(ext_mem, 0, false);
+            } else {
+                mkldnn::stream stream(eng);
+                GetInputReorder(name, ext_tdesc, inter_mem.GetDesc()).execute(stream, ext_data_ptr, inter_mem);
+            }
         }
 
         // todo: make sure 'name' exists in this map...
@@ -12,6 +12,7 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "threading/ie_thread_local.hpp"
+#include "utils/load_network_profile.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -159,6 +160,10 @@ public:
 
     void SortTopologically();
 
+    const LoadNetworkProfile& getInitProfile() const {
+        return initProfile;
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -171,6 +176,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        inputReorders.clear();
     }
     Status status { NotReady };
     Config config;
@@ -189,8 +195,14 @@ protected:
     std::vector<MKLDNNEdgePtr> graphEdges;
 
     std::map<std::string, MeanImage> _meanImages;
+    // reorders of user input blobs to the input edges memory per input name, they are created for the network inputs
+    // descriptors at the graph initialization and for unseen user blobs descriptors at the first use
+    std::map<std::string, std::vector<MKLDNNReorder>> inputReorders;
     std::string _name;
 
+    // durations of the last CreateGraph phases
+    LoadNetworkProfile initProfile;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -203,6 +215,8 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void CreateInputReorders();
+    MKLDNNReorder& GetInputReorder(const std::string& name, const MKLDNNMemoryDesc& srcDesc, const MKLDNNMemoryDesc& dstDesc);
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
 
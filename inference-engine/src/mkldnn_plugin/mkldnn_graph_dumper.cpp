@@ -8,6 +8,8 @@
 #include <ie_ngraph_utils.hpp>
 #include "exec_graph_info.hpp"
 #include "mkldnn_debug.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
+#include "nodes/mkldnn_memory_node.hpp"
 #include <ngraph/variant.hpp>
 #include "ngraph/ngraph.hpp"
 
@@ -286,6 +288,32 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    if (node->getType() == FullyConnected) {
+        auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+        if (fcNode && fcNode->getSparseWeights()) {
+            const auto &sparseWeights = fcNode->getSparseWeights();
+            serialization_info["weightsSparsity"] = std::to_string(fcNode->getWeightsSparsity());
+            serialization_info["weightsCompressionRatio"] =
+                std::to_string(static_cast<float>(sparseWeights->getDenseSize()) / sparseWeights->getPackedSize());
+        }
+        if (fcNode && fcNode->getWeightsDecompression()) {
+            const auto &weightsDecompression = fcNode->getWeightsDecompression();
+            serialization_info["weightsPrecision"] = weightsDecompression->getWeightsPrecision().name();
+            serialization_info["weightsCompressionRatio"] =
+                std::to_string(static_cast<float>(weightsDecompression->getDecompressedSize()) / weightsDecompression->getCompressedSize());
+        }
+        if (fcNode && fcNode->getDynamicQuantization()) {
+            serialization_info["dynamicQuantization"] =
+                fcNode->getDynamicQuantization()->getGranularity() == DynamicQuantization::PerRow ? "PER_ROW" : "PER_TENSOR";
+        }
+    }
+
+    if (node->getType() == MemoryInput) {
+        auto *memoryInputNode = dynamic_cast<MKLDNNMemoryInputNode *>(node.get());
+        if (memoryInputNode)
+            serialization_info["stateInPlace"] = memoryInputNode->isStateInPlace() ? "YES" : "NO";
+    }
+
     return serialization_info;
 }
 
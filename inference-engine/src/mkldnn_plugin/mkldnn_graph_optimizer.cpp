@@ -11,6 +11,7 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
@@ -40,6 +41,9 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
 
 #include "mkldnn_itt.h"
 
@@ -70,6 +74,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
 
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     FuseConvolutionAndDepthwise(graph);
     graph.RemoveDroppedNodes();
 
@@ -641,8 +648,12 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+        if (node->getType() != FullyConnected || node->getChildEdges().size() != 1)
+            return false;
+
+        // weights decompression kernel doesn't support post operations
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+        return fcNode == nullptr || !fcNode->withWeightsDecompression();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
@@ -744,6 +755,130 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // Weights are kept compressed by DisableCompressedWeightsConstantFolding under the same conditions, so every
+    // FullyConnected with not folded weights decompression is fused here. The fusing goes before the other
+    // FullyConnected fusings, so the node has no fused operations yet.
+    auto isSutableFullyConnectedNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != FullyConnected || node->getParentEdges().size() < 2)
+            return false;
+
+        auto srcDims = node->getParentEdgesAtPort(0)[0]->getDims();
+        auto weightsDims = node->getParentEdgesAtPort(1)[0]->getDims();
+        return one_of(srcDims.ndims(), 2, 3) && weightsDims.ndims() == 2 &&
+               node->getCnnLayer()->insData[0].lock()->getPrecision() == Precision::FP32;
+    };
+
+    auto isConstInput = [](MKLDNNNodePtr node) {
+        return node->getType() == Input && node->getCnnLayer() && node->getCnnLayer()->type == "Const" &&
+               node->getCnnLayer()->blobs.size() == 1;
+    };
+
+    // Returns per output channel values of the constant [OC, 1] or scalar, empty vector otherwise
+    auto getPerChannelValues = [&](MKLDNNNodePtr node, size_t OC) -> std::vector<float> {
+        if (!isConstInput(node))
+            return {};
+
+        auto blob = node->getCnnLayer()->blobs.begin()->second;
+        auto dims = blob->getTensorDesc().getDims();
+        if (blob->getTensorDesc().getPrecision() != Precision::FP32 ||
+            !(blob->size() == 1 || (dims.size() == 2 && dims[0] == OC && dims[1] == 1)))
+            return {};
+
+        auto data = blob->cbuffer().as<const float*>();
+        return blob->size() == 1 ? std::vector<float>(OC, data[0]) : std::vector<float>(data, data + OC);
+    };
+
+    for (auto &node : graphNodes) {
+        if (!isSutableFullyConnectedNode(node))
+            continue;
+
+        const size_t OC = node->getParentEdgesAtPort(1)[0]->getDims()[0];
+
+        // Decompression operations are collected from the FullyConnected up to the weights and composed
+        // into the single affine transformation w = q * scales[oc] + shifts[oc]
+        std::vector<float> scales(OC, 1.f), shifts(OC, 0.f);
+        std::vector<std::pair<MKLDNNNodePtr, MKLDNNEdgePtr>> decompressionNodes;
+
+        auto parent = node->getParentEdgesAtPort(1)[0]->getParent();
+        while (parent->getType() == Eltwise && parent->getChildEdges().size() == 1 && parent->getFusedWith().empty()) {
+            auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(parent.get());
+            if (eltwiseNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot cast " << parent->getName() << " to Eltwise node";
+
+            std::vector<float> multipliers, addends;
+            MKLDNNEdgePtr constEdge;
+            MKLDNNNodePtr dataParent;
+            if (eltwiseNode->getOpType() == PowerStatic && parent->getParentEdges().size() == 1) {
+                if (eltwiseNode->getAlpha() != 1.f)
+                    break;
+                multipliers.assign(OC, eltwiseNode->getBeta());
+                addends.assign(OC, eltwiseNode->getGamma());
+                dataParent = parent->getParentEdgesAtPort(0)[0]->getParent();
+            } else if (IsOneOf(eltwiseNode->getOpType(), {Add, Subtract, Multiply}) && parent->getParentEdges().size() == 2) {
+                // Subtract is not commutative, so constant has to be its second input
+                size_t constPort = 1;
+                auto values = getPerChannelValues(parent->getParentEdgesAtPort(constPort)[0]->getParent(), OC);
+                if (values.empty() && eltwiseNode->getOpType() != Subtract) {
+                    constPort = 0;
+                    values = getPerChannelValues(parent->getParentEdgesAtPort(constPort)[0]->getParent(), OC);
+                }
+                if (values.empty())
+                    break;
+
+                if (eltwiseNode->getOpType() == Multiply) {
+                    multipliers = values;
+                    addends.assign(OC, 0.f);
+                } else {
+                    multipliers.assign(OC, 1.f);
+                    addends = values;
+                    if (eltwiseNode->getOpType() == Subtract)
+                        std::transform(addends.begin(), addends.end(), addends.begin(), std::negate<float>());
+                }
+                constEdge = parent->getParentEdgesAtPort(constPort)[0];
+                dataParent = parent->getParentEdgesAtPort(1 - constPort)[0]->getParent();
+            } else {
+                break;
+            }
+
+            // w = scales * (multipliers * q + addends) + shifts
+            for (size_t oc = 0; oc < OC; oc++) {
+                shifts[oc] += scales[oc] * addends[oc];
+                scales[oc] *= multipliers[oc];
+            }
+            decompressionNodes.emplace_back(parent, constEdge);
+            parent = dataParent;
+        }
+
+        if (decompressionNodes.empty() || parent->getType() != Convert || parent->getChildEdges().size() != 1)
+            continue;
+
+        auto convert = parent;
+        auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstInput(weights) ||
+            !one_of(weights->getCnnLayer()->outData[0]->getPrecision(), Precision::U8, Precision::I8) ||
+            convert->getParentEdgesAtPort(0)[0]->getDims() != node->getParentEdgesAtPort(1)[0]->getDims())
+            continue;
+
+        for (auto &decompressionNode : decompressionNodes) {
+            auto& constEdge = decompressionNode.second;
+            if (constEdge) {
+                constEdge->drop();
+                removeEdge(graph, constEdge);
+            }
+            graph.DropNode(decompressionNode.first);
+        }
+        graph.DropNode(convert);
+
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+        if (fcNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot cast " << node->getName() << " to FullyConnected node";
+        fcNode->setWeightsDecompression(std::move(scales), std::move(shifts));
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
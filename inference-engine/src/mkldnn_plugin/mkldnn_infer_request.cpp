@@ -17,7 +17,6 @@
 #include "nodes/common/cpu_convert.h"
 #include "mkldnn_memory_state.h"
 #include "nodes/mkldnn_memory_node.hpp"
-#include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_async_infer_request.h"
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
@@ -140,38 +139,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::BindStates() {
+    // the graph works with the state buffers of this request directly, so states are neither copied to the graph
+    // before inference nor back after it
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
-    }
-}
-
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    cur_node->bindState(state->GetState()->cbuffer().as<void*>());
                 }
             }
         }
@@ -196,15 +173,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
+        BindStates();
     }
 
     graph->Infer(this, m_curBatch);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
-    }
-
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
@@ -49,8 +49,7 @@ public:
 
 private:
     void PushInputData();
-    void PushStates();
-    void PullStates();
+    void BindStates();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
@@ -135,6 +135,39 @@ void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &ou
     }
 }
 
+MKLDNNReorder::MKLDNNReorder(const MKLDNNMemoryDesc& srcDesc, const MKLDNNMemoryDesc& dstDesc, const mkldnn::engine& eng) :
+    srcDesc(srcDesc), dstDesc(dstDesc) {
+    memory dstMemory(dstDesc, eng, DNNL_MEMORY_NONE);
+    srcMemory = memory(srcDesc, eng, DNNL_MEMORY_NONE);
+    try {
+        reorder = mkldnn::reorder(srcMemory, dstMemory);
+    }
+    catch (const mkldnn::error& err) {
+        if (mkldnn_unimplemented == err.status && srcDesc.getDataType() != dstDesc.getDataType()) {
+            // the same fallback as reorderData() does, data is converted by cpu_convert first
+            auto dims = srcDesc.getDims();
+            convertSrc = true;
+            convertedData.resize(dims.size() * MKLDNNExtensionUtils::sizeOfDataType(dstDesc.getDataType()));
+            srcMemory = memory(MKLDNNMemoryDesc(dims, dstDesc.getDataType(), srcDesc.getFormat()), eng, convertedData.data());
+            reorder = mkldnn::reorder(srcMemory, dstMemory);
+        } else {
+            throw;
+        }
+    }
+}
+
+void MKLDNNReorder::execute(const mkldnn::stream& stream, const void* srcData, const MKLDNNMemory& dst) {
+    if (convertSrc) {
+        auto srcPtr = static_cast<const uint8_t*>(srcData) +
+            static_cast<mkldnn::memory::desc>(srcDesc).data.offset0 * srcDesc.GetElementSize();
+        cpu_convert(srcPtr, convertedData.data(), MKLDNNExtensionUtils::DataTypeToIEPrecision(srcDesc.getDataType()),
+                    MKLDNNExtensionUtils::DataTypeToIEPrecision(dstDesc.getDataType()), srcDesc.getDims().size());
+    } else {
+        srcMemory.set_data_handle_no_pads_proc(const_cast<void*>(srcData));
+    }
+    reorder.execute(stream, srcMemory, *dst.GetPrimitivePtr());
+}
+
 // TODO: It should be done via wrap into Memory;
 void MKLDNNMemory::SetData(memory::data_type dataType, memory::format_tag format, const void* data, size_t size, bool ftz) const {
     IE_ASSERT(!one_of(format, memory::format_tag::undef, memory::format_tag::any));
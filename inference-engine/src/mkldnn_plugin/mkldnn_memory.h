@@ -173,4 +173,28 @@ private:
 
 using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
 
+/**
+ * Reorder from memory with the source descriptor to memory with the destination descriptor.
+ * The primitive is created once and executed for different source data and destination memories.
+ */
+class MKLDNNReorder {
+public:
+    MKLDNNReorder(const MKLDNNMemoryDesc& srcDesc, const MKLDNNMemoryDesc& dstDesc, const mkldnn::engine& eng);
+
+    bool isApplicable(const MKLDNNMemoryDesc& srcDesc, const MKLDNNMemoryDesc& dstDesc) const {
+        return this->srcDesc == srcDesc && this->dstDesc == dstDesc;
+    }
+
+    void execute(const mkldnn::stream& stream, const void* srcData, const MKLDNNMemory& dst);
+
+private:
+    MKLDNNMemoryDesc srcDesc;
+    MKLDNNMemoryDesc dstDesc;
+    mkldnn::memory srcMemory;
+    mkldnn::reorder reorder;
+    // source data converted to the destination precision, if there is no reorder converting the precisions
+    bool convertSrc = false;
+    std::vector<uint8_t> convertedData;
+};
+
 }  // namespace MKLDNNPlugin
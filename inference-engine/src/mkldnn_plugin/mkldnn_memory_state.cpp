@@ -19,6 +19,18 @@ void  MKLDNNVariableState::Reset() {
 }
 
 void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
+    // the blob becomes the state buffer itself, the graph reads and updates it in place
+    if (!newState || newState->buffer() == nullptr)
+        THROW_IE_EXCEPTION << "Cannot set state " << name << ": blob has no allocated memory";
+    const auto& newDesc = newState->getTensorDesc();
+    const auto& desc = storage->getTensorDesc();
+    if (newDesc.getPrecision() != desc.getPrecision())
+        THROW_IE_EXCEPTION << "Cannot set state " << name << ": blob precision " << newDesc.getPrecision()
+                           << " doesn't match state precision " << desc.getPrecision();
+    if (newDesc.getDims() != desc.getDims())
+        THROW_IE_EXCEPTION << "Cannot set state " << name << ": blob dimensions don't match state dimensions";
+    if (newDesc.getBlockingDesc() != desc.getBlockingDesc())
+        THROW_IE_EXCEPTION << "Cannot set state " << name << ": blob layout doesn't match state layout";
     storage = newState;
 }
 
@@ -137,6 +137,8 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceProd", ReduceProd},
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
+        { "Subgraph", Subgraph},
+        { "ScaledDotProductAttention", ScaledDotProductAttention},
 };
 
 Type TypeFromName(const std::string type) {
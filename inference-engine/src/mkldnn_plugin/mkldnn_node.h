@@ -85,7 +85,9 @@ enum Type {
     ReduceOr,
     ReduceProd,
     ReduceSum,
-    ReduceSumSquare
+    ReduceSumSquare,
+    Subgraph,
+    ScaledDotProductAttention
 };
 
 Type TypeFromName(const std::string type);
@@ -200,6 +202,10 @@ static std::string NameFromType(Type type) {
             return "ReduceSum";
         case ReduceSumSquare:
             return "ReduceSumSquare";
+        case Subgraph:
+            return "Subgraph";
+        case ScaledDotProductAttention:
+            return "ScaledDotProductAttention";
         default:
             return "Unknown";
     }
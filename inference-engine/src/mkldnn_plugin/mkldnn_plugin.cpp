@@ -6,10 +6,12 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_primitives_cache.hpp"
 #include "mkldnn_itt.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
+#include <chrono>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <vector>
@@ -35,6 +37,7 @@
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
 #include <transformations/common_optimizations/depth_to_space_fusion.hpp>
+#include <transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp>
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_space_to_depth.hpp>
 #include <transformations/op_conversions/convert_gelu.hpp>
@@ -68,12 +71,16 @@
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset6.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/pass_profiler.hpp>
+#include <ngraph/rt_info.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
 #include <transformations/low_precision/disable_convert_constant_folding_on_const_path.hpp>
+#include <transformations/low_precision/disable_compressed_weights_constant_folding.hpp>
 #include <low_precision/pull_reshape_through_dequantization.hpp>
 #include <low_precision/pull_transpose_through_dequantization.hpp>
 #include <low_precision/transformer.hpp>
@@ -82,8 +89,12 @@
 #include <low_precision/multiply_to_group_convolution.hpp>
 #include <low_precision/network_helper.hpp>
 
+#include <snippets/op/subgraph.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
+
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_quantize_node.h"
+#include "nodes/mkldnn_snippet_node.h"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -105,9 +116,10 @@ Engine::Engine() {
 Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUStreamsExecutor");
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
+    ExecutorManager::getInstance()->clear("CPUSharedStreamsExecutor");
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+static void Transformation(CNNNetwork& clonedNetwork, const Config& conf, LoadNetworkProfile& profile) {
     auto nGraphFunc = clonedNetwork.getFunction();
 
     ngraph::pass::Manager manager;
@@ -119,6 +131,11 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8 });
+    } else if (!conf.enforceBF16) {
+        // keep u8/i8 MatMul weights compressed, FullyConnected node decompresses them on the fly in FP32 only,
+        // see MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression
+        manager.register_pass<ngraph::pass::DisableCompressedWeightsConstantFolding>(
+            std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8 });
     }
 
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
@@ -151,6 +168,11 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         manager.register_pass<ngraph::pass::ConvertPrecision>(precision.first, precision.second);
     }
 
+    // quantized attention blocks are kept unfused to preserve the dequantization placement made by LPT
+    if (conf.enableAttentionFusion && !useLpt) {
+        manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+    }
+
     auto pass_config = manager.get_pass_config();
 
     using const_node_ptr = const std::shared_ptr<const ngraph::Node>;
@@ -245,11 +267,15 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         });
     }
 
-    manager.run_passes(nGraphFunc);
+    {
+        LoadNetworkProfile::Scope profilingScope(profile, "ngraph_transformations");
+        manager.run_passes(nGraphFunc);
+    }
 
     using namespace ngraph::pass::low_precision;
     if (useLpt) {
         OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "LowPrecisionTransformations");
+        LoadNetworkProfile::Scope profilingScope(profile, "low_precision_transformations");
 
         ngraph::pass::Manager manager;
         auto lptPrerequisites = manager.register_pass<ngraph::pass::GraphRewrite>();
@@ -277,6 +303,86 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     bool has_fake_quantize = ::ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc);
 
+    // snippets are generated for FP32, networks executed in BF16 keep Eltwise nodes with native BF16 support
+    if (conf.enableSnippets && !conf.enforceBF16 && !useLpt && !has_fake_quantize && with_cpu_x86_avx2()) {
+        LoadNetworkProfile::Scope profilingScope(profile, "snippets_tokenization");
+        // Eltwise chains following these operations are fused into them as post ops by MKLDNNGraphOptimizer,
+        // so they are not tokenized to keep those fusings
+        auto isFusingParent = [](const std::shared_ptr<const ngraph::Node>& node) -> bool {
+            return ngraph::is_type<ngraph::opset1::Convolution>(node) ||
+                   ngraph::is_type<ngraph::opset1::GroupConvolution>(node) ||
+                   ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ||
+                   ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node) ||
+                   ngraph::is_type<ngraph::opset1::BinaryConvolution>(node) ||
+                   ngraph::is_type<ngraph::opset1::DeformableConvolution>(node) ||
+                   ngraph::is_type<ngraph::opset1::MatMul>(node) ||
+                   ngraph::is_type<ngraph::opset2::MVN>(node) ||
+                   ngraph::is_type<ngraph::opset6::MVN>(node) ||
+                   ngraph::is_type<ngraph::opset1::NormalizeL2>(node) ||
+                   ngraph::is_type<ngraph::opset1::Interpolate>(node) ||
+                   ngraph::is_type<ngraph::opset4::Interpolate>(node);
+        };
+
+        auto isFusedIntoParent = [isFusingParent](const_node_ptr &node) -> bool {
+            std::vector<std::shared_ptr<const ngraph::Node>> stack = {node};
+            while (!stack.empty()) {
+                auto current = stack.back();
+                stack.pop_back();
+                for (const auto& input : current->input_values()) {
+                    auto parent = input.get_node_shared_ptr();
+                    if (ngraph::op::is_constant(parent))
+                        continue;
+                    if (isFusingParent(parent))
+                        return true;
+                    if (MKLDNNSnippetNode::isSupportedOperation(parent) && parent->get_output_size() == 1 &&
+                        parent->get_output_target_inputs(0).size() == 1)
+                        stack.push_back(parent);
+                }
+            }
+            return false;
+        };
+
+        ngraph::pass::Manager snippetsManager;
+        snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>(false, true);
+        snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph,
+                                                        ngraph::snippets::pass::AttachToSubgraph>(
+            [isFusedIntoParent](const_node_ptr &node) -> bool {
+                return !MKLDNNSnippetNode::isSupportedOperation(node) || isFusedIntoParent(node);
+            });
+        snippetsManager.run_passes(nGraphFunc);
+
+        // a single operation gains nothing from code generation, so it is executed by the node of its own type
+        for (const auto& op : nGraphFunc->get_ordered_ops()) {
+            auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+            if (!subgraph)
+                continue;
+
+            const auto body = subgraph->get_body();
+            std::shared_ptr<ngraph::Node> bodyOp;
+            size_t bodyOpsNum = 0;
+            for (const auto& bodyNode : body->get_ops()) {
+                if (ngraph::op::is_parameter(bodyNode) || ngraph::op::is_output(bodyNode) || ngraph::op::is_constant(bodyNode))
+                    continue;
+                bodyOp = bodyNode;
+                bodyOpsNum++;
+            }
+            if (bodyOpsNum != 1 || subgraph->get_output_size() != bodyOp->get_output_size())
+                continue;
+
+            ngraph::OutputVector inputs;
+            for (const auto& input : bodyOp->input_values()) {
+                auto parameter = ngraph::as_type_ptr<ngraph::opset1::Parameter>(input.get_node_shared_ptr());
+                inputs.push_back(parameter ? subgraph->input_value(body->get_parameter_index(parameter)) : input);
+            }
+            auto node = bodyOp->clone_with_new_inputs(inputs);
+            node->set_friendly_name(subgraph->get_friendly_name());
+            ngraph::copy_runtime_info(subgraph, node);
+            ngraph::replace_node(subgraph, node);
+        }
+    }
+
+    LoadNetworkProfile::Scope profilingScope(profile, "legacy_conversion");
+
     ngraph::pass::Manager legacyManager;
 
     legacyManager.register_pass<ngraph::pass::FakeQuantizeDecomposition>();
@@ -327,6 +433,17 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     }
 }
 
+static std::vector<std::string> FormatTransformationsProfile(const std::vector<ngraph::pass::PassProfile>& profiles) {
+    std::vector<std::string> report;
+    report.reserve(profiles.size());
+    for (const auto& profile : profiles) {
+        report.push_back(profile.name + "," + std::to_string(profile.depth) + "," +
+                         std::to_string(profile.time.count()) + "," +
+                         std::to_string(profile.nodes_visited) + "," + std::to_string(profile.rewrites));
+    }
+    return report;
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -360,11 +477,18 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    LoadNetworkProfile loadNetworkProfile;
+    auto cloneStart = std::chrono::steady_clock::now();
     CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
+    loadNetworkProfile.add("clone_network",
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - cloneStart));
 
     bool is_transformed = false;
+    std::vector<std::string> transformationsProfile;
     if (clonedNetwork.getFunction()) {
-        Transformation(clonedNetwork, conf);
+        ngraph::pass::PassProfiler profiler;
+        Transformation(clonedNetwork, conf, loadNetworkProfile);
+        transformationsProfile = FormatTransformationsProfile(profiler.get_profiles());
         is_transformed = true;
     }
     IE_SUPPRESS_DEPRECATED_START
@@ -373,6 +497,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
     if (implNetwork) {
         OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        LoadNetworkProfile::Scope profilingScope(loadNetworkProfile, "legacy_constant_folding");
         // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
         ConstTransformer transformator(implNetwork.get());
         transformator.fullTrim();
@@ -388,12 +513,23 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    execNetwork->setTransformationsProfile(transformationsProfile);
+    loadNetworkProfile.merge(execNetwork->getLoadNetworkProfile());
+    execNetwork->setLoadNetworkProfile(loadNetworkProfile);
+    {
+        std::lock_guard<std::mutex> lock{loadNetworkProfileMutex};
+        lastLoadNetworkProfile = loadNetworkProfile.format();
+    }
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    // the primitives cache is process wide, so only the engine level option changes its capacity
+    if (config.count(PluginConfigParams::KEY_CPU_PRIMITIVES_CACHE_CAPACITY))
+        MKLDNNPrimitivesCache::getInstance().setCapacity(static_cast<size_t>(engConfig.primitivesCacheCapacity));
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -431,6 +567,13 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(LOAD_NETWORK_PROFILE));
+        metrics.push_back(METRIC_KEY(WEIGHTS_CACHE_BYTES));
+        metrics.push_back(METRIC_KEY(WEIGHTS_CACHE_REUSED_BYTES));
+        metrics.push_back(METRIC_KEY(STREAMS_EXECUTORS_THREADS));
+        metrics.push_back(METRIC_KEY(PRIMITIVES_CACHE_HITS));
+        metrics.push_back(METRIC_KEY(PRIMITIVES_CACHE_MISSES));
+        metrics.push_back(METRIC_KEY(PRIMITIVES_CACHE_SIZE));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -477,6 +620,22 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(LOAD_NETWORK_PROFILE)) {
+        std::lock_guard<std::mutex> lock{loadNetworkProfileMutex};
+        IE_SET_METRIC_RETURN(LOAD_NETWORK_PROFILE, lastLoadNetworkProfile);
+    } else if (name == METRIC_KEY(WEIGHTS_CACHE_BYTES)) {
+        IE_SET_METRIC_RETURN(WEIGHTS_CACHE_BYTES, static_cast<uint64_t>(weightsSharing.getSharedBytes()));
+    } else if (name == METRIC_KEY(WEIGHTS_CACHE_REUSED_BYTES)) {
+        IE_SET_METRIC_RETURN(WEIGHTS_CACHE_REUSED_BYTES, static_cast<uint64_t>(weightsSharing.getReusedBytes()));
+    } else if (name == METRIC_KEY(STREAMS_EXECUTORS_THREADS)) {
+        auto threads = static_cast<unsigned int>(ExecutorManager::getInstance()->getStreamsThreadsNumber());
+        IE_SET_METRIC_RETURN(STREAMS_EXECUTORS_THREADS, threads);
+    } else if (name == METRIC_KEY(PRIMITIVES_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(PRIMITIVES_CACHE_HITS, MKLDNNPrimitivesCache::getInstance().getHits());
+    } else if (name == METRIC_KEY(PRIMITIVES_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(PRIMITIVES_CACHE_MISSES, MKLDNNPrimitivesCache::getInstance().getMisses());
+    } else if (name == METRIC_KEY(PRIMITIVES_CACHE_SIZE)) {
+        IE_SET_METRIC_RETURN(PRIMITIVES_CACHE_SIZE, static_cast<unsigned int>(MKLDNNPrimitivesCache::getInstance().getSize()));
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -505,7 +664,8 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
         }
 
         auto clonedNetwork = InferenceEngine::cloneNetwork(network);
-        Transformation(clonedNetwork, conf);
+        LoadNetworkProfile loadNetworkProfile;
+        Transformation(clonedNetwork, conf, loadNetworkProfile);
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
         for (details::CNNNetworkIterator itLayer{clonedNetwork}; itLayer != details::CNNNetworkIterator(); itLayer++) {
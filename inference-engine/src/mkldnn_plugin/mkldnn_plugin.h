@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include <mutex>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -40,6 +41,9 @@ private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
+    // Loading phases statistics of the last loaded network
+    std::vector<std::string> lastLoadNetworkProfile;
+    mutable std::mutex loadNetworkProfileMutex;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,158 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitives_cache.hpp"
+
+#include <dnnl_types.h>
+#include <common/primitive_attr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+namespace {
+template <typename T>
+void appendBytes(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+size_t getOpDescSize(dnnl_primitive_kind_t kind) {
+    switch (kind) {
+        case dnnl_convolution:
+        case dnnl_deconvolution:
+            return sizeof(dnnl_convolution_desc_t);
+        case dnnl_inner_product:
+            return sizeof(dnnl_inner_product_desc_t);
+        case dnnl_pooling:
+            return sizeof(dnnl_pooling_desc_t);
+        default:
+            // other primitives are cheap to create or keep a state
+            return 0;
+    }
+}
+
+bool appendAttr(std::string& key, const dnnl_primitive_attr& attr) {
+    const auto& scales = attr.output_scales_;
+    appendBytes(key, scales.mask_);
+    appendBytes(key, scales.count_);
+    if (scales.count_ > 0 && nullptr != scales.scales_)
+        key.append(reinterpret_cast<const char*>(scales.scales_), scales.count_ * sizeof(float));
+
+    const auto& p = attr.post_ops_;
+    appendBytes(key, p.len());
+    for (int i = 0; i < p.len(); i++) {
+        auto& post_op = p.entry_[i];
+        if (post_op.is_eltwise()) {
+            appendBytes(key, post_op.eltwise.alg);
+            appendBytes(key, post_op.eltwise.scale);
+            appendBytes(key, post_op.eltwise.alpha);
+            appendBytes(key, post_op.eltwise.beta);
+        } else if (post_op.is_sum()) {
+            appendBytes(key, post_op.sum.scale);
+        } else if (post_op.is_depthwise()) {
+            // the primitive refers to the post op data, so only the primitives of the same data are shared
+            appendBytes(key, post_op.depthwise.alg);
+            appendBytes(key, post_op.depthwise.weights_data);
+            appendBytes(key, post_op.depthwise.biases_data);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+MKLDNNPrimitivesCache& MKLDNNPrimitivesCache::getInstance() {
+    static MKLDNNPrimitivesCache cache;
+    return cache;
+}
+
+std::string MKLDNNPrimitivesCache::makeKey(const mkldnn::primitive_desc_base& pd) {
+    dnnl_primitive_kind_t kind = dnnl_undefined_primitive;
+    if (dnnl_success != dnnl_primitive_desc_query(pd.get(), dnnl_query_primitive_kind, 0, &kind))
+        return {};
+    auto opDescSize = getOpDescSize(kind);
+    const_dnnl_op_desc_t opDesc = nullptr;
+    if (0 == opDescSize ||
+        dnnl_success != dnnl_primitive_desc_query(pd.get(), dnnl_query_op_d, 0, &opDesc) || nullptr == opDesc)
+        return {};
+    const_dnnl_primitive_attr_t attr = nullptr;
+    if (dnnl_success != dnnl_primitive_desc_get_attr(pd.get(), &attr) || nullptr == attr)
+        return {};
+
+    // the operation descriptor is compared bytewise, so the key is never the same for different operations
+    std::string key(reinterpret_cast<const char*>(opDesc), opDescSize);
+    // implementation name and memory formats chosen by the primitive descriptor
+    key += pd.impl_info_str();
+    if (!appendAttr(key, *attr))
+        return {};
+    return key;
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNPrimitivesCache::findOrCreate(const std::string& key,
+                                                                       std::function<std::shared_ptr<mkldnn::primitive>(void)> create) {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = index.find(key);
+        if (found != index.end()) {
+            hits++;
+            entries.splice(entries.begin(), entries, found->second);
+            return found->second->second;
+        }
+        misses++;
+    }
+
+    // JIT code generation is not serialized between threads
+    auto primitive = create();
+
+    std::lock_guard<std::mutex> lock(guard);
+    if (0 == capacity)
+        return primitive;
+    auto found = index.find(key);
+    if (found != index.end()) {
+        // the same primitive was created by other thread meanwhile
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->second;
+    }
+    entries.emplace_front(key, primitive);
+    index.emplace(key, entries.begin());
+    evict();
+    return primitive;
+}
+
+void MKLDNNPrimitivesCache::evict() {
+    while (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+void MKLDNNPrimitivesCache::setCapacity(size_t newCapacity) {
+    std::lock_guard<std::mutex> lock(guard);
+    capacity = newCapacity;
+    evict();
+}
+
+size_t MKLDNNPrimitivesCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return capacity;
+}
+
+size_t MKLDNNPrimitivesCache::getSize() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return entries.size();
+}
+
+uint64_t MKLDNNPrimitivesCache::getHits() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return hits;
+}
+
+uint64_t MKLDNNPrimitivesCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return misses;
+}
+
+}  // namespace MKLDNNPlugin
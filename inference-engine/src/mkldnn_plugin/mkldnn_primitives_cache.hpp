@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process wide LRU cache of mkldnn primitives shared by all graphs, streams and networks, so identical
+ * layers of different graphs reuse the primitive and its JIT generated code instead of the generation per graph.
+ * Primitives are looked up by the key made of the primitive descriptor and its attributes.
+ * Evicted primitives stay alive while graphs use them.
+ *
+ * Is a thread safe
+ */
+class MKLDNNPrimitivesCache {
+public:
+    static constexpr size_t defaultCapacity = 1024;
+
+    static MKLDNNPrimitivesCache& getInstance();
+
+    /**
+     * @brief Makes a cache key of the primitive descriptor
+     * @return Empty string if the primitive can't be cached, e.g. the primitive kind or attributes are not supported
+     */
+    static std::string makeKey(const mkldnn::primitive_desc_base& pd);
+
+    std::shared_ptr<mkldnn::primitive> findOrCreate(const std::string& key,
+                                                    std::function<std::shared_ptr<mkldnn::primitive>(void)> create);
+
+    template <typename Primitive, typename PrimitiveDesc>
+    std::shared_ptr<mkldnn::primitive> findOrCreate(const PrimitiveDesc& pd) {
+        auto create = [&pd] {
+            return std::shared_ptr<mkldnn::primitive>(new Primitive(pd));
+        };
+        auto key = makeKey(pd);
+        if (key.empty())
+            return create();
+        return findOrCreate(key, create);
+    }
+
+    /**
+     * @brief Sets maximal number of cached primitives, least recently used ones are evicted. 0 disables the cache
+     */
+    void setCapacity(size_t capacity);
+    size_t getCapacity() const;
+
+    size_t getSize() const;
+    uint64_t getHits() const;
+    uint64_t getMisses() const;
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<mkldnn::primitive>>;
+
+    void evict();
+
+    mutable std::mutex guard;
+    size_t capacity = defaultCapacity;
+    // the most recently used entries go first
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+}  // namespace MKLDNNPlugin
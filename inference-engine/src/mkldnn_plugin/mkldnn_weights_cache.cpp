@@ -48,6 +48,8 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
         newPtr = create();
         ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
         sharedWeights[key] = ptr;
+    } else if (auto sharedMemory = ptr->sharedMemory.lock()) {
+        reusedBytes += sharedMemory->GetSize();
     }
 
     return std::make_shared<MKLDNNSharedMemory>(ptr->valid
@@ -71,6 +73,23 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr);
 }
 
+size_t MKLDNNWeightsSharing::getSharedBytes() const {
+    std::unique_lock<std::mutex> lock(guard);
+    size_t sharedBytes = 0;
+    for (const auto& weights : sharedWeights) {
+        if (!weights.second)
+            continue;
+        if (auto sharedMemory = weights.second->sharedMemory.lock())
+            sharedBytes += sharedMemory->GetSize();
+    }
+    return sharedBytes;
+}
+
+size_t MKLDNNWeightsSharing::getReusedBytes() const {
+    std::unique_lock<std::mutex> lock(guard);
+    return reusedBytes;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -90,4 +109,18 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+size_t NumaNodesWeights::getSharedBytes() const {
+    size_t sharedBytes = 0;
+    for (const auto& cache : _cache_map)
+        sharedBytes += cache.second->getSharedBytes();
+    return sharedBytes;
+}
+
+size_t NumaNodesWeights::getReusedBytes() const {
+    size_t reusedBytes = 0;
+    for (const auto& cache : _cache_map)
+        reusedBytes += cache.second->getReusedBytes();
+    return reusedBytes;
+}
+
 }  // namespace MKLDNNPlugin
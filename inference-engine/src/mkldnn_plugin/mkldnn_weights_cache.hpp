@@ -92,11 +92,22 @@ public:
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Returns size in bytes of memory objects stored in the cache and still used by graphs
+     */
+    size_t getSharedBytes() const;
+
+    /**
+     * @brief Returns size in bytes of memory objects which were found in the cache instead of creation
+     */
+    size_t getReusedBytes() const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
+    size_t reusedBytes = 0;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -112,6 +123,9 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    size_t getSharedBytes() const;
+    size_t getReusedBytes() const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
 };
@@ -0,0 +1,107 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_quantization.h"
+
+#include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include <mkldnn.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+constexpr int32_t srcZeroPoint = 128;
+constexpr float maxQuantized = 127.f;
+
+float absMax(const float* data, size_t size) {
+    float result = 0.f;
+    for (size_t i = 0; i < size; i++)
+        result = std::max(result, std::abs(data[i]));
+    return result;
+}
+
+float scaleByAbsMax(float value) {
+    return value > 0.f ? value / maxQuantized : 1.f;
+}
+}  // namespace
+
+DynamicQuantization::DynamicQuantization(const float* weights, size_t OC, size_t IC, std::vector<float> bias,
+                                         Granularity granularity)
+    : OC(OC), IC(IC), granularity(granularity), bias(std::move(bias)) {
+    if (!this->bias.empty() && this->bias.size() != OC)
+        THROW_IE_EXCEPTION << "Dynamic quantization got bias of size " << this->bias.size() << " while expected " << OC;
+
+    this->weights.resize(OC * IC);
+    weightsScales.resize(OC);
+    compensation.resize(OC);
+    parallel_for(OC, [&](size_t oc) {
+        const float* w = weights + oc * IC;
+        int8_t* q = this->weights.data() + oc * IC;
+        const float scale = scaleByAbsMax(absMax(w, IC));
+        int32_t sum = 0;
+        for (size_t ic = 0; ic < IC; ic++) {
+            q[ic] = static_cast<int8_t>(std::max(-maxQuantized, std::min(maxQuantized, std::nearbyint(w[ic] / scale))));
+            sum += q[ic];
+        }
+        weightsScales[oc] = scale;
+        compensation[oc] = srcZeroPoint * sum;
+    });
+}
+
+void DynamicQuantization::quantize(const float* src, uint8_t* dst, float* srcScales, size_t N, size_t IC,
+                                   Granularity granularity) {
+    auto quantizeRow = [&](size_t n, float scale) {
+        const float* s = src + n * IC;
+        uint8_t* d = dst + n * IC;
+        const float invScale = 1.f / scale;
+        for (size_t ic = 0; ic < IC; ic++) {
+            const float q = std::max(-maxQuantized, std::min(maxQuantized, std::nearbyint(s[ic] * invScale)));
+            d[ic] = static_cast<uint8_t>(static_cast<int32_t>(q) + srcZeroPoint);
+        }
+        srcScales[n] = scale;
+    };
+
+    if (granularity == PerRow) {
+        // the row is quantized right after its reduction while it is still in cache
+        parallel_for(N, [&](size_t n) {
+            quantizeRow(n, scaleByAbsMax(absMax(src + n * IC, IC)));
+        });
+    } else {
+        parallel_for(N, [&](size_t n) {
+            srcScales[n] = absMax(src + n * IC, IC);
+        });
+        const float scale = scaleByAbsMax(N ? *std::max_element(srcScales, srcScales + N) : 0.f);
+        parallel_for(N, [&](size_t n) {
+            quantizeRow(n, scale);
+        });
+    }
+}
+
+void DynamicQuantization::execute(const float* src, float* dst, size_t N) {
+    srcQuantized.resize(N * IC);
+    srcScales.resize(N);
+    quantize(src, srcQuantized.data(), srcScales.data(), N, IC, granularity);
+
+    // int32 accumulators are stored to dst and converted to FP32 in place
+    const int32_t co = 0;
+    auto acc = reinterpret_cast<int32_t*>(dst);
+    mkldnn_gemm_u8s8s32('N', 'T', 'F', N, OC, IC, 1.f, srcQuantized.data(), IC, 0, weights.data(), IC, 0,
+                        0.f, acc, OC, &co);
+
+    parallel_for(N, [&](size_t n) {
+        const float srcScale = srcScales[n];
+        for (size_t oc = 0; oc < OC; oc++) {
+            const float b = bias.empty() ? 0.f : bias[oc];
+            dst[n * OC + oc] = static_cast<float>(acc[n * OC + oc] - compensation[oc]) * srcScale * weightsScales[oc] + b;
+        }
+    });
+}
+
+}  // namespace MKLDNNPlugin
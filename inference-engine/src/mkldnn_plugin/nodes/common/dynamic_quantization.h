@@ -0,0 +1,55 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * FullyConnected with FP32 source and weights [OC, IC] executed by INT8 GEMM. Weights are quantized once
+ * to I8 with symmetric per output channel scales. Source is quantized on every execution to U8 with zero point 128
+ * and a scale computed from its absolute maximum for the whole tensor or for every row.
+ * Computes dst[N, OC] = src[N, IC] * weights^T + bias.
+ */
+class DynamicQuantization {
+public:
+    enum Granularity {
+        PerTensor,
+        PerRow,
+    };
+
+    /**
+     * @param weights Dense FP32 weights [OC, IC]
+     * @param bias Bias [OC], empty if the layer has no bias
+     */
+    DynamicQuantization(const float* weights, size_t OC, size_t IC, std::vector<float> bias, Granularity granularity);
+
+    /**
+     * @brief Quantizes src rows [N, IC] to U8 with zero point 128, scales of rows are stored to srcScales [N]
+     */
+    static void quantize(const float* src, uint8_t* dst, float* srcScales, size_t N, size_t IC, Granularity granularity);
+
+    void execute(const float* src, float* dst, size_t N);
+
+    Granularity getGranularity() const {
+        return granularity;
+    }
+
+private:
+    size_t OC, IC;
+    Granularity granularity;
+    std::vector<int8_t> weights;
+    std::vector<float> weightsScales;
+    // sums of quantized weights rows multiplied by the source zero point
+    std::vector<int32_t> compensation;
+    std::vector<float> bias;
+    std::vector<uint8_t> srcQuantized;
+    std::vector<float> srcScales;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,150 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_attention.h"
+
+#include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include <mkldnn.hpp>
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+constexpr size_t FusedAttention::qBlock;
+constexpr size_t FusedAttention::kBlock;
+
+namespace {
+// Returns rows x cols FP32 matrix with leading dimension ld, FP32 data is used in place
+const float* toFloat(const float* src, size_t /* rows */, size_t /* cols */, size_t stride, float* /* buffer */, size_t& ld) {
+    ld = stride;
+    return src;
+}
+
+const float* toFloat(const bfloat16_t* src, size_t rows, size_t cols, size_t stride, float* buffer, size_t& ld) {
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++)
+            buffer[r * cols + c] = static_cast<float>(src[r * stride + c]);
+    }
+    ld = cols;
+    return buffer;
+}
+}  // namespace
+
+FusedAttention::FusedAttention(size_t B, size_t H, size_t Lq, size_t Lk, size_t D, size_t Dv, float scale, bool transposeK,
+                               std::vector<size_t> maskStrides)
+    : B(B), H(H), Lq(Lq), Lk(Lk), D(D), Dv(Dv), scale(scale), transposeK(transposeK), maskStrides(std::move(maskStrides)) {
+    if (!this->maskStrides.empty() && this->maskStrides.size() != 4)
+        THROW_IE_EXCEPTION << "Fused attention expects 4 mask strides, got " << this->maskStrides.size();
+}
+
+std::vector<size_t> FusedAttention::getBroadcastStrides(const std::vector<size_t>& maskDims) {
+    if (maskDims.size() > 4)
+        THROW_IE_EXCEPTION << "Fused attention doesn't support mask of rank " << maskDims.size();
+    // the mask is aligned to the innermost dimensions of [B, H, Lq, Lk]
+    std::vector<size_t> dims(4 - maskDims.size(), 1);
+    dims.insert(dims.end(), maskDims.begin(), maskDims.end());
+    std::vector<size_t> strides(4, 0);
+    size_t stride = 1;
+    for (int i = 3; i >= 0; i--) {
+        strides[i] = dims[i] == 1 ? 0 : stride;
+        stride *= dims[i];
+    }
+    return strides;
+}
+
+template <typename data_t>
+void FusedAttention::execute(const data_t* q, const data_t* k, const data_t* v, const float* mask, data_t* dst) {
+    const float lowest = -std::numeric_limits<float>::infinity();
+
+    // per thread scratch: scores tile, output accumulator, row maxima and sums, tiles of q, k and v converted to FP32
+    const size_t scratchSize = qBlock * kBlock + qBlock * Dv + 2 * qBlock + qBlock * D + kBlock * D + kBlock * Dv;
+    scratch.resize(std::max(scratch.size(), static_cast<size_t>(parallel_get_max_threads()) * scratchSize));
+
+    parallel_for3d(B, H, div_up(Lq, qBlock), [&](size_t b, size_t h, size_t qb) {
+        const size_t bh = b * H + h;
+        const size_t q0 = qb * qBlock;
+        const size_t rows = std::min(qBlock, Lq - q0);
+
+        float* scores = &scratch[parallel_get_thread_num() * scratchSize];
+        float* acc = scores + qBlock * kBlock;
+        float* rowMax = acc + qBlock * Dv;
+        float* rowSum = rowMax + qBlock;
+        float* qBuffer = rowSum + qBlock;
+        float* kBuffer = qBuffer + qBlock * D;
+        float* vBuffer = kBuffer + kBlock * D;
+        std::fill(acc, acc + rows * Dv, 0.f);
+        std::fill(rowMax, rowMax + rows, lowest);
+        std::fill(rowSum, rowSum + rows, 0.f);
+
+        size_t ldq = 0;
+        const float* qTile = toFloat(q + (bh * Lq + q0) * D, rows, D, D, qBuffer, ldq);
+
+        for (size_t k0 = 0; k0 < Lk; k0 += kBlock) {
+            const size_t cols = std::min(kBlock, Lk - k0);
+
+            // scores tile [rows, cols] = q * k^T * scale + mask
+            size_t ldk = 0;
+            const float* kTile = transposeK ? toFloat(k + (bh * Lk + k0) * D, cols, D, D, kBuffer, ldk)
+                                            : toFloat(k + bh * D * Lk + k0, D, cols, Lk, kBuffer, ldk);
+            mkldnn_sgemm('N', transposeK ? 'T' : 'N', rows, cols, D, scale, qTile, ldq, kTile, ldk, 0.f, scores, kBlock);
+            if (mask) {
+                const float* m = mask + b * maskStrides[0] + h * maskStrides[1] + k0 * maskStrides[3];
+                for (size_t i = 0; i < rows; i++) {
+                    for (size_t j = 0; j < cols; j++)
+                        scores[i * kBlock + j] += m[(q0 + i) * maskStrides[2] + j * maskStrides[3]];
+                }
+            }
+
+            // online softmax: the accumulated part is rescaled if the row maximum grows
+            for (size_t i = 0; i < rows; i++) {
+                float* s = &scores[i * kBlock];
+                const float newMax = std::max(rowMax[i], *std::max_element(s, s + cols));
+                if (newMax == lowest) {
+                    // the row is fully masked so far
+                    std::fill(s, s + cols, 0.f);
+                    continue;
+                }
+                const float correction = std::exp(rowMax[i] - newMax);
+                rowMax[i] = newMax;
+
+                float sum = 0.f;
+                for (size_t j = 0; j < cols; j++) {
+                    s[j] = std::exp(s[j] - newMax);
+                    sum += s[j];
+                }
+                rowSum[i] = rowSum[i] * correction + sum;
+
+                float* a = &acc[i * Dv];
+                for (size_t dv = 0; dv < Dv; dv++)
+                    a[dv] *= correction;
+            }
+
+            // acc [rows, Dv] += probabilities [rows, cols] * v
+            size_t ldv = 0;
+            const float* vTile = toFloat(v + (bh * Lk + k0) * Dv, cols, Dv, Dv, vBuffer, ldv);
+            mkldnn_sgemm('N', 'N', rows, Dv, cols, 1.f, scores, kBlock, vTile, ldv, 1.f, acc, Dv);
+        }
+
+        data_t* out = dst + (bh * Lq + q0) * Dv;
+        for (size_t i = 0; i < rows; i++) {
+            const float norm = rowSum[i] > 0.f ? 1.f / rowSum[i] : 0.f;
+            for (size_t dv = 0; dv < Dv; dv++)
+                out[i * Dv + dv] = static_cast<data_t>(acc[i * Dv + dv] * norm);
+        }
+    });
+}
+
+template void FusedAttention::execute<float>(const float*, const float*, const float*, const float*, float*);
+template void FusedAttention::execute<bfloat16_t>(const bfloat16_t*, const bfloat16_t*, const bfloat16_t*, const float*,
+                                                  bfloat16_t*);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,54 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Computes dst = softmax(q * k^T * scale + mask) * v for every batch and head without materializing
+ * the [Lq, Lk] scores matrix. Queries are processed by blocks of qBlock rows and keys by blocks of kBlock
+ * columns: a scores tile is computed, exponentiated against a running row maximum and accumulated into
+ * the output block, which is rescaled every time the maximum grows (online softmax).
+ *
+ * q is [B, H, Lq, D], k is [B, H, Lk, D] if transposeK is true and [B, H, D, Lk] otherwise, v is [B, H, Lk, Dv]
+ * and dst is [B, H, Lq, Dv], all in plain layout. Data is processed in FP32 regardless of its storage precision,
+ * the tiles are multiplied by sgemm.
+ */
+class FusedAttention {
+public:
+    static constexpr size_t qBlock = 32;
+    static constexpr size_t kBlock = 64;
+
+    /**
+     * @param maskStrides Element strides of the mask broadcasted to [B, H, Lq, Lk] (zero for broadcasted
+     * dimensions), empty if there is no mask
+     */
+    FusedAttention(size_t B, size_t H, size_t Lq, size_t Lk, size_t D, size_t Dv, float scale, bool transposeK,
+                   std::vector<size_t> maskStrides);
+
+    /**
+     * @brief Computes strides of the mask of the given shape broadcasted to [B, H, Lq, Lk] by numpy rules
+     */
+    static std::vector<size_t> getBroadcastStrides(const std::vector<size_t>& maskDims);
+
+    /**
+     * @tparam data_t float or bfloat16_t
+     */
+    template <typename data_t>
+    void execute(const data_t* q, const data_t* k, const data_t* v, const float* mask, data_t* dst);
+
+private:
+    size_t B, H, Lq, Lk, D, Dv;
+    float scale;
+    bool transposeK;
+    std::vector<size_t> maskStrides;
+    // per thread buffers, so executions of the same object mustn't overlap
+    std::vector<float> scratch;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,158 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_weights.h"
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+constexpr size_t SparseWeights::srcBlock;
+constexpr size_t SparseWeights::ocBlock;
+
+SparseWeights::SparseWeights(const uint8_t* packed, Precision weightsPrc, Precision srcPrc,
+                             size_t OC, size_t IC, std::vector<float> bias)
+    : weightsPrc(weightsPrc), srcPrc(srcPrc), OC(OC), IC(IC), bias(std::move(bias)) {
+    if (!isSupported(srcPrc, weightsPrc))
+        THROW_IE_EXCEPTION << "Sparse weights don't support " << srcPrc << " source and " << weightsPrc << " weights";
+    if (!this->bias.empty() && this->bias.size() != OC)
+        THROW_IE_EXCEPTION << "Sparse weights got bias of size " << this->bias.size() << " while expected " << OC;
+
+    rowOffsets = reinterpret_cast<const int32_t*>(packed);
+    columns = rowOffsets + OC + 1;
+    values = reinterpret_cast<const uint8_t*>(columns + rowOffsets[OC]);
+}
+
+bool SparseWeights::isSupported(Precision srcPrc, Precision weightsPrc) {
+    return (srcPrc == Precision::FP32 && weightsPrc == Precision::FP32) ||
+           (one_of(srcPrc, Precision::U8, Precision::I8) && weightsPrc == Precision::I8);
+}
+
+namespace {
+size_t countZeros(const void* weights, Precision weightsPrc, size_t size) {
+    if (weightsPrc == Precision::FP32) {
+        auto data = static_cast<const float*>(weights);
+        return std::count(data, data + size, 0.f);
+    } else if (weightsPrc == Precision::I8) {
+        auto data = static_cast<const int8_t*>(weights);
+        return std::count(data, data + size, static_cast<int8_t>(0));
+    }
+    return 0;
+}
+}  // namespace
+
+float SparseWeights::getSparsity(const void* weights, Precision weightsPrc, size_t size) {
+    if (size == 0)
+        return 0.f;
+    return static_cast<float>(countZeros(weights, weightsPrc, size)) / size;
+}
+
+size_t SparseWeights::getPackedSize(const void* weights, Precision weightsPrc, size_t OC, size_t IC) {
+    if (OC * IC > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        THROW_IE_EXCEPTION << "Sparse weights are too large";
+    const size_t nonZeros = OC * IC - countZeros(weights, weightsPrc, OC * IC);
+    return (OC + 1 + nonZeros) * sizeof(int32_t) + nonZeros * weightsPrc.size();
+}
+
+void SparseWeights::pack(const void* weights, Precision weightsPrc, size_t OC, size_t IC, uint8_t* packed) {
+    if (weightsPrc == Precision::FP32)
+        pack(static_cast<const float*>(weights), OC, IC, packed);
+    else if (weightsPrc == Precision::I8)
+        pack(static_cast<const int8_t*>(weights), OC, IC, packed);
+    else
+        THROW_IE_EXCEPTION << "Sparse weights don't support " << weightsPrc << " weights";
+}
+
+template <typename wei_t>
+void SparseWeights::pack(const wei_t* weights, size_t OC, size_t IC, uint8_t* packed) {
+    auto offsets = reinterpret_cast<int32_t*>(packed);
+    // the number of non zero values is known only after the first pass, so values are placed at the end
+    int32_t nonZeros = 0;
+    offsets[0] = 0;
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t ic = 0; ic < IC; ic++)
+            nonZeros += weights[oc * IC + ic] != 0;
+        offsets[oc + 1] = nonZeros;
+    }
+    auto columns = offsets + OC + 1;
+    auto values = reinterpret_cast<wei_t*>(columns + nonZeros);
+    for (size_t oc = 0; oc < OC; oc++) {
+        int32_t i = offsets[oc];
+        for (size_t ic = 0; ic < IC; ic++) {
+            auto value = weights[oc * IC + ic];
+            if (value != 0) {
+                columns[i] = static_cast<int32_t>(ic);
+                values[i] = value;
+                i++;
+            }
+        }
+    }
+}
+
+template <typename src_t, typename wei_t, typename acc_t>
+void SparseWeights::calculate(const src_t* src, float* dst, size_t N) {
+    const size_t nBlocks = div_up(N, srcBlock);
+    srcTransposed.resize(nBlocks * IC * srcBlock * sizeof(src_t));
+    auto transposed = reinterpret_cast<src_t*>(srcTransposed.data());
+
+    // [N, IC] -> [N / srcBlock, IC, srcBlock], the tail block is padded by zeros
+    parallel_for(nBlocks, [&](size_t nb) {
+        auto blockSrc = src + nb * srcBlock * IC;
+        auto blockDst = transposed + nb * IC * srcBlock;
+        const size_t rows = std::min(srcBlock, N - nb * srcBlock);
+        for (size_t ic = 0; ic < IC; ic++) {
+            for (size_t r = 0; r < rows; r++)
+                blockDst[ic * srcBlock + r] = blockSrc[r * IC + ic];
+            for (size_t r = rows; r < srcBlock; r++)
+                blockDst[ic * srcBlock + r] = 0;
+        }
+    });
+
+    auto weights = reinterpret_cast<const wei_t*>(values);
+    parallel_for2d(nBlocks, div_up(OC, ocBlock), [&](size_t nb, size_t ocb) {
+        auto blockSrc = transposed + nb * IC * srcBlock;
+        const size_t rows = std::min(srcBlock, N - nb * srcBlock);
+        const size_t ocEnd = std::min(OC, (ocb + 1) * ocBlock);
+        for (size_t oc = ocb * ocBlock; oc < ocEnd; oc++) {
+            acc_t acc[srcBlock] = {};
+            for (int32_t i = rowOffsets[oc]; i < rowOffsets[oc + 1]; i++) {
+                const acc_t w = static_cast<acc_t>(weights[i]);
+                const src_t* s = blockSrc + columns[i] * srcBlock;
+                for (size_t r = 0; r < srcBlock; r++)
+                    acc[r] += w * static_cast<acc_t>(s[r]);
+            }
+            const float b = bias.empty() ? 0.f : bias[oc];
+            for (size_t r = 0; r < rows; r++)
+                dst[(nb * srcBlock + r) * OC + oc] = static_cast<float>(acc[r]) + b;
+        }
+    });
+}
+
+void SparseWeights::execute(const uint8_t* src, float* dst, size_t N) {
+    if (srcPrc == Precision::FP32)
+        calculate<float, float, float>(reinterpret_cast<const float*>(src), dst, N);
+    else if (srcPrc == Precision::U8)
+        calculate<uint8_t, int8_t, int32_t>(src, dst, N);
+    else
+        calculate<int8_t, int8_t, int32_t>(reinterpret_cast<const int8_t*>(src), dst, N);
+}
+
+size_t SparseWeights::getDenseSize() const {
+    return OC * IC * weightsPrc.size();
+}
+
+size_t SparseWeights::getPackedSize() const {
+    const auto nonZeros = static_cast<size_t>(rowOffsets[OC]);
+    return (OC + 1 + nonZeros) * sizeof(int32_t) + nonZeros * weightsPrc.size();
+}
+
+}  // namespace MKLDNNPlugin
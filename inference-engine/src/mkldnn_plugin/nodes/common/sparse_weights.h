@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <ie_precision.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Constant weights [OC, IC] of FullyConnected layer packed to compressed sparse rows: only non zero values
+ * and their input channel indexes are stored. Computes dst[N, OC] = src[N, IC] * weights^T + bias.
+ * Rows of src are taken by blocks transposed to [IC, block] layout, so every non zero weight is multiplied
+ * by a contiguous vector of src values of the block.
+ *
+ * The packed weights are kept in a single buffer owned by the caller, so they may be shared between graphs
+ * of all streams through the weights cache:
+ *   rowOffsets: int32[OC + 1], columns: int32[nnz], values: weights precision[nnz]
+ *
+ * Supported precisions of src and weights are FP32/FP32, U8/I8 and I8/I8, dst is FP32.
+ */
+class SparseWeights {
+public:
+    static constexpr size_t srcBlock = 16;
+    static constexpr size_t ocBlock = 64;
+
+    /**
+     * @param packed Weights packed by pack(), the buffer must outlive the object
+     * @param bias Bias [OC], empty if the layer has no bias
+     */
+    SparseWeights(const uint8_t* packed, InferenceEngine::Precision weightsPrc, InferenceEngine::Precision srcPrc,
+                  size_t OC, size_t IC, std::vector<float> bias);
+
+    static bool isSupported(InferenceEngine::Precision srcPrc, InferenceEngine::Precision weightsPrc);
+
+    /**
+     * @return Fraction of zero values of the dense weights
+     */
+    static float getSparsity(const void* weights, InferenceEngine::Precision weightsPrc, size_t size);
+
+    /**
+     * @return Size in bytes of the buffer for the dense weights [OC, IC] packed by pack()
+     */
+    static size_t getPackedSize(const void* weights, InferenceEngine::Precision weightsPrc, size_t OC, size_t IC);
+
+    /**
+     * @brief Packs the dense weights [OC, IC] to the buffer of getPackedSize() bytes
+     */
+    static void pack(const void* weights, InferenceEngine::Precision weightsPrc, size_t OC, size_t IC, uint8_t* packed);
+
+    void execute(const uint8_t* src, float* dst, size_t N);
+
+    size_t getDenseSize() const;
+    size_t getPackedSize() const;
+
+private:
+    template <typename wei_t>
+    static void pack(const wei_t* weights, size_t OC, size_t IC, uint8_t* packed);
+
+    template <typename src_t, typename wei_t, typename acc_t>
+    void calculate(const src_t* src, float* dst, size_t N);
+
+    InferenceEngine::Precision weightsPrc, srcPrc;
+    size_t OC, IC;
+    // non zero values of the row oc are in [rowOffsets[oc], rowOffsets[oc + 1]) range
+    const int32_t* rowOffsets;
+    const int32_t* columns;
+    const uint8_t* values;
+    std::vector<float> bias;
+    std::vector<uint8_t> srcTransposed;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_decompression.h"
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+constexpr size_t WeightsDecompression::srcBlock;
+constexpr size_t WeightsDecompression::ocBlock;
+
+WeightsDecompression::WeightsDecompression(Precision weightsPrc, size_t OC, size_t IC,
+                                           std::vector<float> scales, std::vector<float> shifts)
+    : weightsPrc(weightsPrc), OC(OC), IC(IC), scales(std::move(scales)), shifts(std::move(shifts)) {
+    if (!isSupported(weightsPrc))
+        THROW_IE_EXCEPTION << "Weights decompression doesn't support " << weightsPrc << " weights";
+    if (this->scales.size() != OC || this->shifts.size() != OC)
+        THROW_IE_EXCEPTION << "Weights decompression got " << this->scales.size() << " scales and " << this->shifts.size()
+                           << " shifts while expected " << OC;
+}
+
+bool WeightsDecompression::isSupported(Precision weightsPrc) {
+    return one_of(weightsPrc, Precision::U8, Precision::I8);
+}
+
+template <typename wei_t>
+void WeightsDecompression::calculate(const float* src, const wei_t* weights, const float* bias, float* dst, size_t N) {
+    const size_t nBlocks = div_up(N, srcBlock);
+    rows.resize(std::max(rows.size(), static_cast<size_t>(parallel_get_max_threads()) * IC));
+    parallel_for2d(div_up(OC, ocBlock), nBlocks, [&](size_t ocb, size_t nb) {
+        float* row = &rows[parallel_get_thread_num() * IC];
+        const size_t nEnd = std::min(N, (nb + 1) * srcBlock);
+        const size_t ocEnd = std::min(OC, (ocb + 1) * ocBlock);
+        for (size_t oc = ocb * ocBlock; oc < ocEnd; oc++) {
+            const wei_t* w = weights + oc * IC;
+            const float scale = scales[oc];
+            const float shift = shifts[oc];
+            for (size_t ic = 0; ic < IC; ic++)
+                row[ic] = static_cast<float>(w[ic]) * scale + shift;
+
+            const float b = bias ? bias[oc] : 0.f;
+            for (size_t n = nb * srcBlock; n < nEnd; n++) {
+                const float* s = src + n * IC;
+                float acc = 0.f;
+                for (size_t ic = 0; ic < IC; ic++)
+                    acc += row[ic] * s[ic];
+                dst[n * OC + oc] = acc + b;
+            }
+        }
+    });
+}
+
+void WeightsDecompression::execute(const float* src, const void* weights, const float* bias, float* dst, size_t N) {
+    if (weightsPrc == Precision::U8)
+        calculate(src, static_cast<const uint8_t*>(weights), bias, dst, N);
+    else
+        calculate(src, static_cast<const int8_t*>(weights), bias, dst, N);
+}
+
+size_t WeightsDecompression::getCompressedSize() const {
+    return OC * IC * weightsPrc.size();
+}
+
+size_t WeightsDecompression::getDecompressedSize() const {
+    return OC * IC * sizeof(float);
+}
+
+}  // namespace MKLDNNPlugin
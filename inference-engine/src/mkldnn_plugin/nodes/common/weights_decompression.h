@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <ie_precision.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * FullyConnected with FP32 source and weights [OC, IC] stored in U8/I8 precision. Weights are decompressed
+ * on the fly by per output channel affine transformation w = q * scales[oc] + shifts[oc], so the compressed
+ * weights are read from memory only. Computes dst[N, OC] = src[N, IC] * weights^T + bias.
+ * Every row of weights is decompressed once for a block of srcBlock source rows.
+ */
+class WeightsDecompression {
+public:
+    static constexpr size_t srcBlock = 16;
+    static constexpr size_t ocBlock = 16;
+
+    /**
+     * @param scales Decompression scales [OC]
+     * @param shifts Decompression shifts [OC], zero points multiplied by scales with the opposite sign
+     */
+    WeightsDecompression(InferenceEngine::Precision weightsPrc, size_t OC, size_t IC,
+                         std::vector<float> scales, std::vector<float> shifts);
+
+    static bool isSupported(InferenceEngine::Precision weightsPrc);
+
+    /**
+     * @param bias Bias [OC], nullptr if the layer has no bias
+     */
+    void execute(const float* src, const void* weights, const float* bias, float* dst, size_t N);
+
+    InferenceEngine::Precision getWeightsPrecision() const {
+        return weightsPrc;
+    }
+
+    size_t getCompressedSize() const;
+    size_t getDecompressedSize() const;
+
+private:
+    template <typename wei_t>
+    void calculate(const float* src, const wei_t* weights, const float* bias, float* dst, size_t N);
+
+    InferenceEngine::Precision weightsPrc;
+    size_t OC, IC;
+    std::vector<float> scales;
+    std::vector<float> shifts;
+    // decompressed rows of weights [IC] per thread, so executions of the same object mustn't overlap
+    std::vector<float> rows;
+};
+
+}  // namespace MKLDNNPlugin
@@ -14,6 +14,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_primitives_cache.hpp>
 #include <legacy/ie_layers_internal.hpp>
 #include <utils/general_utils.h>
 
@@ -584,7 +585,11 @@ void MKLDNNConvolutionNode::createPrimitive() {
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
-    prim.reset(new convolution_forward(prim_desc));
+    // zero points and compensations aren't a part of the primitives cache key
+    if (inputZeroPoints.empty() && weightsZeroPoints.empty() && outputCompensation.empty())
+        prim = MKLDNNPrimitivesCache::getInstance().findOrCreate<convolution_forward>(prim_desc);
+    else
+        prim.reset(new convolution_forward(prim_desc));
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
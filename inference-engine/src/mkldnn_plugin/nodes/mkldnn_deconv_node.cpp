@@ -9,6 +9,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_primitives_cache.hpp>
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include "utils/general_utils.h"
@@ -196,7 +197,7 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
     auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
             convolution_backward_data::desc, convolution_forward::primitive_desc>(attr);
 
-    prim.reset(new convolution_backward_data(prim_desc));
+    prim = MKLDNNPrimitivesCache::getInstance().findOrCreate<convolution_backward_data>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -10,10 +10,13 @@
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_primitives_cache.hpp>
 #include <mkldnn.hpp>
+#include "cpu/x64/cpu_isa_traits.hpp"
 #include "utils/general_utils.h"
 
 using namespace mkldnn;
+using namespace mkldnn::impl::cpu::x64;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
@@ -120,6 +123,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         internalBlobs.push_back(createInternalBlob(biasesDims, false));
     }
 
+    // compressed weights are not supported by mkldnn inner product, see initSupportedPrimitiveDescriptors()
+    if (withWeightsDecompression())
+        return;
+
     for (auto format : getAvailableFormatsForDims(inDims)) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(outDims, outputDataType, memory::format_tag::any);
@@ -128,8 +135,71 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    if (withWeightsDecompression()) {
+        auto weights = getConstBlob(1);
+        if (!weights || !WeightsDecompression::isSupported(weights->getTensorDesc().getPrecision()))
+            THROW_IE_EXCEPTION << "FullyConnected node with name '" << getName() << "' has unsupported compressed weights";
+
+        initPlainPrimitiveDescriptor({Precision::FP32, weights->getTensorDesc().getPrecision(), Precision::FP32});
+    } else if (isSparseWeightsApplicable()) {
+        // the sparse kernel reads constant inputs as they are, so the dense weights aren't reordered for mkldnn
+        useSparseWeights = true;
+        std::vector<Precision> precisions = {getCnnLayer()->insData[0].lock()->getPrecision()};
+        for (size_t i = 1; i < getParentEdges().size(); i++)
+            precisions.push_back(getConstBlob(i)->getTensorDesc().getPrecision());
+        initPlainPrimitiveDescriptor(precisions);
+    } else {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+    }
+}
+
+void MKLDNNFullyConnectedNode::initPlainPrimitiveDescriptor(const std::vector<Precision>& inPrecisions) {
+    auto createPlainDesc = [](Precision precision, const MKLDNNDims& dims) {
+        auto dimsVector = dims.ToSizeVector();
+        return MKLDNNMemoryDesc(TensorDesc(precision, dimsVector, TensorDesc::getLayoutByDims(dimsVector)));
+    };
+
+    LayerConfig config;
+    config.dynBatchSupport = true;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = createPlainDesc(inPrecisions[i], getParentEdgeAt(i)->getDims());
+        config.inConfs.push_back(dataConfig);
+    }
+
+    DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    dataConfig.desc = createPlainDesc(Precision::FP32, getChildEdgeAt(0)->getDims());
+    config.outConfs.push_back(dataConfig);
+
+    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, MKLDNNMemoryDesc(config.outConfs[0].desc).getFormat());
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || sparseWeights || weightsDecompression || dynamicQuantization)
+        return;
+
+    if (withWeightsDecompression()) {
+        auto& weightsMemory = getParentEdgeAt(1)->getMemory();
+        weightsDecompression = std::make_shared<WeightsDecompression>(
+                MKLDNNExtensionUtils::DataTypeToIEPrecision(weightsMemory.GetDataType()),
+                weightsDims[0], getParentEdgeAt(1)->getDims()[1], decompressionScales, decompressionShifts);
+        return;
+    }
+
+    if (useSparseWeights) {
+        initSparseWeights();
+        return;
+    }
+
+    if (initDynamicQuantization())
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
@@ -137,7 +207,7 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
             createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
-    prim.reset(new inner_product_forward(*prim_desc));
+    prim = MKLDNNPrimitivesCache::getInstance().findOrCreate<inner_product_forward>(*prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -148,7 +218,25 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
-    if (prim) {
+    if (sparseWeights || weightsDecompression || dynamicQuantization) {
+        auto& srcMemory = getParentEdgeAt(0)->getMemory();
+        auto& dstMemory = getChildEdgeAt(0)->getMemory();
+        auto srcDims = srcMemory.GetDims();
+        // 3D input [B, T, IC] is processed as [B * T, IC]
+        size_t N = batchToProcess();
+        for (size_t i = 1; i < srcDims.size() - 1; i++)
+            N *= srcDims[i];
+        auto dst = static_cast<float*>(dstMemory.GetPtr());
+        if (sparseWeights) {
+            sparseWeights->execute(static_cast<const uint8_t*>(srcMemory.GetPtr()), dst, N);
+        } else if (dynamicQuantization) {
+            dynamicQuantization->execute(static_cast<const float*>(srcMemory.GetPtr()), dst, N);
+        } else {
+            auto bias = withBiases ? static_cast<const float*>(getParentEdgeAt(2)->getMemory().GetPtr()) : nullptr;
+            weightsDecompression->execute(static_cast<const float*>(srcMemory.GetPtr()), getParentEdgeAt(1)->getMemory().GetPtr(),
+                                          bias, dst, N);
+        }
+    } else if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
@@ -252,6 +340,126 @@ void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool ini
     attr.set_post_ops(ops);
 }
 
+InferenceEngine::Blob::CPtr MKLDNNFullyConnectedNode::getConstBlob(size_t port) const {
+    if (baseInputsNumber == 1)
+        return port <= internalBlobs.size() ? internalBlobs[port - 1] : nullptr;
+
+    // constant inputs may be reordered to the layout chosen by the primitive
+    if (port >= getParentEdges().size())
+        return nullptr;
+    auto parent = getParentEdgeAt(port)->getParent();
+    if (parent->getType() == Reorder)
+        parent = parent->getParentEdgeAt(0)->getParent();
+    if (parent->getType() != Input || !parent->isConstant() || !parent->getCnnLayer() ||
+        parent->getCnnLayer()->blobs.size() != 1)
+        return nullptr;
+    return parent->getCnnLayer()->blobs.begin()->second;
+}
+
+bool MKLDNNFullyConnectedNode::isSparseWeightsApplicable() {
+    if (sparseWeightsThreshold <= 0.f || !fusedWith.empty())
+        return false;
+
+    auto srcDims = getParentEdgeAt(0)->getDims().ToSizeVector();
+    if (!one_of(srcDims.size(), 2, 3) || getCnnLayer()->outData[0]->getPrecision() != Precision::FP32)
+        return false;
+
+    auto weights = getConstBlob(1);
+    auto srcPrecision = getCnnLayer()->insData[0].lock()->getPrecision();
+    if (!weights || !SparseWeights::isSupported(srcPrecision, weights->getTensorDesc().getPrecision()))
+        return false;
+    if (weights->size() != weightsDims[0] * srcDims.back())
+        return false;
+
+    std::vector<float> bias;
+    if (!getConstBias(bias))
+        return false;
+
+    weightsSparsity = SparseWeights::getSparsity(weights->cbuffer(), weights->getTensorDesc().getPrecision(), weights->size());
+    return weightsSparsity >= sparseWeightsThreshold;
+}
+
+void MKLDNNFullyConnectedNode::initSparseWeights() {
+    auto weights = getConstBlob(1);
+    auto weightsPrecision = weights->getTensorDesc().getPrecision();
+    auto srcPrecision = MKLDNNExtensionUtils::DataTypeToIEPrecision(getParentEdgeAt(0)->getMemory().GetDataType());
+    const size_t OC = weightsDims[0];
+    const size_t IC = getParentEdgeAt(0)->getDims().ToSizeVector().back();
+
+    std::vector<float> bias;
+    if (!getConstBias(bias))
+        THROW_IE_EXCEPTION << "FullyConnected node with name '" << getName() << "' has unsupported bias for sparse weights";
+
+    auto create = [&] () {
+        MKLDNNDims packedDims({static_cast<ptrdiff_t>(SparseWeights::getPackedSize(weights->cbuffer(), weightsPrecision, OC, IC))});
+        MKLDNNMemoryPtr packed(new MKLDNNMemory(getEngine()));
+        packed->Create(packedDims, memory::data_type::u8, memory::format_tag::x);
+        SparseWeights::pack(weights->cbuffer(), weightsPrecision, OC, IC, static_cast<uint8_t*>(packed->GetData()));
+        return packed;
+    };
+
+    // packed weights are shared between graphs of all streams in the same way as weights reordered for mkldnn
+    if (weightCache != nullptr) {
+        const uint64_t dataHash = weightCache->GetHashFunc().hash(weights->cbuffer().as<const unsigned char*>(), weights->byteSize());
+        const std::string key = getName() + "_sparse_" + std::to_string(weights->byteSize()) + "_" + std::to_string(dataHash);
+        sparseWeightsMemory = *weightCache->findOrCreate(key, create);
+    } else {
+        sparseWeightsMemory = create();
+    }
+
+    sparseWeights = std::make_shared<SparseWeights>(static_cast<const uint8_t*>(sparseWeightsMemory->GetData()), weightsPrecision,
+                                                    srcPrecision, OC, IC, std::move(bias));
+}
+
+bool MKLDNNFullyConnectedNode::initDynamicQuantization() {
+    // u8 x s8 GEMM may saturate intermediate results without VNNI instructions
+    if (!dynamicQuantizationEnabled || !fusedWith.empty() || !mayiuse(avx512_core_vnni))
+        return false;
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    auto srcDims = srcMemory.GetDims();
+    if (!one_of(srcDims.size(), 2, 3) || !srcMemory.GetDesc().isPlainFormat() || !dstMemory.GetDesc().isPlainFormat() ||
+        srcMemory.GetDataType() != memory::data_type::f32 || dstMemory.GetDataType() != memory::data_type::f32)
+        return false;
+
+    auto weights = getConstBlob(1);
+    if (!weights || weights->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+    const size_t OC = weightsDims[0];
+    const size_t IC = srcDims.back();
+    if (weights->size() != OC * IC)
+        return false;
+
+    std::vector<float> bias;
+    if (!getConstBias(bias))
+        return false;
+
+    dynamicQuantization = std::make_shared<DynamicQuantization>(weights->cbuffer().as<const float*>(), OC, IC, std::move(bias),
+                                                                dynamicQuantizationGranularity);
+    return true;
+}
+
+bool MKLDNNFullyConnectedNode::getConstBias(std::vector<float>& bias) const {
+    if (!withBiases)
+        return true;
+
+    const size_t OC = weightsDims[0];
+    auto biasBlob = getConstBlob(2);
+    if (!biasBlob || biasBlob->size() != OC)
+        return false;
+    if (biasBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+        auto biasData = biasBlob->cbuffer().as<const float*>();
+        bias.assign(biasData, biasData + OC);
+    } else if (biasBlob->getTensorDesc().getPrecision() == Precision::I32) {
+        auto biasData = biasBlob->cbuffer().as<const int32_t*>();
+        bias.assign(biasData, biasData + OC);
+    } else {
+        return false;
+    }
+    return true;
+}
+
 bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
@@ -301,6 +509,9 @@ std::shared_ptr<mkldnn::primitive_attr> MKLDNNFullyConnectedNode::initPrimitiveA
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    if (withWeightsDecompression())
+        return;
+
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
 
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
@@ -384,6 +595,10 @@ const mkldnn::memory& MKLDNNFullyConnectedNode::getBias() const {
 }
 
 InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const {
+    // source is quantized to U8 at runtime
+    if (dynamicQuantization)
+        return Precision::U8;
+
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
     size_t inputsNumLimit = 2;
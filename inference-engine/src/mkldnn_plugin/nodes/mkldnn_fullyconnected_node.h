@@ -6,8 +6,12 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/dynamic_quantization.h"
+#include "common/sparse_weights.h"
+#include "common/weights_decompression.h"
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -19,6 +23,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +48,49 @@ public:
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
+    /**
+     * @brief Sets minimal fraction of zero weights to execute the layer by the sparse weights kernel, 0 disables it
+     */
+    void setSparseWeightsThreshold(float threshold) {
+        sparseWeightsThreshold = threshold;
+    }
+
+    const std::shared_ptr<SparseWeights>& getSparseWeights() const {
+        return sparseWeights;
+    }
+
+    float getWeightsSparsity() const {
+        return weightsSparsity;
+    }
+
+    /**
+     * @brief Makes the node to take U8/I8 weights and decompress them on the fly as w = q * scales[oc] + shifts[oc]
+     */
+    void setWeightsDecompression(std::vector<float> scales, std::vector<float> shifts) {
+        decompressionScales = std::move(scales);
+        decompressionShifts = std::move(shifts);
+    }
+
+    bool withWeightsDecompression() const {
+        return !decompressionScales.empty();
+    }
+
+    const std::shared_ptr<WeightsDecompression>& getWeightsDecompression() const {
+        return weightsDecompression;
+    }
+
+    /**
+     * @brief Makes the node to execute FP32 layer by INT8 GEMM with source quantized at runtime
+     */
+    void setDynamicQuantization(DynamicQuantization::Granularity granularity) {
+        dynamicQuantizationEnabled = true;
+        dynamicQuantizationGranularity = granularity;
+    }
+
+    const std::shared_ptr<DynamicQuantization>& getDynamicQuantization() const {
+        return dynamicQuantization;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -53,6 +101,28 @@ private:
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
+    void initPlainPrimitiveDescriptor(const std::vector<InferenceEngine::Precision>& inPrecisions);
+
+    InferenceEngine::Blob::CPtr getConstBlob(size_t port) const;
+    bool isSparseWeightsApplicable();
+    void initSparseWeights();
+    bool initDynamicQuantization();
+    bool getConstBias(std::vector<float>& bias) const;
+
+    float sparseWeightsThreshold = 0.f;
+    float weightsSparsity = 0.f;
+    bool useSparseWeights = false;
+    MKLDNNMemoryPtr sparseWeightsMemory;
+    std::shared_ptr<SparseWeights> sparseWeights;
+
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionShifts;
+    std::shared_ptr<WeightsDecompression> weightsDecompression;
+
+    bool dynamicQuantizationEnabled = false;
+    DynamicQuantization::Granularity dynamicQuantizationGranularity = DynamicQuantization::PerTensor;
+    std::shared_ptr<DynamicQuantization> dynamicQuantization;
+
     bool withBiases;
     int baseInputsNumber;
 };
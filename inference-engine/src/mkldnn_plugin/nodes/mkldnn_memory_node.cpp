@@ -51,7 +51,8 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}),
+          stateStore(new MKLDNNMemory{eng}) {
     if (created()) {
         holder = MKLDNNMemoryNodeVirtualEdge::registerInput(this);
     }
@@ -65,6 +66,48 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     // default memory state is zero filled
     dataStore->FillZero();
+
+    // the state is kept in dataStore until a buffer of an infer request is bound
+    stateStore->Create(mem_desc, dataStore->GetData());
+    inPlaceState = canUpdateStateInPlace();
+}
+
+void MKLDNNMemoryInputNode::setStateEdges(const std::vector<MKLDNNEdgePtr>& edges) {
+    stateEdges.assign(edges.begin(), edges.end());
+}
+
+bool MKLDNNMemoryInputNode::canUpdateStateInPlace() {
+    if (stateEdges.empty())
+        return false;
+
+    void* statePtr = getChildEdgeAt(0)->getMemory().GetData();
+    bool updatedByOutput = false;
+    for (auto& weakEdge : stateEdges) {
+        auto edge = weakEdge.lock();
+        if (!edge)
+            return false;
+        // graph inputs and outputs may be replaced by user blobs
+        if (edge->getParent()->getType() == Input || edge->getChild()->getType() == Output || edge->getParent()->isConstant())
+            return false;
+        // views with offsets (optimized Concat, Split) cannot be rebound by a single pointer
+        auto& mem = edge->getMemory();
+        if (mem.GetData() != statePtr || mem.GetPtr() != statePtr || mem.GetSize() != dataStore->GetSize())
+            return false;
+
+        auto memoryOutput = dynamic_cast<MKLDNNMemoryOutputNode*>(edge->getChild().get());
+        if (memoryOutput && memoryOutput->getId() == getId())
+            updatedByOutput = true;
+    }
+    // otherwise MemoryOutput would overwrite the state which still may be read by the rest of the graph
+    return updatedByOutput;
+}
+
+void MKLDNNMemoryInputNode::bindState(void* data) {
+    stateStore->GetPrimitivePtr()->set_data_handle(data);
+    if (!inPlaceState)
+        return;
+    for (auto& edge : stateEdges)
+        edge.lock()->getMemory().GetPrimitivePtr()->set_data_handle(data);
 }
 
 /**
@@ -97,7 +140,9 @@ void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    if (new_state.GetData() == stateStore->GetData())
+        return;
+    simple_copy(*stateStore, new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
@@ -105,7 +150,9 @@ void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    if (dst_mem.GetData() == stateStore->GetData())
+        return;
+    simple_copy(dst_mem, *stateStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
@@ -11,6 +11,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -98,8 +99,29 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Makes the node read and update the state kept in the buffer of an infer request.
+     * If the state is updated in place (e.g. MemoryInput -> ScatterUpdate -> MemoryOutput, the KV cache
+     * of a decoder with preallocated capacity), the edges sharing memory with the state are pointed to the buffer
+     * as well, so the state is neither copied to the graph nor back
+     */
+    void bindState(void* data);
+    /**
+     * @brief Sets edges which share memory with the output of the node, must be called before memory is allocated
+     */
+    void setStateEdges(const std::vector<MKLDNNEdgePtr>& edges);
+    bool isStateInPlace() const {
+        return inPlaceState;
+    }
+
  private:
+    bool canUpdateStateInPlace();
+
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr stateStore;
+    std::vector<MKLDNNEdgeWeakPtr> stateEdges;
+    bool inPlaceState = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
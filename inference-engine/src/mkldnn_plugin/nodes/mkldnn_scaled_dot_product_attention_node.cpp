@@ -0,0 +1,119 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_scaled_dot_product_attention_node.h"
+
+#include <legacy/ie_layers.h>
+#include <ngraph_ops/scaled_dot_product_attention.hpp>
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "utils/bfloat16.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+constexpr size_t MKLDNNScaledDotProductAttentionNode::maskPort;
+
+MKLDNNScaledDotProductAttentionNode::MKLDNNScaledDotProductAttentionNode(const InferenceEngine::CNNLayerPtr& layer,
+                                                                         const mkldnn::engine& eng,
+                                                                         MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {
+    auto op = ngraph::as_type_ptr<ngraph::op::internal::ScaledDotProductAttention>(layer->getNode());
+    if (!op)
+        THROW_IE_EXCEPTION << "Cannot create ScaledDotProductAttention node " << getName() << " from layer with type " << layer->type;
+
+    scale = op->get_scale();
+    transposeK = op->get_transpose_k();
+    withMask = op->get_input_size() > maskPort;
+}
+
+void MKLDNNScaledDotProductAttentionNode::getSupportedDescriptors() {
+    const size_t inputsNum = withMask ? maskPort + 1 : maskPort;
+    if (getParentEdges().size() != inputsNum)
+        THROW_IE_EXCEPTION << "ScaledDotProductAttention node with name `" << getName() << "` has incorrect number of input edges";
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "ScaledDotProductAttention node with name `" << getName() << "` has incorrect number of output edges";
+    for (size_t i = 0; i < maskPort; i++) {
+        if (getParentEdgeAt(i)->getDims().ndims() != 4)
+            THROW_IE_EXCEPTION << "ScaledDotProductAttention node with name `" << getName() << "` supports only 4D query, key and value";
+    }
+    if (withMask && getParentEdgeAt(maskPort)->getDims().ndims() > 4)
+        THROW_IE_EXCEPTION << "ScaledDotProductAttention node with name `" << getName() << "` doesn't support mask of rank "
+                           << getParentEdgeAt(maskPort)->getDims().ndims();
+}
+
+void MKLDNNScaledDotProductAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // query, key, value and output share the precision, data is processed in FP32 anyway
+    precision = getCnnLayer()->outData[0]->getPrecision();
+    if (precision != Precision::BF16 || !mayiuse(avx512_core))
+        precision = Precision::FP32;
+
+    auto createPlainDesc = [](Precision prc, const MKLDNNDims& dims) {
+        auto dimsVector = dims.ToSizeVector();
+        return MKLDNNMemoryDesc(TensorDesc(prc, dimsVector, TensorDesc::getLayoutByDims(dimsVector)));
+    };
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = createPlainDesc(i == maskPort ? Precision::FP32 : precision, getParentEdgeAt(i)->getDims());
+        config.inConfs.push_back(dataConfig);
+    }
+
+    InferenceEngine::DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    dataConfig.desc = createPlainDesc(precision, getChildEdgeAt(0)->getDims());
+    config.outConfs.push_back(dataConfig);
+
+    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, MKLDNNMemoryDesc(config.outConfs[0].desc).getFormat());
+}
+
+void MKLDNNScaledDotProductAttentionNode::createPrimitive() {
+    if (attention)
+        return;
+
+    auto qDims = getParentEdgeAt(0)->getDims().ToSizeVector();
+    auto kDims = getParentEdgeAt(1)->getDims().ToSizeVector();
+    auto vDims = getParentEdgeAt(2)->getDims().ToSizeVector();
+    const size_t Lk = transposeK ? kDims[2] : kDims[3];
+
+    std::vector<size_t> maskStrides;
+    if (withMask)
+        maskStrides = FusedAttention::getBroadcastStrides(getParentEdgeAt(maskPort)->getDims().ToSizeVector());
+
+    attention = std::make_shared<FusedAttention>(qDims[0], qDims[1], qDims[2], Lk, qDims[3], vDims[3], scale, transposeK,
+                                                 maskStrides);
+}
+
+void MKLDNNScaledDotProductAttentionNode::execute(mkldnn::stream strm) {
+    const float* mask = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(maskPort)->getMemory().GetPtr()) : nullptr;
+    auto q = getParentEdgeAt(0)->getMemory().GetPtr();
+    auto k = getParentEdgeAt(1)->getMemory().GetPtr();
+    auto v = getParentEdgeAt(2)->getMemory().GetPtr();
+    auto dst = getChildEdgeAt(0)->getMemory().GetPtr();
+
+    if (precision == Precision::BF16) {
+        attention->execute(reinterpret_cast<const bfloat16_t*>(q), reinterpret_cast<const bfloat16_t*>(k),
+                           reinterpret_cast<const bfloat16_t*>(v), mask, reinterpret_cast<bfloat16_t*>(dst));
+    } else {
+        attention->execute(reinterpret_cast<const float*>(q), reinterpret_cast<const float*>(k),
+                           reinterpret_cast<const float*>(v), mask, reinterpret_cast<float*>(dst));
+    }
+}
+
+bool MKLDNNScaledDotProductAttentionNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNScaledDotProductAttentionNode, ScaledDotProductAttention);
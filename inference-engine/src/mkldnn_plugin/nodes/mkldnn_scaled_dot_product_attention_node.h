@@ -0,0 +1,41 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include "common/fused_attention.h"
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Executes ngraph::op::internal::ScaledDotProductAttention, the whole attention block of a transformer layer,
+ * by FusedAttention kernel, so the scores matrix of every head is never written to memory.
+ */
+class MKLDNNScaledDotProductAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledDotProductAttentionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+                                        MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNScaledDotProductAttentionNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    static constexpr size_t maskPort = 3;
+
+    float scale = 1.f;
+    bool transposeK = true;
+    bool withMask = false;
+    InferenceEngine::Precision precision = InferenceEngine::Precision::FP32;
+    std::shared_ptr<FusedAttention> attention;
+};
+
+}  // namespace MKLDNNPlugin
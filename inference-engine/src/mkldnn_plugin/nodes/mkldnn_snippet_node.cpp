@@ -0,0 +1,292 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <legacy/ie_layers.h>
+#include <ie_parallel.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {
+    auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(layer->getNode());
+    if (!subgraph)
+        THROW_IE_EXCEPTION << "Cannot create Subgraph node " << getName() << " from layer with type " << layer->type;
+
+    ngraph::OutputVector inputs;
+    for (const auto& input : subgraph->input_values()) {
+        inputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape()));
+    }
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(inputs, ngraph::clone_function(*subgraph->get_body()));
+    snippet->set_friendly_name(subgraph->get_friendly_name());
+    ngraph::copy_runtime_info(subgraph, snippet);
+}
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op) {
+    // kernels are generated for FP32 data only, integer and boolean chains are executed by Eltwise nodes
+    for (const auto& input : op->inputs()) {
+        if (input.get_element_type() != ngraph::element::f32)
+            return false;
+    }
+    for (const auto& output : op->outputs()) {
+        if (output.get_element_type() != ngraph::element::f32)
+            return false;
+    }
+    return CPUGenerator::isSupported(op);
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the kernel works in FP32, BF16 tensors of layers marked for BF16 inference are converted by reorders
+    for (size_t i = 0; i < getCnnLayer()->insData.size(); i++) {
+        if (!one_of(getCnnLayer()->insData[i].lock()->getPrecision(), Precision::FP32, Precision::BF16))
+            THROW_IE_EXCEPTION << "Subgraph node with name `" << getName() << "` supports only FP32 inputs";
+    }
+    for (size_t i = 0; i < getCnnLayer()->outData.size(); i++) {
+        if (!one_of(getCnnLayer()->outData[i]->getPrecision(), Precision::FP32, Precision::BF16))
+            THROW_IE_EXCEPTION << "Subgraph node with name `" << getName() << "` supports only FP32 outputs";
+    }
+
+    impl_desc_type impl_type;
+    if (mayiuse(x64::avx512_common)) {
+        isa = x64::avx512_common;
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(x64::avx2)) {
+        isa = x64::avx2;
+        impl_type = impl_desc_type::jit_avx2;
+    } else {
+        isa = x64::sse41;
+        impl_type = impl_desc_type::jit_sse42;
+    }
+
+    enum LayoutType {
+        Planar,
+        ChannelsLast,
+        Blocked
+    };
+
+    auto initDesc = [&] (LayoutType lt) -> PrimitiveDescInfo {
+        auto createMemoryDesc = [lt](const MKLDNNDims& mkldnnDims) -> TensorDesc {
+            auto dims = mkldnnDims.ToSizeVector();
+            auto ndims = dims.size();
+            std::vector<size_t> order(ndims);
+            std::iota(order.begin(), order.end(), 0);
+
+            if (lt == ChannelsLast && ndims > 1) {
+                order.erase(order.begin() + 1);
+                order.push_back(1);
+
+                std::vector<size_t> blocks(ndims);
+                for (size_t i = 0; i < order.size(); i++) {
+                    blocks[i] = dims[order[i]];
+                }
+
+                return TensorDesc(Precision::FP32, dims, {blocks, order});
+            } else if (lt == Blocked && dims[1] != 1) {
+                size_t blockSize = mayiuse(x64::avx512_common) ? 16 : 8;
+
+                std::vector<size_t> blocks = dims;
+                blocks[1] = div_up(blocks[1], blockSize);
+                blocks.push_back(blockSize);
+                order.push_back(1);
+
+                return TensorDesc(Precision::FP32, dims, {blocks, order});
+            }
+
+            return TensorDesc(Precision::FP32, dims, {dims, order});
+        };
+
+        InferenceEngine::LayerConfig config;
+        config.dynBatchSupport = false;
+
+        for (size_t i = 0; i < inDims.size(); i++) {
+            InferenceEngine::DataConfig dataConfig;
+            dataConfig.inPlace = -1;
+            dataConfig.constant = false;
+            dataConfig.desc = createMemoryDesc(inDims[i]);
+            config.inConfs.push_back(dataConfig);
+        }
+
+        for (size_t i = 0; i < outDims.size(); i++) {
+            InferenceEngine::DataConfig dataConfig;
+            dataConfig.inPlace = -1;
+            dataConfig.constant = false;
+            dataConfig.desc = createMemoryDesc(outDims[i]);
+            config.outConfs.push_back(dataConfig);
+        }
+
+        return {config, impl_type};
+    };
+
+    const int outRank = outDims[0].ndims();
+    bool isChannelsLastApplicable = one_of(outRank, 1, 2, 4, 5);
+    bool isBlockedApplicable = one_of(outRank, 4, 5);
+    for (const auto& dims : inDims) {
+        isChannelsLastApplicable = isChannelsLastApplicable && dims.ndims() == outRank;
+        isBlockedApplicable = isBlockedApplicable && dims.ndims() == outRank;
+    }
+    for (const auto& dims : outDims) {
+        isChannelsLastApplicable = isChannelsLastApplicable && dims.ndims() == outRank;
+        isBlockedApplicable = isBlockedApplicable && dims.ndims() == outRank && dims[1] == outDims[0][1];
+    }
+
+    if (isChannelsLastApplicable)
+        supportedPrimitiveDescriptors.emplace_back(initDesc(ChannelsLast));
+    if (isBlockedApplicable)
+        supportedPrimitiveDescriptors.emplace_back(initDesc(Blocked));
+    supportedPrimitiveDescriptors.emplace_back(initDesc(Planar));
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    const size_t numInputs = config.inConfs.size();
+    const size_t numOutputs = config.outConfs.size();
+    if (numInputs + numOutputs > SNIPPETS_MAX_NUM_IO)
+        THROW_IE_EXCEPTION << "Subgraph node with name `" << getName() << "` has too many inputs and outputs";
+
+    // shapes of all inputs and outputs in memory order, planar inputs of a blocked layout (with channels equal to 1)
+    // are broadcasted along the inner block
+    const auto& outDesc = config.outConfs[0].desc;
+    const bool isOutputBlocked = outDesc.getBlockingDesc().getBlockDims().size() != outDesc.getDims().size();
+    std::vector<std::vector<size_t>> ioDims;
+    auto addIODims = [&](const TensorDesc& desc) {
+        auto blockDims = desc.getBlockingDesc().getBlockDims();
+        if (isOutputBlocked && blockDims.size() == desc.getDims().size())
+            blockDims.push_back(1);
+        ioDims.push_back(blockDims);
+    };
+    for (const auto& inConf : config.inConfs)
+        addIODims(inConf.desc);
+    for (const auto& outConf : config.outConfs)
+        addIODims(outConf.desc);
+
+    size_t rank = 4;
+    for (const auto& dims : ioDims)
+        rank = std::max(rank, dims.size());
+    for (auto& dims : ioDims)
+        dims.insert(dims.begin(), rank - dims.size(), 1);
+
+    workDims.assign(rank, 1);
+    for (const auto& dims : ioDims) {
+        for (size_t d = 0; d < rank; d++) {
+            if (dims[d] != workDims[d] && dims[d] != 1 && workDims[d] != 1)
+                THROW_IE_EXCEPTION << "Subgraph node with name `" << getName() << "` has inputs and outputs which are not broadcastable";
+            workDims[d] = std::max(workDims[d], dims[d]);
+        }
+    }
+
+    // merge the innermost dimensions while every tensor either spans both of them or is broadcasted along both,
+    // so the kernel is called on longer rows
+    auto collapseLastDims = [](std::vector<size_t>& dims) {
+        dims[dims.size() - 1] *= dims[dims.size() - 2];
+        for (size_t d = dims.size() - 2; d > 0; d--)
+            dims[d] = dims[d - 1];
+        dims[0] = 1;
+    };
+    for (size_t collapsed = 0; collapsed + 1 < rank; collapsed++) {
+        bool canCollapse = true;
+        for (const auto& dims : ioDims) {
+            const bool isFull = dims[rank - 1] == workDims[rank - 1] && dims[rank - 2] == workDims[rank - 2];
+            const bool isBroadcasted = dims[rank - 1] == 1 && dims[rank - 2] == 1;
+            canCollapse = canCollapse && (isFull || isBroadcasted);
+        }
+        if (!canCollapse)
+            break;
+
+        for (auto& dims : ioDims)
+            collapseLastDims(dims);
+        collapseLastDims(workDims);
+    }
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes;
+    ngraph::AxisVector order(rank);
+    std::iota(order.begin(), order.end(), 0);
+    for (size_t i = 0; i < numInputs; i++)
+        inputShapes.emplace_back(ngraph::Shape(ioDims[i]), order, ngraph::element::f32);
+    for (size_t i = 0; i < numOutputs; i++)
+        outputShapes.emplace_back(ngraph::Shape(ioDims[numInputs + i]), order, ngraph::element::f32);
+
+    snippet->set_generator(std::make_shared<CPUGenerator>(isa));
+    auto schedule = snippet->generate(outputShapes, inputShapes);
+    kernel = (kernel_t)schedule.ptr;
+
+    ioStrides.assign(ioDims.size(), std::vector<size_t>(rank, 0));
+    ioInnerSteps.assign(ioDims.size(), 0);
+    for (size_t i = 0; i < ioDims.size(); i++) {
+        size_t stride = sizeof(float);
+        for (int d = static_cast<int>(rank) - 1; d >= 0; d--) {
+            ioStrides[i][d] = ioDims[i][d] == 1 ? 0 : stride;
+            stride *= ioDims[i][d];
+        }
+        ioInnerSteps[i] = ioStrides[i][rank - 1];
+    }
+
+    // split the innermost dimension into vector aligned chunks if outer dimensions don't give enough parallel work
+    const size_t innerWorkAmount = workDims[rank - 1];
+    outerWorkAmount = std::accumulate(workDims.begin(), workDims.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+    const size_t vecStep = (isa == x64::avx512_common ? 64 : isa == x64::avx2 ? 32 : 16) / sizeof(float);
+    const size_t minChunkSize = 64 * vecStep;
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    innerChunkSize = innerWorkAmount;
+    if (outerWorkAmount < nthr && innerWorkAmount > minChunkSize) {
+        const size_t chunksPerRow = div_up(nthr, outerWorkAmount);
+        innerChunkSize = std::max(minChunkSize, rnd_up(div_up(innerWorkAmount, chunksPerRow), vecStep));
+    }
+    innerChunksNum = div_up(innerWorkAmount, innerChunkSize);
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    const size_t numInputs = getParentEdges().size();
+    const size_t numIO = ioStrides.size();
+    std::vector<const uint8_t*> ptrs(numIO);
+    for (size_t i = 0; i < numInputs; i++)
+        ptrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemory().GetPtr());
+    for (size_t i = numInputs; i < numIO; i++)
+        ptrs[i] = reinterpret_cast<const uint8_t*>(getChildEdgesAtPort(i - numInputs)[0]->getMemory().GetPtr());
+
+    const size_t rank = workDims.size();
+    const size_t innerWorkAmount = workDims[rank - 1];
+
+    parallel_for2d(outerWorkAmount, innerChunksNum, [&](size_t outer, size_t chunk) {
+        size_t offsets[SNIPPETS_MAX_NUM_IO] = {};
+        size_t idx = outer;
+        for (int d = static_cast<int>(rank) - 2; d >= 0; d--) {
+            const size_t dimIdx = idx % workDims[d];
+            idx /= workDims[d];
+            for (size_t i = 0; i < numIO; i++)
+                offsets[i] += dimIdx * ioStrides[i][d];
+        }
+
+        const size_t innerStart = chunk * innerChunkSize;
+        jit_snippets_call_args args;
+        for (size_t i = 0; i < numIO; i++)
+            args.ptrs[i] = ptrs[i] + offsets[i] + innerStart * ioInnerSteps[i];
+        args.work_amount = std::min(innerChunkSize, innerWorkAmount - innerStart);
+
+        kernel(&args);
+    });
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
@@ -0,0 +1,54 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <snippets/op/subgraph.hpp>
+#include "emitters/cpu_generator.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Executes a chain of eltwise operations tokenized into ngraph::snippets::op::Subgraph as a single JIT kernel,
+ * so intermediate tensors of the chain are never written to memory.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNSnippetNode() override = default;
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op);
+
+private:
+    using kernel_t = void (*)(const jit_snippets_call_args*);
+
+    // original subgraph body is canonicalized during code generation, so the node owns its own copy
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa = mkldnn::impl::cpu::x64::isa_any;
+    kernel_t kernel = nullptr;
+
+    // work dimensions after collapsing, the innermost one is processed by the kernel
+    std::vector<size_t> workDims;
+    // byte strides of every input and output along outer work dimensions, zero for broadcasted ones
+    std::vector<std::vector<size_t>> ioStrides;
+    // byte step of every input and output along the innermost work dimension, zero for broadcasted ones
+    std::vector<size_t> ioInnerSteps;
+
+    size_t outerWorkAmount = 1;
+    size_t innerChunkSize = 0;
+    size_t innerChunksNum = 1;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "load_network_profile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Peak resident set size of the process in kilobytes, 0 if it is not available on the platform
+size_t getPeakRSSInKB() {
+    size_t peakRSS = 0;
+#ifdef __linux__
+    FILE* file = std::fopen("/proc/self/status", "r");
+    if (file == nullptr)
+        return peakRSS;
+    char line[128];
+    while (std::fgets(line, sizeof(line), file) != nullptr) {
+        if (std::strncmp(line, "VmHWM:", 6) == 0) {
+            unsigned long value = 0;
+            if (std::sscanf(line + 6, "%lu", &value) == 1)
+                peakRSS = static_cast<size_t>(value);
+            break;
+        }
+    }
+    std::fclose(file);
+#endif
+    return peakRSS;
+}
+
+}  // namespace
+
+LoadNetworkProfile::Scope::Scope(LoadNetworkProfile& profile, std::string phase)
+    : _profile(profile), _phase(std::move(phase)), _start(std::chrono::steady_clock::now()) {}
+
+LoadNetworkProfile::Scope::~Scope() {
+    _profile.add(_phase, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start));
+}
+
+void LoadNetworkProfile::add(const std::string& phase, std::chrono::microseconds time) {
+    add(phase, time, getPeakRSSInKB());
+}
+
+void LoadNetworkProfile::add(const std::string& phase, std::chrono::microseconds time, size_t peakRSS) {
+    auto it = std::find_if(_phases.begin(), _phases.end(), [&](const Phase& p) { return p.name == phase; });
+    if (it == _phases.end()) {
+        Phase newPhase;
+        newPhase.name = phase;
+        newPhase.time = time;
+        newPhase.peakRSS = peakRSS;
+        _phases.push_back(newPhase);
+    } else {
+        it->time += time;
+        it->peakRSS = std::max(it->peakRSS, peakRSS);
+    }
+}
+
+void LoadNetworkProfile::merge(const LoadNetworkProfile& other, const std::string& prefix) {
+    for (const auto& phase : other._phases)
+        add(prefix + phase.name, phase.time, phase.peakRSS);
+}
+
+std::vector<std::string> LoadNetworkProfile::format() const {
+    std::vector<std::string> report;
+    report.reserve(_phases.size());
+    for (const auto& phase : _phases) {
+        report.push_back(phase.name + "," + std::to_string(phase.time.count()) + "," + std::to_string(phase.peakRSS));
+    }
+    return report;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,55 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Collects durations of network loading phases reported by LOAD_NETWORK_PROFILE metric.
+ * Together with the duration the peak resident set size of the process at the end of the phase is stored.
+ * Phases with the same name are accumulated, so per-stream graph phases are summed over streams.
+ */
+class LoadNetworkProfile {
+public:
+    class Scope {
+    public:
+        Scope(LoadNetworkProfile& profile, std::string phase);
+        ~Scope();
+
+    private:
+        LoadNetworkProfile& _profile;
+        std::string _phase;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    void add(const std::string& phase, std::chrono::microseconds time);
+
+    /**
+     * Appends phases of another profile, names are prefixed with the given prefix.
+     */
+    void merge(const LoadNetworkProfile& other, const std::string& prefix = {});
+
+    /**
+     * Returns entries in "<phase>,<time_us>,<peak_rss_kb>" format in order of the first phase appearance.
+     */
+    std::vector<std::string> format() const;
+
+private:
+    struct Phase {
+        std::string name;
+        std::chrono::microseconds time{0};
+        size_t peakRSS = 0;
+    };
+
+    void add(const std::string& phase, std::chrono::microseconds time, size_t peakRSS);
+
+    std::vector<Phase> _phases;
+};
+
+}  // namespace MKLDNNPlugin
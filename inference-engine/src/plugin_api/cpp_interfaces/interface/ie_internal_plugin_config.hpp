@@ -32,6 +32,20 @@ namespace PluginConfigInternalParams {
  */
 DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
 
+/**
+ * @brief Defines whether chains of eltwise operations are fused into code generated subgraphs (snippets).
+ * Enabled by default on x86 CPUs with AVX2 support for FP32 networks
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(SNIPPETS_MODE);
+
+/**
+ * @brief Defines whether scaled dot product attention blocks are fused into a single operation.
+ * Disabled by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(ATTENTION_FUSION_MODE);
+
 /**
  * @brief Limit \#threads that are used by CPU Executor Streams to execute `parallel_for` calls
  * @ingroup ie_dev_api_plugin_api
@@ -17,6 +17,7 @@
 
 #include "threading/ie_itask_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
+#include "threading/ie_shared_streams_executor.hpp"
 
 namespace InferenceEngine {
 
@@ -29,17 +30,22 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    SharedStreamsPool::Ptr getSharedStreamsPool(const IStreamsExecutor::Config& config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
     // for tests purposes
     size_t getIdleCPUStreamsExecutorsNumber();
 
+    size_t getStreamsThreadsNumber();
+
     void clear(const std::string& id = {});
 
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
+    std::unordered_map<std::string, SharedStreamsPool::Ptr> sharedStreamsPools;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
 };
@@ -83,6 +89,13 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns process-wide pool of streams shared between clients by the pool name
+     * @param config Parameters of streams of the pool, used if the pool with the name doesn't exist yet
+     * @return A shared pointer to existing or newly created pool
+     */
+    SharedStreamsPool::Ptr getSharedStreamsPool(const IStreamsExecutor::Config& config);
+
     /**
      * @cond
      */
@@ -90,6 +103,8 @@ public:
 
     size_t getIdleCPUStreamsExecutorsNumber();
 
+    size_t getStreamsThreadsNumber();
+
     void clear(const std::string& id = {});
     /**
      * @endcond
@@ -0,0 +1,139 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_shared_streams_executor.hpp
+ * @brief A header file for Inference Engine executor sharing a pool of CPU streams between several clients.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class SharedStreamsPool
+ * @ingroup ie_dev_api_threading
+ * @brief Pool of CPU streams shared by several SharedStreamsExecutor clients, e.g. executable networks.
+ *        Every client has own task queue. An idle stream takes the next task from the client with the least
+ *        virtual time, which grows with the execution time of the client tasks divided by the client weight
+ *        (weighted fair queueing). Clients with running tasks number equal to the client quota are skipped.
+ */
+class INFERENCE_ENGINE_API_CLASS(SharedStreamsPool) {
+public:
+    /**
+     * @brief A shared pointer to a SharedStreamsPool object
+     */
+    using Ptr = std::shared_ptr<SharedStreamsPool>;
+
+    /**
+     * @brief Constructor
+     * @param config Parameters of streams of the pool
+     */
+    explicit SharedStreamsPool(const IStreamsExecutor::Config& config);
+
+    /**
+     * @brief A class destructor
+     */
+    ~SharedStreamsPool();
+
+    /**
+     * @brief Returns parameters of streams of the pool
+     * @return The pool streams parameters
+     */
+    const IStreamsExecutor::Config& GetConfig() const;
+
+private:
+    friend class SharedStreamsExecutor;
+    struct Client;
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+/**
+ * @class SharedStreamsExecutor
+ * @ingroup ie_dev_api_threading
+ * @brief Streams executor of a client of SharedStreamsPool. Tasks are queued to the client queue and run
+ *        by streams of the pool. Stream id is an index of the client slot in [0, quota) range,
+ *        so client tasks running at the same time always have different stream ids.
+ * @note  The same as for other executors, tasks are responsible for delivering their exceptions to the waiting
+ *        side. An exception escaped from a task is ignored.
+ */
+class INFERENCE_ENGINE_API_CLASS(SharedStreamsExecutor) : public IStreamsExecutor {
+public:
+    /**
+     * @brief A shared pointer to a SharedStreamsExecutor object
+     */
+    using Ptr = std::shared_ptr<SharedStreamsExecutor>;
+
+    /**
+     * @brief Scheduling parameters of the client
+     */
+    struct ClientConfig {
+        std::string     _name;      //!< Name of the client
+        unsigned int    _weight;    //!< Share of the pool streams time relative to other clients
+        int             _quota;     //!< Maximal number of the client tasks running at the same time
+
+        /**
+         * @brief      Constructs client config
+         * @param[in]  name    @copybrief ClientConfig::_name
+         * @param[in]  weight  @copybrief ClientConfig::_weight
+         * @param[in]  quota   @copybrief ClientConfig::_quota
+         */
+        ClientConfig(std::string name = "SharedStreamsExecutor", unsigned int weight = 1, int quota = 1) :
+            _name{name},
+            _weight{weight},
+            _quota{quota} {
+        }
+    };
+
+    /**
+     * @brief Queueing statistics of the client, times are in microseconds
+     */
+    struct Statistics {
+        uint64_t    _tasks              = 0;  //!< Number of started tasks
+        uint64_t    _queueingTime       = 0;  //!< Total time of tasks waiting for a stream
+        uint64_t    _maxQueueingTime    = 0;  //!< Maximal time of a task waiting for a stream
+        uint64_t    _executionTime      = 0;  //!< Total execution time of finished tasks
+        uint64_t    _queued             = 0;  //!< Number of tasks waiting for a stream now
+        uint64_t    _running            = 0;  //!< Number of tasks running now
+    };
+
+    /**
+     * @brief Constructor
+     * @param pool Pool of streams to run tasks of the client
+     * @param config Scheduling parameters of the client
+     */
+    SharedStreamsExecutor(const SharedStreamsPool::Ptr& pool, const ClientConfig& config);
+
+    /**
+     * @brief A class destructor. Waits for the client tasks completion
+     */
+    ~SharedStreamsExecutor() override;
+
+    void run(Task task) override;
+
+    void Execute(Task task) override;
+
+    int GetStreamId() override;
+
+    int GetNumaNodeId() override;
+
+    /**
+     * @brief Returns queueing statistics of the client
+     * @return The client statistics
+     */
+    Statistics GetStatistics() const;
+
+private:
+    SharedStreamsPool::Ptr                      _pool;
+    std::unique_ptr<SharedStreamsPool::Client>  _client;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,20 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines openvino domains for tracing
+ * @file ie_ir_bin_itt.hpp
+ */
+
+#pragma once
+
+#include <openvino/itt.hpp>
+
+namespace InferenceEngine {
+namespace itt {
+namespace domains {
+    OV_ITT_DOMAIN(BinaryIRReader);
+}
+}
+}
@@ -0,0 +1,437 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_ir_bin_parser.hpp"
+#include "ie_ir_bin_itt.hpp"
+
+#include <map>
+#include <memory>
+#include <ngraph/ngraph.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/ops.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <ngraph/variant.hpp>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <transformations/binary_ir_format.hpp>
+
+namespace InferenceEngine {
+
+namespace {
+
+namespace binary_ir = ngraph::pass::binary_ir;
+
+struct Attribute {
+    binary_ir::AttributeType type;
+    const std::string* name;
+    binary_ir::Reader payload;
+};
+
+struct LayerParams {
+    size_t layerId;
+    std::string version;
+    std::string name;
+    std::string type;
+    std::vector<std::unordered_set<std::string>> outputNames;
+};
+
+class BinaryDeserializer : public ngraph::AttributeVisitor {
+public:
+    BinaryDeserializer(
+        const std::vector<Attribute>& attributes,
+        const Blob::CPtr& weights,
+        const std::unordered_map<std::string, ngraph::OpSet>& opsets,
+        std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
+        : attributes(attributes), weights(weights), opsets(opsets), variables(variables) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::String, payload)) return;
+        value.set(payload.read_string());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& value) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::Bool, payload)) return;
+        value.set(payload.read<uint8_t>() != 0);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::Double, payload)) return;
+        adapter.set(payload.read<double>());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::Int64, payload)) return;
+        adapter.set(payload.read<int64_t>());
+    }
+    void on_adapter(
+        const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::Int32Vector, payload)) return;
+        adapter.set(payload.read_vector<int32_t>());
+    }
+    void on_adapter(
+        const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::Int64Vector, payload)) return;
+        adapter.set(payload.read_vector<int64_t>());
+    }
+    void on_adapter(
+        const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::UInt64Vector, payload)) return;
+        adapter.set(payload.read_vector<uint64_t>());
+    }
+    void on_adapter(
+        const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::FloatVector, payload)) return;
+        adapter.set(payload.read_vector<float>());
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::StringVector, payload)) return;
+        adapter.set(payload.read_string_vector());
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        binary_ir::Reader payload(nullptr, nullptr);
+        if (!find(name, binary_ir::AttributeType::Function, payload))
+            THROW_IE_EXCEPTION << "Binary IR doesn't contain " << name << " function";
+        adapter.set(parse_function(payload));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override;
+
+    /// \brief Creates ngraph::Function from the function record
+    std::shared_ptr<ngraph::Function> parse_function(binary_ir::Reader& reader);
+
+private:
+    /// \brief Looks for the attribute record of the current layer. Records of nested structures
+    /// are stored with the same names as in XML IR, so the first one with the name is used.
+    bool find(const std::string& name, binary_ir::AttributeType type, binary_ir::Reader& payload) const {
+        for (const auto& attribute : attributes) {
+            if (*attribute.name == name) {
+                if (attribute.type != type)
+                    THROW_IE_EXCEPTION << "Binary IR attribute " << name << " has unexpected type "
+                                       << static_cast<int>(attribute.type);
+                payload = attribute.payload;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>
+    parseInputDescription(binary_ir::Reader& payload);
+    std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>
+    parseOutputDescription(binary_ir::Reader& payload);
+
+    std::shared_ptr<ngraph::Node> createNode(
+        const ngraph::OutputVector& inputs,
+        const std::vector<Attribute>& attributes,
+        const std::vector<std::pair<std::string, std::string>>& rt_info,
+        const LayerParams& params);
+
+    // -- DATA --
+    const std::vector<Attribute>& attributes;
+    const Blob::CPtr& weights;
+    const std::unordered_map<std::string, ngraph::OpSet>& opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables;
+};
+
+std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>
+BinaryDeserializer::parseInputDescription(binary_ir::Reader& payload) {
+    using SubGraphOp = ngraph::op::util::SubGraphOp;
+    std::vector<std::shared_ptr<SubGraphOp::InputDescription>> inputs;
+    const auto count = payload.read<uint32_t>();
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto type = payload.read<binary_ir::InputDescriptionType>();
+        const auto input_index = payload.read<uint64_t>();
+        const auto body_parameter_index = payload.read<uint64_t>();
+        switch (type) {
+        case binary_ir::InputDescriptionType::Invariant:
+            inputs.push_back(std::make_shared<SubGraphOp::InvariantInputDescription>(
+                input_index, body_parameter_index));
+            break;
+        case binary_ir::InputDescriptionType::Slice: {
+            const auto start = payload.read<int64_t>();
+            const auto stride = payload.read<int64_t>();
+            const auto part_size = payload.read<int64_t>();
+            const auto end = payload.read<int64_t>();
+            const auto axis = payload.read<int64_t>();
+            inputs.push_back(std::make_shared<SubGraphOp::SliceInputDescription>(
+                input_index, body_parameter_index, start, stride, part_size, end, axis));
+            break;
+        }
+        case binary_ir::InputDescriptionType::Merged:
+            inputs.push_back(std::make_shared<SubGraphOp::MergedInputDescription>(
+                input_index, body_parameter_index, payload.read<uint64_t>()));
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unknown input description type in binary IR: " << static_cast<int>(type);
+        }
+    }
+    return inputs;
+}
+
+std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>
+BinaryDeserializer::parseOutputDescription(binary_ir::Reader& payload) {
+    using SubGraphOp = ngraph::op::util::SubGraphOp;
+    std::vector<std::shared_ptr<SubGraphOp::OutputDescription>> outputs;
+    const auto count = payload.read<uint32_t>();
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto type = payload.read<binary_ir::OutputDescriptionType>();
+        const auto body_value_index = payload.read<uint64_t>();
+        const auto output_index = payload.read<uint64_t>();
+        switch (type) {
+        case binary_ir::OutputDescriptionType::Body:
+            outputs.push_back(std::make_shared<SubGraphOp::BodyOutputDescription>(
+                body_value_index, output_index, payload.read<int64_t>()));
+            break;
+        case binary_ir::OutputDescriptionType::Concat: {
+            const auto start = payload.read<int64_t>();
+            const auto stride = payload.read<int64_t>();
+            const auto part_size = payload.read<int64_t>();
+            const auto end = payload.read<int64_t>();
+            const auto axis = payload.read<int64_t>();
+            outputs.push_back(std::make_shared<SubGraphOp::ConcatOutputDescription>(
+                body_value_index, output_index, start, stride, part_size, end, axis));
+            break;
+        }
+        default:
+            THROW_IE_EXCEPTION << "Unknown output description type in binary IR: " << static_cast<int>(type);
+        }
+    }
+    return outputs;
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) {
+    using SubGraphOp = ngraph::op::util::SubGraphOp;
+    binary_ir::Reader payload(nullptr, nullptr);
+
+    if (auto a = ngraph::as_type<ngraph::AttributeAdapter<
+            std::vector<std::shared_ptr<SubGraphOp::InputDescription>>>>(&adapter)) {
+        if (!find(name, binary_ir::AttributeType::InputDescriptions, payload)) return;
+        a->set(parseInputDescription(payload));
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<
+                   std::vector<std::shared_ptr<SubGraphOp::OutputDescription>>>>(&adapter)) {
+        if (!find(name, binary_ir::AttributeType::OutputDescriptions, payload)) return;
+        a->set(parseOutputDescription(payload));
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        if (!find(name, binary_ir::AttributeType::SpecialBodyPorts, payload)) return;
+        const auto current_iteration_input_idx = payload.read<int64_t>();
+        const auto body_condition_output_idx = payload.read<int64_t>();
+        a->set(ngraph::op::v5::Loop::SpecialBodyPorts(current_iteration_input_idx, body_condition_output_idx));
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+        if (!find(name, binary_ir::AttributeType::Variable, payload)) return;
+        const auto& variable_id = payload.read_string();
+        if (!variables.count(variable_id)) {
+            variables[variable_id] = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
+                ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
+        }
+        a->set(variables[variable_id]);
+    } else if (auto a = ngraph::as_type<
+                   ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+        if (!find(name, binary_ir::AttributeType::ConstantData, payload)) return;
+        const auto offset = payload.read<uint64_t>();
+        const auto size = payload.read<uint64_t>();
+
+        if (!weights || !weights->byteSize())
+            THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+        // offset + size may overflow for a malformed file
+        if (offset > weights->byteSize() || size > weights->byteSize() - offset)
+            THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+
+        char* data = weights->cbuffer().as<char*>() + offset;
+
+        using SharedBuffer = ngraph::runtime::SharedBuffer<const Blob::CPtr>;
+        auto buffer = std::make_shared<SharedBuffer>(data, size, weights);
+        a->set(buffer);
+    }
+}
+
+std::shared_ptr<ngraph::Function> BinaryDeserializer::parse_function(binary_ir::Reader& reader) {
+    OV_ITT_TASK_CHAIN(taskChain, itt::domains::BinaryIRReader, "IRBinParser", "Parse");
+
+    const auto& function_name = reader.read_string();
+    const auto layer_count = reader.read<uint32_t>();
+
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    nodes.reserve(layer_count);
+    std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
+
+    std::vector<Attribute> layer_attributes;
+    std::vector<std::pair<std::string, std::string>> rt_info;
+    ngraph::OutputVector inputs;
+
+    // Layers are stored in topological order, so operations are created right away
+    for (uint32_t layer_id = 0; layer_id < layer_count; ++layer_id) {
+        LayerParams params;
+        params.layerId = layer_id;
+        params.type = reader.read_string();
+        params.version = reader.read_string();
+        params.name = reader.read_string();
+
+        inputs.resize(reader.read<uint32_t>());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            const auto source_layer = reader.read<uint32_t>();
+            const auto source_output = reader.read<uint32_t>();
+            if (source_layer >= nodes.size() || source_output >= nodes[source_layer]->get_output_size())
+                THROW_IE_EXCEPTION << params.type << " layer " << params.name << " with id: " << layer_id
+                                   << " has incorrect input with index " << i << "!";
+            inputs[i] = nodes[source_layer]->output(source_output);
+        }
+
+        const auto output_count = reader.read<uint32_t>();
+        for (uint32_t i = 0; i < output_count; ++i) {
+            const auto names = reader.read_string_vector();
+            params.outputNames.emplace_back(names.begin(), names.end());
+        }
+
+        rt_info.resize(reader.read<uint32_t>());
+        for (auto& value : rt_info) {
+            value.first = reader.read_string();
+            value.second = reader.read_string();
+        }
+
+        layer_attributes.clear();
+        for (auto type = reader.read<binary_ir::AttributeType>(); type != binary_ir::AttributeType::End;
+             type = reader.read<binary_ir::AttributeType>()) {
+            const auto& name = reader.read_string();
+            const auto size = reader.read<uint64_t>();
+            layer_attributes.push_back({type, &name, reader.sub_reader(size)});
+        }
+
+        auto node = createNode(inputs, layer_attributes, rt_info, params);
+        if (const auto& read_value = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(node)) {
+            variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+        }
+        nodes.push_back(node);
+    }
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphFunction");
+
+    const auto get_node = [&](uint32_t layer_id) {
+        if (layer_id >= nodes.size())
+            THROW_IE_EXCEPTION << "Attempt to access node " << layer_id << " that not in graph.";
+        return nodes[layer_id];
+    };
+
+    ngraph::ParameterVector parameters(reader.read<uint32_t>());
+    for (auto& parameter : parameters) {
+        parameter = ngraph::as_type_ptr<ngraph::op::Parameter>(get_node(reader.read<uint32_t>()));
+        if (!parameter) THROW_IE_EXCEPTION << "Binary IR function parameter is not a Parameter layer";
+    }
+    ngraph::ResultVector results(reader.read<uint32_t>());
+    for (auto& result : results) {
+        result = ngraph::as_type_ptr<ngraph::op::Result>(get_node(reader.read<uint32_t>()));
+        if (!result) THROW_IE_EXCEPTION << "Binary IR function result is not a Result layer";
+    }
+    ngraph::SinkVector sinks(reader.read<uint32_t>());
+    for (auto& sink : sinks) {
+        sink = std::dynamic_pointer_cast<ngraph::op::Sink>(get_node(reader.read<uint32_t>()));
+        if (!sink) THROW_IE_EXCEPTION << "Binary IR function sink is not a Sink layer";
+    }
+
+    auto function = std::make_shared<ngraph::Function>(results, sinks, parameters, function_name);
+    for (const auto& sink : sinks) {
+        if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(sink)) {
+            assign->add_control_dependency(variable_id_to_read_value.at(assign->get_variable_id()));
+        }
+    }
+
+    return function;
+}
+
+std::shared_ptr<ngraph::Node> BinaryDeserializer::createNode(
+    const ngraph::OutputVector& inputs,
+    const std::vector<Attribute>& attributes,
+    const std::vector<std::pair<std::string, std::string>>& rt_info,
+    const LayerParams& params) {
+    auto opsetIt = opsets.find(params.version);
+    if (opsetIt == opsets.end()) {
+        THROW_IE_EXCEPTION << "Cannot create " << params.type << " layer " << params.name
+                           << " id:" << params.layerId
+                           << " from unsupported opset: " << params.version;
+    }
+
+    auto ngraphNode = std::shared_ptr<ngraph::Node>(opsetIt->second.create_insensitive(params.type));
+    if (!ngraphNode) {
+        THROW_IE_EXCEPTION << "Opset " << params.version
+                           << " doesn't contain the operation with type: " << params.type;
+    }
+    // Share Weights form constant blob
+    if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
+        constant->alloc_buffer_on_visit_attributes(false);
+    }
+    ngraphNode->set_arguments(inputs);
+    BinaryDeserializer visitor(attributes, weights, opsets, variables);
+    if (ngraphNode->visit_attributes(visitor)) {
+        ngraphNode->constructor_validate_and_infer_types();
+    }
+
+    // To be sure that all default values will be initialized:
+    ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+
+    // Save run time info
+    auto& rtInfo = ngraphNode->get_rt_info();
+    for (const auto& value : rt_info) {
+        rtInfo[value.first] = std::make_shared<::ngraph::VariantWrapper<std::string>>(value.second);
+    }
+
+    ngraphNode->set_friendly_name(params.name);
+    for (size_t i = 0; i < params.outputNames.size() && i < ngraphNode->get_output_size(); ++i) {
+        if (!params.outputNames[i].empty())
+            ngraphNode->get_output_tensor(i).set_names(params.outputNames[i]);
+    }
+
+    return ngraphNode;
+}
+
+}  // namespace
+
+IRBinParser::IRBinParser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
+    // Load default opsets
+    opsets["opset1"] = ngraph::get_opset1();
+    opsets["opset2"] = ngraph::get_opset2();
+    opsets["opset3"] = ngraph::get_opset3();
+    opsets["opset4"] = ngraph::get_opset4();
+    opsets["opset5"] = ngraph::get_opset5();
+    opsets["opset6"] = ngraph::get_opset6();
+    opsets["opset7"] = ngraph::get_opset7();
+
+    // Load custom opsets
+    for (const auto& ext : exts) {
+        for (const auto& it : ext->getOpSets()) {
+            if (opsets.find(it.first) != opsets.end())
+                THROW_IE_EXCEPTION << "Cannot add opset with name: " << it.first
+                                   << ". Opset with the same name already exists.";
+            opsets[it.first] = it.second;
+        }
+    }
+}
+
+CNNNetwork IRBinParser::parse(const char* begin, const char* end, const Blob::CPtr& weights) {
+    binary_ir::Reader reader(begin, end);
+    std::vector<std::string> strings;
+    if (!reader.read_header(strings)) {
+        THROW_IE_EXCEPTION << "The model is not a binary IR";
+    }
+
+    const std::vector<Attribute> no_attributes;
+    BinaryDeserializer visitor(no_attributes, weights, opsets, variables);
+    auto function = visitor.parse_function(reader);
+
+    OV_ITT_SCOPED_TASK(itt::domains::BinaryIRReader, "ConstructCNNNetwork");
+
+    return CNNNetwork(function, _exts);
+}
+
+}  // namespace InferenceEngine
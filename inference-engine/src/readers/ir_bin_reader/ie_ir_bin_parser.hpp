@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/util/variable.hpp>
+#include <ngraph/opsets/opset.hpp>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_blob.h>
+#include <ie_iextension.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Creates ngraph::Function from the binary IR topology stored in memory
+ */
+class IRBinParser {
+public:
+    explicit IRBinParser(const std::vector<IExtensionPtr>& exts);
+
+    CNNNetwork parse(const char* begin, const char* end, const Blob::CPtr& weights);
+
+private:
+    std::unordered_map<std::string, ngraph::OpSet> opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> variables;
+    const std::vector<IExtensionPtr> _exts;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_ir_bin_reader.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <transformations/binary_ir_format.hpp>
+
+#include "ie_ir_bin_parser.hpp"
+#include "ie_ir_bin_itt.hpp"
+
+using namespace InferenceEngine;
+
+bool IRBinReader::supportModel(std::istream& model) const {
+    OV_ITT_SCOPED_TASK(itt::domains::BinaryIRReader, "IRBinReader::supportModel");
+
+    std::array<char, ngraph::pass::binary_ir::magic_size> header = {};
+
+    model.seekg(0, model.beg);
+    model.read(header.data(), header.size());
+    const bool is_binary_ir = model.gcount() == static_cast<std::streamsize>(header.size()) &&
+        std::equal(header.begin(), header.end(), ngraph::pass::binary_ir::magic());
+    model.clear();
+    model.seekg(0, model.beg);
+
+    return is_binary_ir;
+}
+
+CNNNetwork IRBinReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
+    return read(model, nullptr, exts);
+}
+
+CNNNetwork IRBinReader::read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const {
+    OV_ITT_SCOPED_TASK(itt::domains::BinaryIRReader, "IRBinReader::read");
+
+    // The whole topology is read at once, the parser works with this buffer without copying
+    model.seekg(0, model.end);
+    const auto size = static_cast<size_t>(model.tellg());
+    model.seekg(0, model.beg);
+    std::vector<char> data(size);
+    model.read(data.data(), size);
+    if (static_cast<size_t>(model.gcount()) != size) {
+        THROW_IE_EXCEPTION << "Cannot read binary IR: unexpected end of stream";
+    }
+
+    IRBinParser parser(exts);
+    return parser.parse(data.data(), data.data() + data.size(), weights);
+}
+
+INFERENCE_PLUGIN_API(void) InferenceEngine::CreateReader(std::shared_ptr<IReader>& reader) {
+    reader = std::make_shared<IRBinReader>();
+}
@@ -844,6 +844,11 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
             rtInfo["alt_width"] =
                 std::make_shared<::ngraph::VariantWrapper<std::string>>(aw_data.value());
         }
+        const auto ip_data = dn.attribute("inferencePrecision");
+        if (ip_data) {
+            rtInfo["inferencePrecision"] =
+                std::make_shared<::ngraph::VariantWrapper<std::string>>(ip_data.value());
+        }
     }
 
     ngraphNode->set_friendly_name(params.name);
@@ -18,12 +18,14 @@ namespace pass {
 /**
  * @interface StartSubgraph
  * @brief Matches multiple output loyout-oblivious operations to start a new subgraph
+ * Single output operations start a subgraph as well if tokenize_single_output is set, this is used by plugins
+ * which execute subgraphs of any length, e.g. a chain of unary operations
  * @ingroup snippets
  */
 class TRANSFORMATIONS_API StartSubgraph: public ngraph::pass::MatcherPass {
 public:
     NGRAPH_RTTI_DECLARATION;
-    explicit StartSubgraph(bool tokenize_by_node = false);
+    explicit StartSubgraph(bool tokenize_by_node = false, bool tokenize_single_output = false);
 };
 
 /**
@@ -58,13 +60,14 @@ public:
  * New subgraph is introduced, if number of inputs and outputs exceeds 7 due to scheduling limitation
  * New subgraph is introduced, if multiple outputs of merged nodes are not broadcastable to each other (equality of all outputs is too much on the other hand)
  * Scalar constants are placed as is into subgraph due to optimization purpose
+ * Operations for which transformation callback returns true are left as is, so plugin can keep its own fusings
  * @ingroup snippets
  */
 class TRANSFORMATIONS_API TokenizeSnippets: public ngraph::pass::GraphRewrite {
 public:
     NGRAPH_RTTI_DECLARATION;
-    TokenizeSnippets(bool tokenize_by_node = false) {
-        add_matcher<ngraph::snippets::pass::StartSubgraph>(tokenize_by_node);
+    TokenizeSnippets(bool tokenize_by_node = false, bool tokenize_single_output = false) {
+        add_matcher<ngraph::snippets::pass::StartSubgraph>(tokenize_by_node, tokenize_single_output);
         add_matcher<ngraph::snippets::pass::AttachToSubgraph>(tokenize_by_node);
     }
 };
@@ -209,7 +209,7 @@ auto has_supported_in_out(std::shared_ptr<Node> n) -> bool {
 
 } // namespace
 
-ngraph::snippets::pass::StartSubgraph::StartSubgraph(bool tokenize_by_node) : MatcherPass() {
+ngraph::snippets::pass::StartSubgraph::StartSubgraph(bool tokenize_by_node, bool tokenize_single_output) : MatcherPass() {
     MATCHER_SCOPE(StartSubgraph);
 
     auto has_multiple_output_edges = [](std::shared_ptr<Node> n) -> bool {
@@ -222,14 +222,17 @@ ngraph::snippets::pass::StartSubgraph::StartSubgraph(bool tokenize_by_node) : Ma
 
     register_matcher(std::make_shared<pattern::Matcher>(
         std::make_shared<pattern::op::Label>(pattern::any_input(),
-        [tokenize_by_node, has_multiple_output_edges](std::shared_ptr<Node> n) {
+        [tokenize_by_node, tokenize_single_output, has_multiple_output_edges](std::shared_ptr<Node> n) {
             return is_lo(n) &&
                    has_supported_in_out(n) &&
                    (tokenize_by_node || !has_subgraph_as_input(n)) &&
-                   has_multiple_output_edges(n);
+                   (tokenize_single_output || has_multiple_output_edges(n));
         })),
-        [](ngraph::pattern::Matcher &m) -> bool {
+        [this](ngraph::pattern::Matcher &m) -> bool {
         auto node = m.get_match_root();
+        if (transformation_callback(node)) {
+            return false;
+        }
 
         remark(1) << "Match root"
                   << node->get_friendly_name()
@@ -257,8 +260,11 @@ ngraph::snippets::pass::AttachToSubgraph::AttachToSubgraph(bool tokenize_by_node
 
     continuation_strategy strategy = continuation_strategy::abort;
 
-    ngraph::graph_rewrite_callback continuation_callback = [strategy](ngraph::pattern::Matcher &m) -> bool {
+    ngraph::graph_rewrite_callback continuation_callback = [this, strategy](ngraph::pattern::Matcher &m) -> bool {
         auto node = m.get_match_root();
+        if (transformation_callback(node)) {
+            return false;
+        }
 
         remark(1) << "Match root " << node->get_friendly_name() << " " << node << std::endl;
 
@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace op {
+namespace internal {
+
+/**
+ * @brief Computes softmax(q * k^T * scale + mask) * v for every head.
+ * q has shape [B, H, Lq, D], k has shape [B, H, Lk, D] if transpose_k is true and [B, H, D, Lk] otherwise,
+ * v has shape [B, H, Lk, Dv], optional mask is numpy broadcastable to [B, H, Lq, Lk].
+ * Output has shape [B, H, Lq, Dv].
+ */
+class TRANSFORMATIONS_API ScaledDotProductAttention : public Op {
+public:
+    static constexpr NodeTypeInfo type_info{"ScaledDotProductAttention", 0};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    ScaledDotProductAttention(const Output<Node>& q,
+                              const Output<Node>& k,
+                              const Output<Node>& v,
+                              float scale,
+                              bool transpose_k);
+
+    ScaledDotProductAttention(const Output<Node>& q,
+                              const Output<Node>& k,
+                              const Output<Node>& v,
+                              const Output<Node>& mask,
+                              float scale,
+                              bool transpose_k);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_k() const { return m_transpose_k; }
+
+private:
+    float m_scale;
+    bool m_transpose_k;
+};
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ngraph
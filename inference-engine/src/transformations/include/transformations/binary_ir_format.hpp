@@ -0,0 +1,256 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Binary IR topology format written by ngraph::pass::Serialize with
+ * Version::IR_V10_BINARY and read by the Inference Engine binary IR reader.
+ *
+ * The file keeps the same information as IR v10 XML, but without any text:
+ * all values are stored in the native binary form and every string (names, types,
+ * string attributes) is stored once in the string table and referenced by index.
+ * Weights are not a part of the topology, they are written to the .bin file with
+ * exactly the same layout as for XML IR, so both formats may share one weights file.
+ *
+ *   file      := magic[8] format_version:u32 string_count:u32 string[string_count] function
+ *   string    := length:u32 char[length]
+ *   function  := name:str layer_count:u32 layer[layer_count]
+ *                parameter_count:u32 layer_id:u32[parameter_count]
+ *                result_count:u32 layer_id:u32[result_count]
+ *                sink_count:u32 layer_id:u32[sink_count]
+ *   layer     := type:str opset:str name:str
+ *                input_count:u32 (source_layer:u32 source_output:u32)[input_count]
+ *                output_count:u32 (name_count:u32 str[name_count])[output_count]
+ *                rt_info_count:u32 (key:str value:str)[rt_info_count]
+ *                attribute* AttributeType::End
+ *   attribute := type:u8 name:str payload_size:u64 payload
+ *
+ * Here str is an u32 index in the string table. Layers are stored in topological order,
+ * so every input refers to one of the previous layers of the same function. Numbers are
+ * stored in the byte order of the writing machine (little-endian on all supported
+ * platforms) and read with memcpy, so the records are parsed in place without any unpacking
+ * and need no alignment. The reader gets the model as a stream from the Core, so the topology
+ * is copied once into a single buffer before parsing; the file is not mapped to memory.
+ * @file binary_ir_format.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <ngraph/check.hpp>
+
+namespace ngraph {
+namespace pass {
+namespace binary_ir {
+
+/// \brief First bytes of every binary IR file
+inline const char* magic() {
+    return "OVIRBIN";  // 7 characters + terminating zero
+}
+constexpr size_t magic_size = 8;
+constexpr uint32_t format_version = 1;
+
+enum class AttributeType : uint8_t {
+    End = 0,
+    Bool,
+    String,
+    Int64,
+    Double,
+    Int32Vector,
+    Int64Vector,
+    UInt64Vector,
+    FloatVector,
+    StringVector,
+    // Nested ngraph::Function of TensorIterator and Loop
+    Function,
+    // offset:u64 size:u64 of Constant data in the weights file
+    ConstantData,
+    // variable_id:str
+    Variable,
+    // count:u32 (InputDescriptionType input_index:u64 body_parameter_index:u64 ...)[count]
+    InputDescriptions,
+    // count:u32 (OutputDescriptionType body_value_index:u64 output_index:u64 ...)[count]
+    OutputDescriptions,
+    // current_iteration_input_idx:i64 body_condition_output_idx:i64
+    SpecialBodyPorts,
+};
+
+enum class InputDescriptionType : uint8_t {
+    Invariant = 0,
+    // start:i64 stride:i64 part_size:i64 end:i64 axis:i64
+    Slice,
+    // body_value_index:u64
+    Merged,
+};
+
+enum class OutputDescriptionType : uint8_t {
+    // iteration:i64
+    Body = 0,
+    // start:i64 stride:i64 part_size:i64 end:i64 axis:i64
+    Concat,
+};
+
+/// \brief Accumulates binary IR topology in memory and writes it with the string table
+class Writer {
+public:
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Only numbers and enums can be written");
+        const auto bytes = reinterpret_cast<const char*>(&value);
+        m_data.insert(m_data.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <typename T>
+    void write_vector(const std::vector<T>& values) {
+        write(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            write(value);
+        }
+    }
+
+    void write_string(const std::string& value) {
+        auto found = m_string_ids.find(value);
+        if (found == m_string_ids.end()) {
+            found = m_string_ids.emplace(value, static_cast<uint32_t>(m_strings.size())).first;
+            m_strings.push_back(value);
+        }
+        write(found->second);
+    }
+
+    void write_string_vector(const std::vector<std::string>& values) {
+        write(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            write_string(value);
+        }
+    }
+
+    /// \brief Starts attribute record. Payload size is filled by end_attribute.
+    size_t begin_attribute(AttributeType type, const std::string& name) {
+        write(type);
+        write_string(name);
+        write(uint64_t{0});
+        return m_data.size();
+    }
+
+    void end_attribute(size_t payload_begin) {
+        const uint64_t size = m_data.size() - payload_begin;
+        std::memcpy(&m_data[payload_begin - sizeof(size)], &size, sizeof(size));
+    }
+
+    void save(std::ostream& stream) const {
+        stream.write(magic(), magic_size);
+        const uint32_t string_count = static_cast<uint32_t>(m_strings.size());
+        stream.write(reinterpret_cast<const char*>(&format_version), sizeof(format_version));
+        stream.write(reinterpret_cast<const char*>(&string_count), sizeof(string_count));
+        for (const auto& value : m_strings) {
+            const uint32_t length = static_cast<uint32_t>(value.size());
+            stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            stream.write(value.data(), value.size());
+        }
+        stream.write(m_data.data(), m_data.size());
+    }
+
+private:
+    std::vector<char> m_data;
+    std::vector<std::string> m_strings;
+    std::unordered_map<std::string, uint32_t> m_string_ids;
+};
+
+/// \brief Reads values of binary IR topology from the memory buffer
+class Reader {
+public:
+    Reader(const char* begin, const char* end, const std::vector<std::string>* strings = nullptr)
+        : m_pos(begin), m_end(end), m_strings(strings) {}
+
+    /// \brief Checks the header and reads the string table which is used by this reader
+    /// afterwards. Returns false if the buffer doesn't start with the binary IR magic.
+    bool read_header(std::vector<std::string>& strings) {
+        if (static_cast<size_t>(m_end - m_pos) < magic_size ||
+            std::memcmp(m_pos, magic(), magic_size) != 0) {
+            return false;
+        }
+        m_pos += magic_size;
+        const auto version = read<uint32_t>();
+        NGRAPH_CHECK(version == format_version, "Unsupported binary IR format version: ", version);
+        const auto string_count = read<uint32_t>();
+        strings.clear();
+        strings.reserve(string_count);
+        for (uint32_t i = 0; i < string_count; ++i) {
+            const auto length = read<uint32_t>();
+            strings.emplace_back(skip(length), length);
+        }
+        m_strings = &strings;
+        return true;
+    }
+
+    template <typename T>
+    T read() {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Only numbers and enums can be read");
+        T value;
+        std::memcpy(&value, skip(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> read_vector() {
+        const auto size = read<uint32_t>();
+        std::vector<T> values(size);
+        if (size) {
+            std::memcpy(&values[0], skip(size * sizeof(T)), size * sizeof(T));
+        }
+        return values;
+    }
+
+    const std::string& read_string() {
+        const auto id = read<uint32_t>();
+        NGRAPH_CHECK(m_strings && id < m_strings->size(), "Incorrect string index in binary IR: ", id);
+        return (*m_strings)[id];
+    }
+
+    std::vector<std::string> read_string_vector() {
+        const auto size = read<uint32_t>();
+        std::vector<std::string> values;
+        values.reserve(size);
+        for (uint32_t i = 0; i < size; ++i) {
+            values.push_back(read_string());
+        }
+        return values;
+    }
+
+    /// \brief Returns current position and moves it forward by the given number of bytes
+    const char* skip(size_t size) {
+        NGRAPH_CHECK(static_cast<size_t>(m_end - m_pos) >= size, "Unexpected end of binary IR");
+        const char* pos = m_pos;
+        m_pos += size;
+        return pos;
+    }
+
+    /// \brief Returns reader of the given number of bytes starting from the current position
+    /// and moves current position after them
+    Reader sub_reader(size_t size) {
+        const char* begin = skip(size);
+        return Reader(begin, m_pos, m_strings);
+    }
+
+    bool empty() const {
+        return m_pos == m_end;
+    }
+
+private:
+    const char* m_pos;
+    const char* m_end;
+    const std::vector<std::string>* m_strings;
+};
+
+}  // namespace binary_ir
+}  // namespace pass
+}  // namespace ngraph
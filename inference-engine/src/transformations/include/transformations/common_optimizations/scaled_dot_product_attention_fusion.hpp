@@ -0,0 +1,32 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include <transformations_visibility.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API ScaledDotProductAttentionFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ScaledDotProductAttentionFusion transformation replaces group of
+ * operations: MatMul(Softmax(MatMul(q, k) * scale + mask), v) with 4D static inputs
+ * to ScaledDotProductAttention op. Multiply (or Divide) by a scalar constant and Add of the mask are optional.
+ * The transformation isn't a part of CommonOptimizations since the op is supported by CPU plugin only.
+ */
+class ngraph::pass::ScaledDotProductAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledDotProductAttentionFusion();
+};
@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include <transformations_visibility.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API DisableCompressedWeightsConstantFolding;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief DisableCompressedWeightsConstantFolding keeps low precision MatMul weights compressed: Convert of
+ * the weights Constant is marked by DISABLED_CONSTANT_FOLDING when it is followed by the chain of per output
+ * channel Subtract/Add/Multiply operations with Constants which ends at the MatMul weights input:
+ *
+ *   Constant (u8/i8)
+ *       |
+ *    Convert    Constant
+ *        \       /
+ *        Subtract    Constant
+ *            \        /
+ *             Multiply
+ *                |
+ *    Data     [O, K]
+ *      \        /
+ *   MatMul (transpose_b = true)
+ *
+ * So the plugin gets low precision weights with the decompression operations and can decompress them on the fly.
+ * The MatMul source has to be FP32 of rank 2 or 3 and not consumed by a node with BF16 inference precision.
+ */
+class ngraph::pass::DisableCompressedWeightsConstantFolding : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    DisableCompressedWeightsConstantFolding(
+        const std::vector<ngraph::element::Type>& weightsPrecisions = { ngraph::element::u8, ngraph::element::i8 });
+};
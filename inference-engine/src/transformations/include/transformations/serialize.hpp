@@ -25,10 +25,13 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - Version::IR_V10_BINARY writes the topology in the binary format described in
+ * binary_ir_format.hpp instead of XML, the model path must have '.irb' extension.
+ * Weights file is the same for both versions
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
-    enum class Version { IR_V10 };
+    enum class Version { IR_V10, IR_V10_BINARY };
     NGRAPH_RTTI_DECLARATION;
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_ops/scaled_dot_product_attention.hpp"
+#include "itt.hpp"
+
+#include <memory>
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::internal::ScaledDotProductAttention::type_info;
+
+op::internal::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& q,
+                                                                   const Output<Node>& k,
+                                                                   const Output<Node>& v,
+                                                                   float scale,
+                                                                   bool transpose_k)
+        : Op({q, k, v}), m_scale(scale), m_transpose_k(transpose_k) {
+    constructor_validate_and_infer_types();
+}
+
+op::internal::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& q,
+                                                                   const Output<Node>& k,
+                                                                   const Output<Node>& v,
+                                                                   const Output<Node>& mask,
+                                                                   float scale,
+                                                                   bool transpose_k)
+        : Op({q, k, v, mask}), m_scale(scale), m_transpose_k(transpose_k) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> op::internal::ScaledDotProductAttention::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(internal_ScaledDotProductAttention_clone_with_new_inputs);
+    if (new_args.size() == 4) {
+        return make_shared<ScaledDotProductAttention>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                      m_scale, m_transpose_k);
+    } else if (new_args.size() == 3) {
+        return make_shared<ScaledDotProductAttention>(new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_transpose_k);
+    }
+    throw ngraph::ngraph_error("Unsupported number of inputs: " + std::to_string(new_args.size()));
+}
+
+bool op::internal::ScaledDotProductAttention::visit_attributes(AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(internal_ScaledDotProductAttention_visit_attributes);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    return true;
+}
+
+void op::internal::ScaledDotProductAttention::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(internal_ScaledDotProductAttention_validate_and_infer_types);
+    const auto& q_ps = get_input_partial_shape(0);
+    const auto& k_ps = get_input_partial_shape(1);
+    const auto& v_ps = get_input_partial_shape(2);
+
+    NODE_VALIDATION_CHECK(this, q_ps.rank().compatible(4) && k_ps.rank().compatible(4) && v_ps.rank().compatible(4),
+                          "Query, key and value are expected to be 4D tensors");
+
+    PartialShape out_shape = PartialShape::dynamic(4);
+    if (q_ps.rank().is_static() && v_ps.rank().is_static()) {
+        out_shape = {q_ps[0], q_ps[1], q_ps[2], v_ps[3]};
+
+        if (k_ps.rank().is_static()) {
+            const auto& k_depth = m_transpose_k ? k_ps[3] : k_ps[2];
+            const auto& k_length = m_transpose_k ? k_ps[2] : k_ps[3];
+            NODE_VALIDATION_CHECK(this, q_ps[3].compatible(k_depth),
+                                  "Depth of query ", q_ps[3], " doesn't match depth of key ", k_depth);
+            NODE_VALIDATION_CHECK(this, v_ps[2].compatible(k_length),
+                                  "Length of value ", v_ps[2], " doesn't match length of key ", k_length);
+        }
+    }
+
+    set_output_type(0, get_input_element_type(0), out_shape);
+}
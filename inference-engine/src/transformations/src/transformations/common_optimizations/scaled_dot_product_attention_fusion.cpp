@@ -0,0 +1,135 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt.hpp"
+#include "transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp"
+#include "ngraph_ops/scaled_dot_product_attention.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ScaledDotProductAttentionFusion, "ScaledDotProductAttentionFusion", 0);
+
+namespace {
+bool has_single_consumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+bool get_scalar_value(const ngraph::Output<ngraph::Node>& output, float& value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+}  // namespace
+
+ngraph::pass::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    MATCHER_SCOPE(ScaledDotProductAttentionFusion);
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax>(ngraph::pattern::consumers_count(1));
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax, ngraph::pattern::any_input()});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto &pattern_to_output = m.get_pattern_value_map();
+        auto matmul_sv = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output.at(matmul).get_node_shared_ptr());
+        auto softmax_node = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(pattern_to_output.at(softmax).get_node_shared_ptr());
+        if (!matmul_sv || !softmax_node || matmul_sv->get_transpose_a() || matmul_sv->get_transpose_b())
+            return false;
+
+        const auto& scores_ps = softmax_node->get_output_partial_shape(0);
+        if (scores_ps.is_dynamic() || scores_ps.rank().get_length() != 4 || softmax_node->get_axis() != 3)
+            return false;
+        const auto scores_shape = scores_ps.to_shape();
+
+        ngraph::NodeVector fused_nodes = {matmul_sv, softmax_node};
+        auto current = softmax_node->input_value(0);
+
+        // optional mask, the other input of Add continues the chain
+        std::shared_ptr<ngraph::Node> mask;
+        if (auto add = std::dynamic_pointer_cast<ngraph::opset1::Add>(current.get_node_shared_ptr())) {
+            if (!has_single_consumer(current))
+                return false;
+            size_t chain_port = 0;
+            if (!ngraph::is_type<ngraph::opset1::MatMul>(add->get_input_node_ptr(0)) &&
+                !ngraph::is_type<ngraph::opset1::Multiply>(add->get_input_node_ptr(0)) &&
+                !ngraph::is_type<ngraph::opset1::Divide>(add->get_input_node_ptr(0)))
+                chain_port = 1;
+            const auto& mask_ps = add->get_input_partial_shape(1 - chain_port);
+            if (mask_ps.is_dynamic() || mask_ps.rank().get_length() > 4 ||
+                add->get_input_element_type(1 - chain_port) != ngraph::element::f32 ||
+                add->get_input_partial_shape(chain_port) != scores_ps)
+                return false;
+            mask = add->input_value(1 - chain_port).get_node_shared_ptr();
+            fused_nodes.push_back(add);
+            current = add->input_value(chain_port);
+        }
+
+        // optional scale by a scalar constant
+        float scale = 1.f;
+        auto scale_node = current.get_node_shared_ptr();
+        if (ngraph::is_type<ngraph::opset1::Multiply>(scale_node) || ngraph::is_type<ngraph::opset1::Divide>(scale_node)) {
+            if (!has_single_consumer(current))
+                return false;
+            size_t chain_port = 0;
+            if (get_scalar_value(scale_node->input_value(1), scale)) {
+                chain_port = 0;
+            } else if (ngraph::is_type<ngraph::opset1::Multiply>(scale_node) && get_scalar_value(scale_node->input_value(0), scale)) {
+                chain_port = 1;
+            } else {
+                return false;
+            }
+            if (ngraph::is_type<ngraph::opset1::Divide>(scale_node)) {
+                if (scale == 0.f)
+                    return false;
+                scale = 1.f / scale;
+            }
+            if (scale_node->get_input_partial_shape(chain_port) != scores_ps)
+                return false;
+            fused_nodes.push_back(scale_node);
+            current = scale_node->input_value(chain_port);
+        }
+
+        auto matmul_qk = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(current.get_node_shared_ptr());
+        if (!matmul_qk || !has_single_consumer(current) || matmul_qk->get_transpose_a())
+            return false;
+        fused_nodes.push_back(matmul_qk);
+
+        auto q = matmul_qk->input_value(0);
+        auto k = matmul_qk->input_value(1);
+        auto v = matmul_sv->input_value(1);
+        for (const auto& input : {q, k, v}) {
+            if (input.get_partial_shape().is_dynamic() || input.get_shape().size() != 4 ||
+                input.get_element_type() != ngraph::element::f32)
+                return false;
+        }
+        // batch and head dimensions are not broadcasted by the fused op
+        if (q.get_shape()[0] != scores_shape[0] || q.get_shape()[1] != scores_shape[1] ||
+            k.get_shape()[0] != scores_shape[0] || k.get_shape()[1] != scores_shape[1] ||
+            v.get_shape()[0] != scores_shape[0] || v.get_shape()[1] != scores_shape[1])
+            return false;
+
+        std::shared_ptr<ngraph::Node> attention;
+        if (mask) {
+            attention = std::make_shared<ngraph::op::internal::ScaledDotProductAttention>(q, k, v, mask, scale,
+                                                                                         matmul_qk->get_transpose_b());
+        } else {
+            attention = std::make_shared<ngraph::op::internal::ScaledDotProductAttention>(q, k, v, scale,
+                                                                                         matmul_qk->get_transpose_b());
+        }
+        if (attention->get_output_partial_shape(0) != matmul_sv->get_output_partial_shape(0))
+            return false;
+
+        attention->set_friendly_name(matmul_sv->get_friendly_name());
+        ngraph::copy_runtime_info(fused_nodes, attention);
+        ngraph::replace_node(matmul_sv, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
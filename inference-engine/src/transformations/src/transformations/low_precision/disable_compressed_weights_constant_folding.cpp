@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/low_precision/disable_compressed_weights_constant_folding.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/variant.hpp>
+
+using namespace ngraph;
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::DisableCompressedWeightsConstantFolding, "DisableCompressedWeightsConstantFolding", 0);
+
+ngraph::pass::DisableCompressedWeightsConstantFolding::DisableCompressedWeightsConstantFolding(
+    const std::vector<ngraph::element::Type>& weightsPrecisions) {
+    auto matcherWeights = ngraph::pattern::wrap_type<opset1::Constant>();
+    auto matcherConvert = ngraph::pattern::wrap_type<opset1::Convert>({ matcherWeights }, pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher & m) -> bool {
+        const auto& opsMap = m.get_pattern_value_map();
+        const auto convert = opsMap.at(matcherConvert).get_node_shared_ptr();
+
+        const ngraph::element::Type weightsPrecision = convert->get_input_element_type(0);
+        if (std::find(weightsPrecisions.begin(), weightsPrecisions.end(), weightsPrecision) == weightsPrecisions.end() ||
+            convert->get_output_element_type(0) != element::f32) {
+            return false;
+        }
+
+        const auto weightsShape = convert->get_output_partial_shape(0);
+        if (weightsShape.is_dynamic() || weightsShape.rank().get_length() != 2) {
+            return false;
+        }
+        const auto OC = weightsShape.to_shape()[0];
+
+        // zero points and scales have to be per output channel to be applied to the whole rows of weights
+        auto isPerOutputChannel = [OC](const Shape& shape) {
+            const auto size = shape_size(shape);
+            return shape.size() <= 2 && (size == 1 || (size == OC && shape.size() == 2 && shape[1] == 1));
+        };
+
+        // the same conditions the plugin checks to decompress the weights on the fly, the weights are folded otherwise:
+        // FP32 source of rank 2 or 3 which isn't kept in BF16 for a consumer with BF16 inference precision
+        auto hasBF16InferencePrecision = [](const Node* node) {
+            const auto& rtInfo = node->get_rt_info();
+            const auto precision = rtInfo.find("inferencePrecision");
+            if (precision == rtInfo.end()) {
+                return false;
+            }
+            const auto value = std::dynamic_pointer_cast<VariantWrapper<std::string>>(precision->second);
+            if (!value) {
+                return false;
+            }
+            std::string name = value->get();
+            std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+            return name == "BF16";
+        };
+        auto isDecompressionApplicable = [&](const Output<Node>& source) {
+            const auto rank = source.get_partial_shape().rank();
+            if (source.get_element_type() != element::f32 || rank.is_dynamic() ||
+                (rank.get_length() != 2 && rank.get_length() != 3)) {
+                return false;
+            }
+            for (const auto& consumer : source.get_node()->outputs()) {
+                for (const auto& input : consumer.get_target_inputs()) {
+                    if (hasBF16InferencePrecision(input.get_node())) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        std::shared_ptr<Node> node = convert;
+        while (true) {
+            const auto targetInputs = node->output(0).get_target_inputs();
+            if (targetInputs.size() != 1) {
+                return false;
+            }
+            const auto targetInput = *targetInputs.begin();
+            const auto child = targetInput.get_node()->shared_from_this();
+
+            if (const auto matmul = as_type_ptr<opset1::MatMul>(child)) {
+                if (targetInput.get_index() != 1 || !matmul->get_transpose_b() || node == convert ||
+                    !isDecompressionApplicable(matmul->input_value(0))) {
+                    return false;
+                }
+                break;
+            }
+
+            if (!is_type<opset1::Subtract>(child) && !is_type<opset1::Add>(child) && !is_type<opset1::Multiply>(child)) {
+                return false;
+            }
+            const auto constant = as_type_ptr<opset1::Constant>(child->get_input_node_shared_ptr(1));
+            if (targetInput.get_index() != 0 || !constant || !isPerOutputChannel(constant->get_shape()) ||
+                child->get_output_partial_shape(0) != weightsShape) {
+                return false;
+            }
+            node = child;
+        }
+
+        auto& rtInfo = convert->get_rt_info();
+        rtInfo["DISABLED_CONSTANT_FOLDING"] = std::make_shared<VariantWrapper<std::string>>("");
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matcherConvert, "DisableCompressedWeightsConstantFolding");
+    this->register_matcher(m, callback);
+}
@@ -14,9 +14,11 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
 #include "pugixml.hpp"
+#include "transformations/binary_ir_format.hpp"
 #include "transformations/serialize.hpp"
 
 using namespace ngraph;
+namespace binary_ir = ngraph::pass::binary_ir;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::Serialize, "Serialize", 0);
 
@@ -81,6 +83,7 @@ namespace rt_info {
 const std::vector<std::string> list_of_names {
     "PrimitivesPriority",
     "alt_width",
+    "inferencePrecision",
 };
 
 class XmlSerializer {
@@ -714,6 +717,260 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
         f.validate_nodes_and_infer_types();
     }
 }
+
+void ngfunction_2_binary(binary_ir::Writer& writer,
+                         std::ostream& bin_file,
+                         const ngraph::Function& f,
+                         const std::map<std::string, ngraph::OpSet>& custom_opsets);
+
+class BinarySerializer : public ngraph::AttributeVisitor {
+    binary_ir::Writer& m_writer;
+    std::ostream& m_bin_data;
+    const std::string& m_node_type_name;
+    const std::map<std::string, ngraph::OpSet>& m_custom_opsets;
+
+    template <typename T>
+    void write_value(binary_ir::AttributeType type, const std::string& name, const T& value) {
+        const auto payload = m_writer.begin_attribute(type, name);
+        m_writer.write(value);
+        m_writer.end_attribute(payload);
+    }
+
+    template <typename T>
+    void write_vector(binary_ir::AttributeType type, const std::string& name, const std::vector<T>& value) {
+        const auto payload = m_writer.begin_attribute(type, name);
+        m_writer.write_vector(value);
+        m_writer.end_attribute(payload);
+    }
+
+    void write_slice(int64_t start, int64_t stride, int64_t part_size, int64_t end, int64_t axis) {
+        m_writer.write(start);
+        m_writer.write(stride);
+        m_writer.write(part_size);
+        m_writer.write(end);
+        m_writer.write(axis);
+    }
+
+public:
+    BinarySerializer(binary_ir::Writer& writer,
+                     std::ostream& bin_data,
+                     const std::string& node_type_name,
+                     const std::map<std::string, ngraph::OpSet>& custom_opsets)
+        : m_writer(writer)
+        , m_bin_data(bin_data)
+        , m_node_type_name(node_type_name)
+        , m_custom_opsets(custom_opsets) {
+    }
+
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<void>& adapter) override {
+        using SubGraphOp = ngraph::op::util::SubGraphOp;
+        // Port maps of TI and Loop are stored with the raw body parameter/result indices,
+        // so there is no need to resolve them to the layer ids as XML IR does
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<SubGraphOp::InputDescription>>>>(&adapter)) {
+            const auto payload = m_writer.begin_attribute(binary_ir::AttributeType::InputDescriptions, name);
+            m_writer.write(static_cast<uint32_t>(a->get().size()));
+            for (const auto& input_description : a->get()) {
+                if (auto slice_input = as_type_ptr<SubGraphOp::SliceInputDescription>(input_description)) {
+                    m_writer.write(binary_ir::InputDescriptionType::Slice);
+                    m_writer.write(input_description->m_input_index);
+                    m_writer.write(input_description->m_body_parameter_index);
+                    write_slice(slice_input->m_start, slice_input->m_stride, slice_input->m_part_size,
+                                slice_input->m_end, slice_input->m_axis);
+                } else if (auto merged_input = as_type_ptr<SubGraphOp::MergedInputDescription>(input_description)) {
+                    m_writer.write(binary_ir::InputDescriptionType::Merged);
+                    m_writer.write(input_description->m_input_index);
+                    m_writer.write(input_description->m_body_parameter_index);
+                    m_writer.write(merged_input->m_body_value_index);
+                } else {
+                    m_writer.write(binary_ir::InputDescriptionType::Invariant);
+                    m_writer.write(input_description->m_input_index);
+                    m_writer.write(input_description->m_body_parameter_index);
+                }
+            }
+            m_writer.end_attribute(payload);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<
+                       std::vector<std::shared_ptr<SubGraphOp::OutputDescription>>>>(&adapter)) {
+            const auto payload = m_writer.begin_attribute(binary_ir::AttributeType::OutputDescriptions, name);
+            m_writer.write(static_cast<uint32_t>(a->get().size()));
+            for (const auto& output_description : a->get()) {
+                if (auto concat_output = as_type_ptr<SubGraphOp::ConcatOutputDescription>(output_description)) {
+                    m_writer.write(binary_ir::OutputDescriptionType::Concat);
+                    m_writer.write(output_description->m_body_value_index);
+                    m_writer.write(output_description->m_output_index);
+                    write_slice(concat_output->m_start, concat_output->m_stride, concat_output->m_part_size,
+                                concat_output->m_end, concat_output->m_axis);
+                } else if (auto body_output = as_type_ptr<SubGraphOp::BodyOutputDescription>(output_description)) {
+                    m_writer.write(binary_ir::OutputDescriptionType::Body);
+                    m_writer.write(output_description->m_body_value_index);
+                    m_writer.write(output_description->m_output_index);
+                    m_writer.write(body_output->m_iteration);
+                } else {
+                    NGRAPH_CHECK(false, "Unsupported output description type: ",
+                                 output_description->get_type_info().name);
+                }
+            }
+            m_writer.end_attribute(payload);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            const auto payload = m_writer.begin_attribute(binary_ir::AttributeType::SpecialBodyPorts, name);
+            m_writer.write(a->get().current_iteration_input_idx);
+            m_writer.write(a->get().body_condition_output_idx);
+            m_writer.end_attribute(payload);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            const auto payload = m_writer.begin_attribute(binary_ir::AttributeType::Variable, name);
+            m_writer.write_string(a->get()->get_info().variable_id);
+            m_writer.end_attribute(payload);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            if (name == "value" && m_node_type_name == "Constant") {
+                const uint64_t size = a->get()->size();
+                const uint64_t offset = m_bin_data.tellp();
+
+                const auto payload = m_writer.begin_attribute(binary_ir::AttributeType::ConstantData, name);
+                m_writer.write(offset);
+                m_writer.write(size);
+                m_writer.end_attribute(payload);
+
+                auto data = static_cast<const char*>(a->get()->get_ptr());
+                m_bin_data.write(data, size);
+            }
+        }
+    }
+
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<bool>& adapter) override {
+        write_value(binary_ir::AttributeType::Bool, name, static_cast<uint8_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::string>& adapter) override {
+        const auto payload = m_writer.begin_attribute(binary_ir::AttributeType::String, name);
+        m_writer.write_string(adapter.get());
+        m_writer.end_attribute(payload);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<int64_t>& adapter) override {
+        write_value(binary_ir::AttributeType::Int64, name, adapter.get());
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<double>& adapter) override {
+        write_value(binary_ir::AttributeType::Double, name, adapter.get());
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        write_vector(binary_ir::AttributeType::Int32Vector, name, adapter.get());
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_vector(binary_ir::AttributeType::Int64Vector, name, adapter.get());
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_vector(binary_ir::AttributeType::UInt64Vector, name, adapter.get());
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        write_vector(binary_ir::AttributeType::FloatVector, name, adapter.get());
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        const auto payload = m_writer.begin_attribute(binary_ir::AttributeType::StringVector, name);
+        m_writer.write_string_vector(adapter.get());
+        m_writer.end_attribute(payload);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        NGRAPH_CHECK(name == "body", "Unsupported Function name.");
+        const auto payload = m_writer.begin_attribute(binary_ir::AttributeType::Function, name);
+        ngfunction_2_binary(m_writer, m_bin_data, *adapter.get(), m_custom_opsets);
+        m_writer.end_attribute(payload);
+    }
+};
+
+void ngfunction_2_binary(binary_ir::Writer& writer,
+                         std::ostream& bin_file,
+                         const ngraph::Function& f,
+                         const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    NGRAPH_CHECK(!is_exec_graph(f), "Execution graph can't be serialized to binary IR");
+
+    const auto ordered_ops = f.get_ordered_ops();
+    const std::unordered_map<ngraph::Node*, int> layer_ids = create_layer_ids(f);
+    std::unordered_set<std::string> unique_names;
+
+    writer.write_string(f.get_friendly_name());
+    writer.write(static_cast<uint32_t>(ordered_ops.size()));
+    for (const auto& n : ordered_ops) {
+        ngraph::Node* node = n.get();
+        const std::string node_type_name{node->get_type_name()};
+
+        writer.write_string(node_type_name);
+        writer.write_string(get_opset_name(node, custom_opsets));
+        writer.write_string(get_node_unique_name(unique_names, node));
+
+        writer.write(static_cast<uint32_t>(node->get_input_size()));
+        for (const auto& i : node->inputs()) {
+            const auto source_output = i.get_source_output();
+            const auto source_id = layer_ids.find(source_output.get_node());
+            NGRAPH_CHECK(source_id != layer_ids.end(), "Internal error");
+            writer.write(static_cast<uint32_t>(source_id->second));
+            writer.write(static_cast<uint32_t>(source_output.get_index()));
+        }
+
+        writer.write(static_cast<uint32_t>(node->get_output_size()));
+        for (const auto& o : node->outputs()) {
+            const auto& names = o.get_tensor().get_names();
+            writer.write_string_vector(std::vector<std::string>(names.begin(), names.end()));
+        }
+
+        const auto& node_rt_info = node->get_rt_info();
+        std::vector<std::pair<std::string, std::string>> rt_info_values;
+        for (const auto& rt_info_name : rt_info::list_of_names) {
+            const auto found = node_rt_info.find(rt_info_name);
+            if (found == node_rt_info.end()) {
+                continue;
+            }
+            if (auto v = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(found->second)) {
+                rt_info_values.emplace_back(rt_info_name, v->get());
+            }
+        }
+        writer.write(static_cast<uint32_t>(rt_info_values.size()));
+        for (const auto& value : rt_info_values) {
+            writer.write_string(value.first);
+            writer.write_string(value.second);
+        }
+
+        BinarySerializer visitor(writer, bin_file, node_type_name, custom_opsets);
+        NGRAPH_CHECK(node->visit_attributes(visitor), "Visitor API is not supported in ", node);
+        writer.write(binary_ir::AttributeType::End);
+    }
+
+    const auto write_ids = [&](const std::vector<ngraph::Node*>& nodes) {
+        writer.write(static_cast<uint32_t>(nodes.size()));
+        for (const auto node : nodes) {
+            writer.write(static_cast<uint32_t>(layer_ids.at(node)));
+        }
+    };
+    std::vector<ngraph::Node*> nodes;
+    for (const auto& parameter : f.get_parameters()) {
+        nodes.push_back(parameter.get());
+    }
+    write_ids(nodes);
+    nodes.clear();
+    for (const auto& result : f.get_results()) {
+        nodes.push_back(result.get());
+    }
+    write_ids(nodes);
+    nodes.clear();
+    for (const auto& sink : f.get_sinks()) {
+        nodes.push_back(sink.get());
+    }
+    write_ids(nodes);
+}
 }  // namespace
 
 // ! [function_pass:serialize_cpp]
@@ -736,6 +993,16 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
                 bin_file.flush();
             }
             break;
+        case Version::IR_V10_BINARY:
+            {
+                binary_ir::Writer writer;
+                ngfunction_2_binary(writer, bin_file, *f, m_custom_opsets);
+
+                writer.save(xml_file);
+                xml_file.flush();
+                bin_file.flush();
+            }
+            break;
         default:
             NGRAPH_UNREACHABLE("Unsupported version");
             break;
@@ -749,7 +1016,8 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
         NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
         // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        const auto xml_mode = m_version == Version::IR_V10_BINARY ? std::ios::out | std::ios::binary : std::ios::out;
+        std::ofstream xml_file(m_xmlPath, xml_mode);
         NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         serializeFunc(xml_file, bin_file);
@@ -761,14 +1029,15 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
 
 namespace {
 
-std::string valid_xml_path(const std::string &path) {
-    NGRAPH_CHECK(path.length() > 4, "Path for xml file is to short: \"" + path + "\"");
+std::string valid_xml_path(const std::string &path, pass::Serialize::Version version) {
+    const bool binary = version == pass::Serialize::Version::IR_V10_BINARY;
+    const char *const extension = binary ? ".irb" : ".xml";
+    NGRAPH_CHECK(path.length() > std::strlen(extension), "Path for xml file is to short: \"" + path + "\"");
 
-    const char *const extension = ".xml";
     const bool has_xml_extension = path.rfind(extension) == path.size() - std::strlen(extension);
     NGRAPH_CHECK(has_xml_extension,
-                 "Path for xml file doesn't contains file name with 'xml' extension: \"" +
-                     path + "\"");
+                 "Path for xml file doesn't contains file name with '" + std::string(extension + 1) +
+                     "' extension: \"" + path + "\"");
     return path;
 }
 
@@ -805,7 +1074,7 @@ pass::Serialize::Serialize(const std::string& xmlPath,
                            std::map<std::string, OpSet> custom_opsets)
     : m_xmlFile{nullptr}
     , m_binFile{nullptr}
-    , m_xmlPath{valid_xml_path(xmlPath)}
+    , m_xmlPath{valid_xml_path(xmlPath, version)}
     , m_binPath{provide_bin_path(xmlPath, binPath)}
     , m_version{version}
     , m_custom_opsets{custom_opsets}
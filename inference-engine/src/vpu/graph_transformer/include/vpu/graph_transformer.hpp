@@ -114,6 +114,8 @@ struct CompilationConfig final {
     bool enableWeightsAnalysis = true;
     bool enableCustomReshapeParam = false;
 
+    std::string hwConvTilingCacheFile;
+
     //
     // Deprecated options
     //
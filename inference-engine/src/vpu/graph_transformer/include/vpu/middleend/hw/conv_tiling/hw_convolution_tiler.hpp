@@ -143,13 +143,11 @@ public:
         _tilingOptions(other._tilingOptions) {}
     HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
                                 std::size_t maxTilingOptions) :
-        _convolutionOptions(std::move(convolutionOptions)),
-        _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)),
-        _maxTilingOptions(maxTilingOptions) {
-            IE_ASSERT(maxTilingOptions > 0);
-            _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
-        }
+        HWConvolutionTilingSearcher(std::move(convolutionOptions), direction, maxTilingOptions,
+                                    CompileEnv::get().resources.tilingCMXLimit) {}
+    // Doesn't access CompileEnv, so can be used from any thread
+    HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
+                                std::size_t maxTilingOptions, int cmxLimit);
 
     const std::vector<TilingOption>& tilingOptions() const {
         return _tilingOptions;
@@ -160,7 +158,7 @@ public:
     HWConvolutionTileLayoutCut tileLayoutCut(const TilingOption& option) const;
 
 private:
-    std::vector<TilingOption> selectBetterTiling() const;
+    std::vector<TilingOption> selectBetterTiling(int cmxLimit) const;
 
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
@@ -0,0 +1,63 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+//
+// Memoizes results of the HW convolution tiling search.
+//
+// The search result depends on convolution parameters, search direction, number of requested options
+// and CMX limit only, so it is shared between equal convolutions of one model, between compilations
+// in the same process and, if a cache file is set, between compilations in different processes.
+// The cache is thread-safe.
+//
+
+class HWConvolutionTilingCache final {
+public:
+    using SearchFunction = std::function<std::vector<TilingOption>()>;
+
+    static HWConvolutionTilingCache& get();
+
+    static std::string makeKey(const ConvolutionOptions& convolutionOptions, Direction direction,
+                               std::size_t maxTilingOptions, int cmxLimit);
+
+    // Returns cached options for the key or calls search function and caches its result.
+    std::vector<TilingOption> findOrSearch(const std::string& key, const SearchFunction& search);
+
+    // Merges entries stored in the file into the cache. Every file is loaded once per process.
+    void load(const std::string& filePath);
+
+    // Writes all entries to the file if there are entries which are not stored in it yet.
+    void store(const std::string& filePath);
+
+    std::size_t hits() const;
+    std::size_t misses() const;
+
+private:
+    HWConvolutionTilingCache() = default;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, std::vector<TilingOption>> _entries;
+    std::unordered_set<std::string> _loadedFiles;
+    std::size_t _hits = 0;
+    std::size_t _misses = 0;
+    bool _modified = false;
+};
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
@@ -51,6 +51,13 @@ DECLARE_VPU_CONFIG(MYRIAD_ENABLE_WEIGHTS_ANALYSIS);
  */
 DECLARE_VPU_CONFIG(MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM);
 
+/**
+ * @brief Path to the file which keeps results of HW convolution tiling search
+ * between compilations. The file is created if it doesn't exist.
+ * Default is "" (results are kept in memory of the process only).
+ */
+DECLARE_VPU_CONFIG(MYRIAD_HW_CONV_TILING_CACHE_FILE);
+
 //
 // Debug options
 //
@@ -25,6 +25,7 @@
 #include <sstream>
 #include <iomanip>
 #include <atomic>
+#include <chrono>
 
 #include <precision_utils.h>
 #include <legacy/graph_tools.hpp>
@@ -144,6 +145,23 @@ void CompileEnv::free() {
 
 namespace {
 
+// Runs one phase of compilation and reports its duration to the compiler log
+template <typename Phase>
+auto runPhase(const char* name, const Phase& phase) -> decltype(phase()) {
+    using MilliSecondsFP64 = std::chrono::duration<double, std::milli>;
+
+    const auto& env = CompileEnv::get();
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    AutoScope reportDuration([&env, name, startTime]() {
+        const auto endTime = std::chrono::high_resolution_clock::now();
+        env.log->info("Compilation phase [%s] duration : %f ms",
+                      name, std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+    });
+
+    return phase();
+}
+
 CompiledGraph::Ptr compileImpl(const ie::CNNNetwork& network, const ie::ICore* core) {
     const auto& env = CompileEnv::get();
 
@@ -157,20 +175,26 @@ CompiledGraph::Ptr compileImpl(const ie::CNNNetwork& network, const ie::ICore* c
 
     auto middleEnd = passManager->buildMiddleEnd();
 
-    auto model = frontEnd->buildInitialModel(network);
+    auto model = runPhase("FrontEnd", [&] {
+        return frontEnd->buildInitialModel(network);
+    });
 
     AutoScope autoDumper([backEnd, model]() {
         backEnd->dumpModel(model);
     });
 
-    middleEnd->run(model);
+    runPhase("MiddleEnd", [&] {
+        middleEnd->run(model);
+    });
 
     if (!env.config.irWithVpuScalesDir.empty()) {
         network.serialize(env.config.irWithVpuScalesDir + "/" + network.getName() + "_scales.xml",
                           env.config.irWithVpuScalesDir + "/" + network.getName() + "_scales.bin");
     }
 
-    return backEnd->build(model, frontEnd->origLayers());
+    return runPhase("BackEnd", [&] {
+        return backEnd->build(model, frontEnd->origLayers());
+    });
 }
 
 CompiledGraph::Ptr compileImpl(const Model& model) {
@@ -184,9 +208,13 @@ CompiledGraph::Ptr compileImpl(const Model& model) {
         backEnd->dumpModel(model);
     });
 
-    middleEnd->run(model);
+    runPhase("MiddleEnd", [&] {
+        middleEnd->run(model);
+    });
 
-    return backEnd->build(model, {});
+    return runPhase("BackEnd", [&] {
+        return backEnd->build(model, {});
+    });
 }
 
 }  // namespace
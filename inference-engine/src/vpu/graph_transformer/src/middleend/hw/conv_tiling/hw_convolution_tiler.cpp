@@ -8,6 +8,7 @@
 #include <memory>
 #include <utility>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiling_cache.hpp>
 
 namespace vpu {
 
@@ -614,12 +615,24 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
     }
 }
 
+HWConvolutionTilingSearcher::HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
+                                                         std::size_t maxTilingOptions, int cmxLimit) :
+    _convolutionOptions(std::move(convolutionOptions)),
+    _maxTilingOptions(maxTilingOptions),
+    _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)) {
+    IE_ASSERT(maxTilingOptions > 0);
+    _dirTiling->initTileSizes();
+
+    const auto key = HWConvolutionTilingCache::makeKey(_convolutionOptions, direction, _maxTilingOptions, cmxLimit);
+    _tilingOptions = HWConvolutionTilingCache::get().findOrSearch(key, [this, cmxLimit] {
+        return selectBetterTiling(cmxLimit);
+    });
+}
+
 //
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
-std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
-    const auto& env = CompileEnv::get();
-
+std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling(int cmxLimit) const {
     auto& dirTiling = *_dirTiling;
     FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
 
@@ -644,7 +657,6 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
 
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
-    const auto cmxLimit = env.resources.tilingCMXLimit;
 
     // split over Input tensor for the Channel dimension always
     for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
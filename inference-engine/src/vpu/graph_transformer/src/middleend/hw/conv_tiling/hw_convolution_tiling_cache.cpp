@@ -0,0 +1,205 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiling_cache.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+namespace {
+
+// Changes of the search algorithm which affect its result must bump the version to invalidate stored caches
+const char cacheFileHeader[] = "VPU_HW_CONV_TILING_CACHE 1";
+
+void printDims(std::ostream& stream, const DimValues& dims) {
+    stream << dims[Dim::W] << "x" << dims[Dim::H] << "x" << dims[Dim::C];
+}
+
+bool parseOptions(const std::string& line, std::string& key, std::vector<TilingOption>& options) {
+    const auto separator = line.find('=');
+    if (separator == std::string::npos) {
+        return false;
+    }
+
+    key = line.substr(0, separator);
+
+    std::istringstream stream(line.substr(separator + 1));
+    std::size_t numOptions = 0;
+    if (!(stream >> numOptions)) {
+        return false;
+    }
+
+    options.resize(numOptions);
+    for (auto& option : options) {
+        if (!(stream >> option.numWidthTiles >> option.numHeightTiles >> option.numChannelTiles
+                     >> option.totalNumTiles >> option.cost)) {
+            return false;
+        }
+    }
+
+    // A line with extra fields was not written by store()
+    std::string extra;
+    return !(stream >> extra);
+}
+
+std::string makeTempFilePath(const std::string& filePath) {
+    // Concurrent compilations sharing the cache file must not write to the same temporary file
+    std::random_device device;
+    std::ostringstream path;
+    path << filePath << '.' << std::hex << device() << device() << ".tmp";
+    return path.str();
+}
+
+}  // namespace
+
+HWConvolutionTilingCache& HWConvolutionTilingCache::get() {
+    static HWConvolutionTilingCache cache;
+    return cache;
+}
+
+std::string HWConvolutionTilingCache::makeKey(const ConvolutionOptions& convolutionOptions, Direction direction,
+                                              std::size_t maxTilingOptions, int cmxLimit) {
+    std::ostringstream key;
+
+    key << "in:";
+    printDims(key, convolutionOptions._inputDims);
+    key << ";out:";
+    printDims(key, convolutionOptions._outputDims);
+    key << ";origOut:";
+    printDims(key, convolutionOptions._origOutputDims);
+    key << ";kernel:" << convolutionOptions._kernelSizeX << "x" << convolutionOptions._kernelSizeY
+        << ";stride:" << convolutionOptions._kernelStride
+        << ";pads:" << convolutionOptions._paddingLeft << "," << convolutionOptions._paddingRight
+        << "," << convolutionOptions._paddingTop << "," << convolutionOptions._paddingBottom
+        << ";pool:" << convolutionOptions._withPool
+        << ";dir:" << static_cast<int>(direction)
+        << ";options:" << maxTilingOptions
+        << ";cmx:" << cmxLimit;
+
+    return key.str();
+}
+
+std::vector<TilingOption> HWConvolutionTilingCache::findOrSearch(const std::string& key, const SearchFunction& search) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const auto it = _entries.find(key);
+        if (it != _entries.end()) {
+            ++_hits;
+            return it->second;
+        }
+    }
+
+    // The search is done without the lock to let the searches for different convolutions run concurrently.
+    // Concurrent searches for the same key produce the same result, so the first one is kept.
+    auto options = search();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    ++_misses;
+    if (_entries.emplace(key, options).second) {
+        _modified = true;
+    }
+
+    return options;
+}
+
+void HWConvolutionTilingCache::load(const std::string& filePath) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_loadedFiles.insert(filePath).second) {
+        return;
+    }
+
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line != cacheFileHeader) {
+        // Cache of another version is ignored and will be overwritten
+        return;
+    }
+
+    std::string key;
+    std::vector<TilingOption> options;
+    while (std::getline(file, line)) {
+        // Every entry is written with the line end, so the last line without it is truncated
+        if (file.eof()) {
+            break;
+        }
+        if (parseOptions(line, key, options)) {
+            _entries.emplace(std::move(key), std::move(options));
+        }
+    }
+}
+
+void HWConvolutionTilingCache::store(const std::string& filePath) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_modified) {
+        return;
+    }
+
+    // Write to a temporary file and replace the cache at once, so concurrent compilations never read a partial file
+    const auto tempFilePath = makeTempFilePath(filePath);
+    {
+        std::ofstream file(tempFilePath);
+        if (!file.is_open()) {
+            return;
+        }
+
+        file << cacheFileHeader << '\n';
+        file << std::setprecision(std::numeric_limits<double>::max_digits10);
+        for (const auto& entry : _entries) {
+            file << entry.first << '=' << entry.second.size();
+            for (const auto& option : entry.second) {
+                file << ' ' << option.numWidthTiles << ' ' << option.numHeightTiles << ' ' << option.numChannelTiles
+                     << ' ' << option.totalNumTiles << ' ' << option.cost;
+            }
+            file << '\n';
+        }
+
+        if (!file.good()) {
+            return;
+        }
+    }
+
+    // rename does not replace existing files on Windows
+    if (std::rename(tempFilePath.c_str(), filePath.c_str()) != 0) {
+        std::remove(filePath.c_str());
+        if (std::rename(tempFilePath.c_str(), filePath.c_str()) != 0) {
+            std::remove(tempFilePath.c_str());
+            return;
+        }
+    }
+
+    _modified = false;
+}
+
+std::size_t HWConvolutionTilingCache::hits() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hits;
+}
+
+std::size_t HWConvolutionTilingCache::misses() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _misses;
+}
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
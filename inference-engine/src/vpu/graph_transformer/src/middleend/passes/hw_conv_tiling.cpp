@@ -5,9 +5,11 @@
 #include <vpu/middleend/pass_manager.hpp>
 
 #include <precision_utils.h>
+#include <ie_parallel.hpp>
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -15,12 +17,40 @@
 #include <vpu/middleend/hw/tiling.hpp>
 #include <vpu/middleend/hw/utility.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiling_cache.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_stage_tiler.hpp>
 
 namespace vpu {
 
 namespace {
 
+const size_t tilingsCount = 1;
+const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                     // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+bool isTilingCandidate(const Stage& stage) {
+    return stage->type() == StageType::StubConv && stage->attrs().getOrDefault<bool>("tryHW", false);
+}
+
+HWTilingNS::ConvolutionOptions makeConvolutionOptions(const Stage& origStage, const HWConvStageOptions& stageOptions,
+                                                      const HWConvStageIO& stageIO, const DimValues& outputDims,
+                                                      bool withPool) {
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        outputDims,
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        withPool
+    };
+}
+
 class PassImpl final : public Pass {
 public:
     explicit PassImpl(StageBuilder::Ptr stageBuilder) : _stageBuilder(std::move(stageBuilder)) {}
@@ -28,19 +58,64 @@ public:
     void run(const Model& model) override;
 
 private:
+    static void searchTilingsInParallel(const Model& model);
+
     StageBuilder::Ptr _stageBuilder;
 };
 
-void PassImpl::run(const Model& model) {
-    VPU_PROFILE(hwConvTiling);
+//
+// Tiling search of a convolution doesn't depend on other stages, so the searches for all convolutions are done
+// in parallel beforehand. The results are put into the tiling cache and picked up by the sequential loop below,
+// which modifies the model.
+//
 
+void PassImpl::searchTilingsInParallel(const Model& model) {
+    const auto& env = CompileEnv::get();
+    const auto cmxLimit = env.resources.tilingCMXLimit;
+
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionsOptions;
     for (const auto& origStage : model->getStages()) {
-        if (origStage->type() != StageType::StubConv) {
+        if (!isTilingCandidate(origStage)) {
             continue;
         }
 
-        const auto tryHW = origStage->attrs().getOrDefault<bool>("tryHW", false);
-        if (!tryHW) {
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+        // Pooling is not merged only if the tiling with merged pooling is not found, so the searches without pooling
+        // are usually not needed. They are done by the sequential loop only for the convolutions which need them.
+        convolutionsOptions.push_back(makeConvolutionOptions(origStage, stageOptions, stageIO,
+                                                             stageIO.origOutput->desc().dims(), stageOptions.withPool));
+    }
+
+    InferenceEngine::parallel_for(convolutionsOptions.size(), [&](size_t i) {
+        try {
+            HWTilingNS::HWConvolutionTilingSearcher searcher(convolutionsOptions[i], direction, tilingsCount, cmxLimit);
+        } catch (...) {
+            // The error is reported by the sequential search for this convolution
+        }
+    });
+}
+
+void PassImpl::run(const Model& model) {
+    VPU_PROFILE(hwConvTiling);
+
+    const auto& env = CompileEnv::get();
+    auto& tilingCache = HWTilingNS::HWConvolutionTilingCache::get();
+
+    if (!env.config.hwConvTilingCacheFile.empty()) {
+        tilingCache.load(env.config.hwConvTilingCacheFile);
+    }
+    const auto hitsBefore = tilingCache.hits();
+    const auto missesBefore = tilingCache.misses();
+
+    searchTilingsInParallel(model);
+
+    env.log->debug("HW convolution tiling: %d searches, %d cache hits",
+                   tilingCache.misses() - missesBefore, tilingCache.hits() - hitsBefore);
+
+    for (const auto& origStage : model->getStages()) {
+        if (!isTilingCandidate(origStage)) {
             continue;
         }
 
@@ -55,44 +130,16 @@ void PassImpl::run(const Model& model) {
         // Try to find "best" tiling
         //
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
+        const auto convolutionOptions = makeConvolutionOptions(origStage, stageOptions, stageIO,
+                                                               stageIO.origOutput->desc().dims(), stageOptions.withPool);
 
         const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
 
 
         const HWTilingNS::HWConvolutionTiler& tiler = [&] {
             if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
+                const auto optionsWithoutPool = makeConvolutionOptions(origStage, stageOptions, stageIO,
+                                                                       stageIO.origOutputDesc.dims(), false);
 
                 return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
             } else {
@@ -233,6 +280,10 @@ void PassImpl::run(const Model& model) {
 
         model->removeStage(origStage);
     }
+
+    if (!env.config.hwConvTilingCacheFile.empty()) {
+        tilingCache.store(env.config.hwConvTilingCacheFile);
+    }
 }
 
 }  // namespace
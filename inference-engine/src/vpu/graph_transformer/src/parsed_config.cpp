@@ -70,6 +70,7 @@ IE_SUPPRESS_DEPRECATED_START
         ie::MYRIAD_ENABLE_WEIGHTS_ANALYSIS,
         ie::MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION,
         ie::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM,
+        ie::MYRIAD_HW_CONV_TILING_CACHE_FILE,
 
         //
         // Debug options
@@ -190,6 +191,7 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     setOption(_compileConfig.enableCustomReshapeParam,       switches, config, ie::MYRIAD_ENABLE_CUSTOM_RESHAPE_PARAM);
 
     setOption(_compileConfig.irWithVpuScalesDir,                       config, ie::MYRIAD_IR_WITH_SCALES_DIRECTORY);
+    setOption(_compileConfig.hwConvTilingCacheFile,                    config, ie::MYRIAD_HW_CONV_TILING_CACHE_FILE);
     setOption(_compileConfig.noneLayers,                               config, ie::MYRIAD_NONE_LAYERS, parseStringSet);
     setOption(_compileConfig.hwWhiteList,                              config, ie::MYRIAD_HW_WHITE_LIST, parseStringSet);
     setOption(_compileConfig.hwBlackList,                              config, ie::MYRIAD_HW_BLACK_LIST, parseStringSet);
@@ -0,0 +1,117 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <iterator>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "transformations/serialize.hpp"
+
+#ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
+#define IR_SERIALIZATION_MODELS_PATH ""
+#endif
+
+typedef std::tuple<std::string, std::string> BinaryIRParams;
+
+class BinaryIRSerializationTest: public CommonTestUtils::TestsCommon,
+                                 public testing::WithParamInterface<BinaryIRParams> {
+public:
+    std::string m_model_path;
+    std::string m_binary_path;
+    std::string m_out_xml_path;
+    std::string m_out_xml_bin_path;
+    std::string m_out_irb_path;
+    std::string m_out_irb_bin_path;
+
+    void SetUp() override {
+        m_model_path = IR_SERIALIZATION_MODELS_PATH + std::get<0>(GetParam());
+        if (!std::get<1>(GetParam()).empty()) {
+            m_binary_path = IR_SERIALIZATION_MODELS_PATH + std::get<1>(GetParam());
+        }
+
+        const std::string test_name =  GetTestName() + "_" + GetTimestamp();
+        m_out_xml_path = test_name + ".xml";
+        m_out_xml_bin_path = test_name + "_xml.bin";
+        m_out_irb_path = test_name + ".irb";
+        m_out_irb_bin_path = test_name + "_irb.bin";
+    }
+
+    void TearDown() override {
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_xml_bin_path.c_str());
+        std::remove(m_out_irb_path.c_str());
+        std::remove(m_out_irb_bin_path.c_str());
+    }
+
+    static std::vector<char> read_file(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+};
+
+TEST_P(BinaryIRSerializationTest, CompareFunctionsWithXML) {
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(m_model_path, m_binary_path);
+    expected.serialize(m_out_xml_path, m_out_xml_bin_path);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::Serialize>(m_out_irb_path, m_out_irb_bin_path,
+                                                   ngraph::pass::Serialize::Version::IR_V10_BINARY);
+    manager.run_passes(expected.getFunction());
+
+    auto from_xml = ie.ReadNetwork(m_out_xml_path, m_out_xml_bin_path);
+    auto from_irb = ie.ReadNetwork(m_out_irb_path, m_out_irb_bin_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(from_irb.getFunction(), from_xml.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+    std::tie(success, message) = compare_functions(from_irb.getFunction(), expected.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+}
+
+TEST_P(BinaryIRSerializationTest, WeightsAreSameAsForXML) {
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(m_model_path, m_binary_path);
+    expected.serialize(m_out_xml_path, m_out_xml_bin_path);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::Serialize>(m_out_irb_path, m_out_irb_bin_path,
+                                                   ngraph::pass::Serialize::Version::IR_V10_BINARY);
+    manager.run_passes(expected.getFunction());
+
+    ASSERT_EQ(read_file(m_out_xml_bin_path), read_file(m_out_irb_bin_path));
+
+    // The same weights file may be shared by both topology formats
+    auto from_irb = ie.ReadNetwork(m_out_irb_path, m_out_xml_bin_path);
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(from_irb.getFunction(), expected.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+}
+
+INSTANTIATE_TEST_CASE_P(IRSerialization, BinaryIRSerializationTest,
+        testing::Values(std::make_tuple("add_abc.xml", "add_abc.bin"),
+                        std::make_tuple("add_abc_f64.xml", ""),
+                        std::make_tuple("add_abc_bin.xml", ""),
+                        std::make_tuple("split_equal_parts_2d.xml", "split_equal_parts_2d.bin"),
+                        std::make_tuple("addmul_abc.xml", "addmul_abc.bin"),
+                        std::make_tuple("add_abc_initializers.xml", "add_abc_initializers.bin"),
+                        std::make_tuple("add_abc_initializers_u1_const.xml", "add_abc_initializers_u1_const.bin"),
+                        std::make_tuple("experimental_detectron_roi_feature_extractor_opset6.xml", ""),
+                        std::make_tuple("experimental_detectron_detection_output_opset6.xml", ""),
+                        std::make_tuple("nms5.xml", "nms5.bin"),
+                        std::make_tuple("shape_of.xml", ""),
+                        std::make_tuple("pad_with_shape_of.xml", ""),
+                        std::make_tuple("conv_with_rt_info.xml", ""),
+                        std::make_tuple("loop_2d_add.xml", "loop_2d_add.bin"),
+                        std::make_tuple("nms5_dynamism.xml", "nms5_dynamism.bin")));
+
+TEST(BinaryIRSerialization, RejectsNotBinaryIRExtension) {
+    ASSERT_ANY_THROW(ngraph::pass::Serialize("model.xml", "model.bin",
+                                             ngraph::pass::Serialize::Version::IR_V10_BINARY));
+}
@@ -71,6 +71,7 @@ INSTANTIATE_TEST_CASE_P(IRSerialization, SerializationTest,
                         std::make_tuple("shape_of.xml", ""),
                         std::make_tuple("pad_with_shape_of.xml", ""),
                         std::make_tuple("conv_with_rt_info.xml", ""),
+                        std::make_tuple("conv_with_inference_precision.xml", ""),
                         std::make_tuple("loop_2d_add.xml", "loop_2d_add.bin"),
                         std::make_tuple("nms5_dynamism.xml", "nms5_dynamism.bin")));
 
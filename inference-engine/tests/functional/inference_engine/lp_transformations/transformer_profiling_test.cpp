@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/pass_profiler.hpp>
+
+#include "low_precision/transformer.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace testing;
+using namespace ngraph;
+using namespace ngraph::pass;
+
+namespace {
+
+std::shared_ptr<Node> makeQuantizedConvolution(const Output<Node>& input, const size_t channels) {
+    const auto fakeQuantizeOnActivations = ngraph::builder::makeFakeQuantize(
+        input, element::f32, 256ul, {}, { 0.f }, { 25.5f }, { 0.f }, { 25.5f });
+    const auto weights = opset1::Constant::create(
+        element::f32,
+        Shape{ channels, channels, 3, 3 },
+        std::vector<float>(channels * channels * 3 * 3, 1.f));
+    const auto fakeQuantizeOnWeights = ngraph::builder::makeFakeQuantize(
+        weights, element::f32, 255ul, { channels, 1, 1, 1 },
+        std::vector<float>(channels, -1.27f), std::vector<float>(channels, 1.27f),
+        std::vector<float>(channels, -1.27f), std::vector<float>(channels, 1.27f));
+    return std::make_shared<opset1::Convolution>(
+        fakeQuantizeOnActivations,
+        fakeQuantizeOnWeights,
+        Strides{ 1, 1 },
+        CoordinateDiff{ 1, 1 },
+        CoordinateDiff{ 1, 1 },
+        Strides{ 1, 1 });
+}
+
+// ResNet like function: residual blocks of two quantized convolutions
+std::shared_ptr<Function> makeResNetLikeFunction(const size_t blocks, const size_t channels) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, channels, 14, 14 });
+    std::shared_ptr<Node> parent = input;
+    for (size_t block = 0; block < blocks; ++block) {
+        const auto convolution1 = makeQuantizedConvolution(parent, channels);
+        const auto relu = std::make_shared<opset1::Relu>(convolution1);
+        const auto convolution2 = makeQuantizedConvolution(relu, channels);
+        const auto add = std::make_shared<opset1::Add>(convolution2, parent);
+        parent = std::make_shared<opset1::Relu>(add);
+    }
+    const auto pooling = std::make_shared<opset1::AvgPool>(
+        ngraph::builder::makeFakeQuantize(parent, element::f32, 256ul, {}, { 0.f }, { 25.5f }, { 0.f }, { 25.5f }),
+        Strides{ 1, 1 }, Shape{ 0, 0 }, Shape{ 0, 0 }, Shape{ 14, 14 }, true);
+    return std::make_shared<Function>(ResultVector{ std::make_shared<opset1::Result>(pooling) }, ParameterVector{ input });
+}
+
+const PassProfile* findProfile(const std::vector<PassProfile>& profiles, const std::string& name) {
+    const auto it = std::find_if(profiles.begin(), profiles.end(), [&](const PassProfile& profile) {
+        return profile.name == name;
+    });
+    return it == profiles.end() ? nullptr : &*it;
+}
+
+}  // namespace
+
+TEST(LPT, transformationsAreProfiled) {
+    const auto function = makeResNetLikeFunction(4ul, 8ul);
+
+    PassProfiler profiler;
+    low_precision::LowPrecisionTransformer transformer(low_precision::LowPrecisionTransformer::getAllTransformations());
+    transformer.transform(function);
+
+    const auto& profiles = profiler.get_profiles();
+    const auto root = findProfile(profiles, "LowPrecisionTransformer");
+    ASSERT_NE(nullptr, root);
+    EXPECT_EQ(0ul, root->depth);
+
+    const auto layerTransformations = findProfile(profiles, "LayerTransformations");
+    ASSERT_NE(nullptr, layerTransformations);
+    EXPECT_EQ(1ul, layerTransformations->depth);
+
+    const auto convolution = findProfile(profiles, "ConvolutionTransformation");
+    ASSERT_NE(nullptr, convolution);
+    EXPECT_EQ(2ul, convolution->depth);
+    EXPECT_GT(convolution->rewrites, 0ul);
+    EXPECT_GE(convolution->nodes_visited, convolution->rewrites);
+    EXPECT_GE(layerTransformations->rewrites, convolution->rewrites);
+    EXPECT_GE(root->rewrites, layerTransformations->rewrites);
+
+    for (auto name : { "BranchSpecificTransformations", "DecompositionTransformations", "CleanupTransformations",
+                       "StandaloneCleanupTransformations" }) {
+        const auto step = findProfile(profiles, name);
+        ASSERT_NE(nullptr, step) << name;
+        EXPECT_EQ(1ul, step->depth) << name;
+    }
+}
+
+// Benchmark on a function with a hundred quantized convolutions: run with --gtest_also_run_disabled_tests
+TEST(LPT, DISABLED_benchmarkResNetLikeFunction) {
+    const auto function = makeResNetLikeFunction(50ul, 64ul);
+
+    PassProfiler profiler;
+    low_precision::LowPrecisionTransformer transformer(low_precision::LowPrecisionTransformer::getAllTransformations());
+    const auto start = std::chrono::steady_clock::now();
+    transformer.transform(function);
+    const auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "LowPrecisionTransformer::transform: " << time.count() << " ms, "
+              << function->get_ops().size() << " operations" << std::endl;
+    for (const auto& profile : profiler.get_profiles()) {
+        std::cout << std::string(2 * profile.depth, ' ') << profile.name << ": " << profile.time.count() << " us, "
+                  << profile.nodes_visited << " nodes visited, " << profile.rewrites << " rewrites" << std::endl;
+    }
+}
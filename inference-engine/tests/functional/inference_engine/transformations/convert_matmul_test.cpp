@@ -16,10 +16,12 @@
 #include <ngraph/function.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/variant.hpp>
 #include <legacy/ngraph_ops/fully_connected.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/convert_matmul_to_fc_or_gemm.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/reshape_fully_connected.hpp>
 #include <transformations/init_node_info.hpp>
+#include <transformations/low_precision/disable_compressed_weights_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
 
@@ -255,6 +257,82 @@ TEST(TransformationTests, ConvertMatMulTest7) {
     ASSERT_TRUE(res.first) << res.second;
 }
 
+TEST(TransformationTests, ConvertMatMulWithCompressedWeights) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_decompressed_weights = []() {
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{3, 2}, {1, 2, 3, 4, 5, 6});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{3, 1}, {128});
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{3, 1}, {0.5});
+        return std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+    };
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 2});
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, create_decompressed_weights(), false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{input1});
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ngraph::pass::DisableCompressedWeightsConstantFolding>();
+        m.register_pass<ngraph::pass::ConstantFolding>();
+        m.register_pass<ngraph::pass::ConvertMatMulToFC>();
+        m.register_pass<ngraph::pass::ConvertMatMulToGemm>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 2});
+        auto input3 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{3}, {0});
+        auto fc = std::make_shared<ngraph::op::FullyConnected>(input1, create_decompressed_weights(), input3, ngraph::Shape{4, 3});
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{fc}, ngraph::ParameterVector{input1});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertMatMulWithCompressedWeightsNotPerChannel) {
+    auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 2});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{3, 2}, {1, 2, 3, 4, 5, 6});
+    auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+    // per input channel scale can't be applied by plugin to the whole rows of weights
+    auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 2}, {0.5, 0.25});
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+    auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, true);
+
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{input1});
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<ngraph::pass::DisableCompressedWeightsConstantFolding>();
+    m.run_passes(f);
+
+    ASSERT_EQ(0, convert->get_rt_info().count("DISABLED_CONSTANT_FOLDING"));
+}
+
+TEST(TransformationTests, ConvertMatMulWithCompressedWeightsBF16Source) {
+    auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 2});
+    // the source of FullyConnected is kept in BF16 for its other consumer, so the weights can't be decompressed in plugin
+    auto relu = std::make_shared<ngraph::opset1::Relu>(input1);
+    auto consumer = std::make_shared<ngraph::opset1::Relu>(relu);
+    consumer->get_rt_info()["inferencePrecision"] = std::make_shared<ngraph::VariantWrapper<std::string>>("bf16");
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{3, 2}, {1, 2, 3, 4, 5, 6});
+    auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+    auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{3, 1}, {0.5});
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+    auto matmul = std::make_shared<ngraph::opset1::MatMul>(relu, multiply, false, true);
+
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul, consumer}, ngraph::ParameterVector{input1});
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<ngraph::pass::DisableCompressedWeightsConstantFolding>();
+    m.run_passes(f);
+
+    ASSERT_EQ(0, convert->get_rt_info().count("DISABLED_CONSTANT_FOLDING"));
+}
+
 TEST(TransformationTests, ConvertMatMulDynamic) {
         auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape::dynamic());
         auto input2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{2, 2}, {1});
@@ -0,0 +1,112 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_ops/scaled_dot_product_attention.hpp>
+#include <transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+
+using namespace testing;
+using namespace ngraph;
+
+
+TEST(TransformationTests, ScaledDotProductAttentionFusion) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 10, 16});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 10, 4});
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 1, 1, 10});
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto scale = std::make_shared<opset1::Multiply>(qk, opset1::Constant::create(element::f32, Shape{}, {0.25}));
+        auto add = std::make_shared<opset1::Add>(scale, mask);
+        auto softmax = std::make_shared<opset1::Softmax>(add, 3);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{sv}, ParameterVector{q, k, v, mask});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 10, 16});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 10, 4});
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 1, 1, 10});
+        auto attention = std::make_shared<op::internal::ScaledDotProductAttention>(q, k, v, mask, 0.25f, true);
+        f_ref = std::make_shared<Function>(NodeVector{attention}, ParameterVector{q, k, v, mask});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionDivideWithoutMask) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4, 6, 8});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4, 8, 6});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4, 6, 8});
+        auto qk = std::make_shared<opset1::MatMul>(q, k);
+        auto scale = std::make_shared<opset1::Divide>(qk, opset1::Constant::create(element::f32, Shape{1}, {2}));
+        auto softmax = std::make_shared<opset1::Softmax>(scale, 3);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{sv}, ParameterVector{q, k, v});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4, 6, 8});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4, 8, 6});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4, 6, 8});
+        auto attention = std::make_shared<op::internal::ScaledDotProductAttention>(q, k, v, 0.5f, false);
+        f_ref = std::make_shared<Function>(NodeVector{attention}, ParameterVector{q, k, v});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWrongSoftmaxAxis) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 16});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 8, 4});
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 2);
+        auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{sv}, ParameterVector{q, k, v});
+        f_ref = clone_function(*f);
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::ScaledDotProductAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
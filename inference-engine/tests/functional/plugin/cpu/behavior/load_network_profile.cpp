@@ -0,0 +1,110 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include "functional_test_utils/plugin_cache.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+std::vector<std::string> split(const std::string& entry) {
+    std::vector<std::string> fields;
+    std::stringstream stream(entry);
+    std::string field;
+    while (std::getline(stream, field, ','))
+        fields.push_back(field);
+    return fields;
+}
+
+bool isUnsigned(const std::string& value) {
+    return !value.empty() && std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+// "<phase>,<time_us>,<peak_rss_kb>", returns phase names in the report order
+std::vector<std::string> checkLoadNetworkProfile(const std::vector<std::string>& profile) {
+    std::vector<std::string> phases;
+    for (const auto& entry : profile) {
+        const auto fields = split(entry);
+        EXPECT_EQ(3u, fields.size()) << entry;
+        if (fields.size() != 3)
+            continue;
+        EXPECT_FALSE(fields[0].empty()) << entry;
+        EXPECT_TRUE(isUnsigned(fields[1])) << entry;
+        EXPECT_TRUE(isUnsigned(fields[2])) << entry;
+        EXPECT_EQ(phases.end(), std::find(phases.begin(), phases.end(), fields[0])) << "repeated phase " << entry;
+        phases.push_back(fields[0]);
+    }
+    return phases;
+}
+
+size_t position(const std::vector<std::string>& phases, const std::string& phase) {
+    return std::distance(phases.begin(), std::find(phases.begin(), phases.end(), phase));
+}
+}  // namespace
+
+TEST(LoadNetworkProfileTest, smoke_ReportsLoadNetworkPhases_CPU) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(InferenceEngine::CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu()),
+                                   CommonTestUtils::DEVICE_CPU);
+
+    std::vector<std::string> metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(LOAD_NETWORK_PROFILE)));
+
+    std::vector<std::string> profile = execNet.GetMetric(METRIC_KEY(LOAD_NETWORK_PROFILE));
+    const auto phases = checkLoadNetworkProfile(profile);
+
+    // the phases go in the execution order, graphs of the streams are created after the conversions
+    const std::vector<std::string> expected = {"ngraph_transformations", "legacy_conversion",
+                                               "stream_graphs_creation", "stream_graph.init_nodes",
+                                               "stream_graph.primitives_creation"};
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_LT(position(phases, expected[i]), phases.size()) << "no phase " << expected[i];
+        if (i > 0) {
+            ASSERT_LT(position(phases, expected[i - 1]), position(phases, expected[i]));
+        }
+    }
+
+    // as a device metric it describes the network loaded last
+    std::vector<std::string> deviceMetrics = ie->GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(deviceMetrics.end(), std::find(deviceMetrics.begin(), deviceMetrics.end(), METRIC_KEY(LOAD_NETWORK_PROFILE)));
+    std::vector<std::string> deviceProfile = ie->GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(LOAD_NETWORK_PROFILE));
+    ASSERT_EQ(profile, deviceProfile);
+}
+
+TEST(LoadNetworkProfileTest, smoke_ReportsTransformationsProfile_CPU) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(InferenceEngine::CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu()),
+                                   CommonTestUtils::DEVICE_CPU);
+
+    std::vector<std::string> metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(TRANSFORMATIONS_PROFILE)));
+
+    std::vector<std::string> profile = execNet.GetMetric(METRIC_KEY(TRANSFORMATIONS_PROFILE));
+    ASSERT_FALSE(profile.empty());
+
+    // "<name>,<depth>,<time_us>,<nodes_visited>,<rewrites>", nested transformations follow their parent
+    size_t previousDepth = 0;
+    for (size_t i = 0; i < profile.size(); i++) {
+        const auto fields = split(profile[i]);
+        ASSERT_EQ(5u, fields.size()) << profile[i];
+        ASSERT_FALSE(fields[0].empty()) << profile[i];
+        for (size_t f = 1; f < fields.size(); f++) {
+            ASSERT_TRUE(isUnsigned(fields[f])) << profile[i];
+        }
+        const size_t depth = std::stoul(fields[1]);
+        if (i == 0) {
+            ASSERT_EQ(0u, depth) << profile[i];
+        } else {
+            ASSERT_LE(depth, previousDepth + 1) << profile[i];
+        }
+        previousDepth = depth;
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <exec_graph_info.hpp>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "functional_test_utils/plugin_cache.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+namespace {
+const ngraph::Shape inputShape = {1, 16, 8, 8};
+
+void setInferencePrecision(const std::shared_ptr<ngraph::Node>& node, const std::string& precision) {
+    node->get_rt_info()["inferencePrecision"] = std::make_shared<ngraph::VariantWrapper<std::string>>(precision);
+}
+
+std::shared_ptr<ngraph::Node> makeConvolution(const ngraph::Output<ngraph::Node>& input, const std::string& name) {
+    using namespace ngraph;
+    auto weights = opset1::Constant::create(element::f32, Shape{inputShape[1], inputShape[1], 3, 3}, {0.01f});
+    auto conv = std::make_shared<opset1::Convolution>(input, weights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                      CoordinateDiff{1, 1}, Strides{1, 1});
+    conv->set_friendly_name(name);
+    return conv;
+}
+
+// Runtime precision of the node is the precision of its input
+std::map<std::string, std::string> getRuntimePrecisions(const std::shared_ptr<ngraph::Function>& function,
+                                                        const std::map<std::string, std::string>& config) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(InferenceEngine::CNNNetwork(function), CommonTestUtils::DEVICE_CPU, config);
+    std::map<std::string, std::string> precisions;
+    for (const auto& op : execNet.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        const auto precision = rtInfo.find(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+        if (precision != rtInfo.end())
+            precisions[op->get_friendly_name()] =
+                ngraph::as_type_ptr<ngraph::VariantWrapper<std::string>>(precision->second)->get();
+    }
+    return precisions;
+}
+
+// Network inputs are passed in their own precision, so the marked convolutions are fed by ReLU
+std::shared_ptr<ngraph::Function> makeTwoBranchesFunction(const std::string& markedPrecision) {
+    /*       Parameter
+            /         \
+          ReLU        ReLU
+           |            |
+      Convolution   Convolution
+       (marked)         |
+           |          Result
+         Result
+    */
+    using namespace ngraph;
+    auto param = std::make_shared<opset1::Parameter>(element::f32, inputShape);
+    auto marked = makeConvolution(std::make_shared<opset1::Relu>(param), "conv_marked");
+    setInferencePrecision(marked, markedPrecision);
+    auto other = makeConvolution(std::make_shared<opset1::Relu>(param), "conv_other");
+    return std::make_shared<Function>(NodeVector{marked, other}, ParameterVector{param});
+}
+}  // namespace
+
+TEST(PerLayerInferencePrecisionTest, smoke_LayerMarkedBF16IsExecutedInBF16_CPU) {
+    if (!InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    auto precisions = getRuntimePrecisions(makeTwoBranchesFunction("BF16"),
+                                           {{InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16,
+                                             InferenceEngine::PluginConfigParams::NO}});
+    ASSERT_EQ("BF16", precisions["conv_marked"]);
+    ASSERT_EQ("FP32", precisions["conv_other"]);
+}
+
+TEST(PerLayerInferencePrecisionTest, smoke_LayerMarkedFP32IsExecutedInFP32WithEnforcedBF16_CPU) {
+    if (!InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    auto precisions = getRuntimePrecisions(makeTwoBranchesFunction("FP32"),
+                                           {{InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16,
+                                             InferenceEngine::PluginConfigParams::YES}});
+    ASSERT_EQ("FP32", precisions["conv_marked"]);
+    ASSERT_EQ("BF16", precisions["conv_other"]);
+}
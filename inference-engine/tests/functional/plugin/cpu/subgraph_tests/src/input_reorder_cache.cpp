@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include "functional_test_utils/plugin_cache.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+namespace {
+/* The input is passed in NHWC layout, the convolution with identity weights reads it in its own layout,
+ * so the input is reordered by the graph at every inference.
+
+    Parameter(NHWC)
+          |
+    Convolution 1x1 (identity weights)
+          |
+       Result(NCHW)
+*/
+const size_t N = 1, C = 3, H = 4, W = 5;
+
+InferenceEngine::CNNNetwork makeIdentityConvNetwork() {
+    using namespace ngraph;
+
+    auto param = std::make_shared<opset3::Parameter>(element::f32, Shape{N, C, H, W});
+    param->set_friendly_name("input");
+    std::vector<float> weights(C * C, 0.f);
+    for (size_t c = 0; c < C; c++)
+        weights[c * C + c] = 1.f;
+    auto conv = std::make_shared<opset3::Convolution>(param, opset3::Constant::create(element::f32, Shape{C, C, 1, 1}, weights),
+                                                      Strides{1, 1}, CoordinateDiff{0, 0}, CoordinateDiff{0, 0}, Strides{1, 1});
+    conv->set_friendly_name("output");
+
+    InferenceEngine::CNNNetwork network(std::make_shared<Function>(NodeVector{conv}, ParameterVector{param}));
+    network.getInputsInfo().begin()->second->setLayout(InferenceEngine::Layout::NHWC);
+    network.getOutputsInfo().begin()->second->setLayout(InferenceEngine::Layout::NCHW);
+    return network;
+}
+
+void fillNHWC(const InferenceEngine::Blob::Ptr& blob, float base) {
+    auto data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = base + static_cast<float>(i);
+}
+
+void checkNCHW(const InferenceEngine::Blob::Ptr& input, const InferenceEngine::Blob::Ptr& output) {
+    auto in = input->cbuffer().as<const float*>();
+    auto out = output->cbuffer().as<const float*>();
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < H; h++) {
+            for (size_t w = 0; w < W; w++)
+                ASSERT_EQ(in[(h * W + w) * C + c], out[(c * H + h) * W + w]) << "c " << c << " h " << h << " w " << w;
+        }
+    }
+}
+}  // namespace
+
+TEST(InputReorderCacheTest, smoke_ReordersNHWCInputAtEveryInfer_CPU) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(makeIdentityConvNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+
+    // the reorder made for the first blob is executed for the new data of the same blob
+    auto input = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {N, C, H, W},
+                                                           InferenceEngine::Layout::NHWC});
+    input->allocate();
+    request.SetBlob("input", input);
+    for (float base : {0.f, 100.f}) {
+        fillNHWC(input, base);
+        request.Infer();
+        checkNCHW(input, request.GetBlob("output"));
+    }
+
+    // and for the data of another blob with the same descriptor
+    auto other = InferenceEngine::make_shared_blob<float>(input->getTensorDesc());
+    other->allocate();
+    fillNHWC(other, -50.f);
+    request.SetBlob("input", other);
+    request.Infer();
+    checkNCHW(other, request.GetBlob("output"));
+}
@@ -0,0 +1,146 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <exec_graph_info.hpp>
+#include "functional_test_utils/plugin_cache.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+namespace {
+/* Key/value cache of a decoder with preallocated capacity: new rows are written at the given positions
+ * along the sequence axis in place, the whole cache is read by the consumers.
+
+    Constant(zeros)
+          |
+      ReadValue    Parameter(position)   Parameter(new rows)
+           \              |              /
+            -------- ScatterUpdate -------
+                   /            \
+               Assign          Multiply
+                                  |
+                               Result
+*/
+const ngraph::Shape cacheShape = {1, 2, 8, 4};
+const ngraph::Shape rowsShape = {1, 2, 1, 4};
+
+InferenceEngine::CNNNetwork makeKVCacheNetwork() {
+    using namespace ngraph;
+
+    auto position = std::make_shared<opset3::Parameter>(element::i32, Shape{1});
+    position->set_friendly_name("position");
+    auto rows = std::make_shared<opset3::Parameter>(element::f32, rowsShape);
+    rows->set_friendly_name("rows");
+
+    auto init = opset3::Constant::create(element::f32, cacheShape, {0});
+    auto read = std::make_shared<opset3::ReadValue>(init, "kv_cache");
+    read->set_friendly_name("kv_cache_read");
+    auto axis = opset3::Constant::create(element::i64, Shape{}, {2});
+    auto update = std::make_shared<opset3::ScatterUpdate>(read, position, rows, axis);
+    auto assign = std::make_shared<opset3::Assign>(update, "kv_cache");
+    auto consumer = std::make_shared<opset3::Multiply>(update, opset3::Constant::create(element::f32, Shape{}, {2}));
+    consumer->set_friendly_name("consumer");
+
+    // WA. Limitation of ngraph. control_dependency are required.
+    assign->add_control_dependency(read);
+    consumer->add_control_dependency(assign);
+
+    return InferenceEngine::CNNNetwork(std::make_shared<Function>(NodeVector{consumer}, ParameterVector{position, rows}));
+}
+
+void appendRow(InferenceEngine::InferRequest& request, int position, float value) {
+    auto positionBlob = request.GetBlob("position");
+    positionBlob->buffer().as<int32_t*>()[0] = position;
+    auto rowsBlob = request.GetBlob("rows");
+    auto rowsData = rowsBlob->buffer().as<float*>();
+    std::fill(rowsData, rowsData + rowsBlob->size(), value);
+    request.Infer();
+}
+
+// the cache is updated in place if the graph rebinds the memory of its update to the state buffer
+std::string getStateInPlace(InferenceEngine::ExecutableNetwork& execNet) {
+    for (const auto& op : execNet.GetExecGraphInfo().getFunction()->get_ops()) {
+        if (op->get_friendly_name() != "kv_cache_read")
+            continue;
+        const auto& rtInfo = op->get_rt_info();
+        const auto inPlace = rtInfo.find("stateInPlace");
+        if (inPlace == rtInfo.end())
+            return "";
+        return ngraph::as_type_ptr<ngraph::VariantWrapper<std::string>>(inPlace->second)->get();
+    }
+    return "";
+}
+
+// expected[p] is the value of all elements at sequence position p
+void checkCache(const float* data, const std::vector<float>& expected, float factor = 1.f) {
+    const size_t seqLen = cacheShape[2], rowSize = cacheShape[3];
+    for (size_t bh = 0; bh < cacheShape[0] * cacheShape[1]; bh++) {
+        for (size_t p = 0; p < seqLen; p++) {
+            const float value = p < expected.size() ? expected[p] * factor : 0.f;
+            for (size_t i = 0; i < rowSize; i++)
+                ASSERT_EQ(value, data[(bh * seqLen + p) * rowSize + i]) << "position " << p;
+        }
+    }
+}
+}  // namespace
+
+TEST(KVCacheStateTest, smoke_AppendsInPlacePerRequest_CPU) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(makeKVCacheNetwork(), CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ("YES", getStateInPlace(execNet));
+    auto first = execNet.CreateInferRequest();
+    auto second = execNet.CreateInferRequest();
+
+    // requests share the graph, but every one of them grows its own cache
+    for (int step = 0; step < 3; step++) {
+        appendRow(first, step, static_cast<float>(step + 1));
+        if (step < 2)
+            appendRow(second, step, -static_cast<float>(step + 1));
+    }
+
+    checkCache(first.QueryState().front().GetState()->cbuffer().as<const float*>(), {1.f, 2.f, 3.f});
+    checkCache(second.QueryState().front().GetState()->cbuffer().as<const float*>(), {-1.f, -2.f});
+    checkCache(first.GetBlob("consumer")->cbuffer().as<const float*>(), {1.f, 2.f, 3.f}, 2.f);
+    checkCache(second.GetBlob("consumer")->cbuffer().as<const float*>(), {-1.f, -2.f}, 2.f);
+
+    // a cache kept by the application is used by the request in place
+    auto firstCache = first.QueryState().front().GetState();
+    auto handle = InferenceEngine::make_shared_blob<float>(firstCache->getTensorDesc());
+    handle->allocate();
+    std::copy_n(firstCache->cbuffer().as<const float*>(), firstCache->size(), handle->buffer().as<float*>());
+    second.QueryState().front().SetState(handle);
+    appendRow(second, 3, 4.f);
+    ASSERT_EQ(handle->cbuffer().as<const float*>(), second.QueryState().front().GetState()->cbuffer().as<const float*>());
+    checkCache(handle->cbuffer().as<const float*>(), {1.f, 2.f, 3.f, 4.f});
+
+    first.QueryState().front().Reset();
+    appendRow(first, 0, 5.f);
+    checkCache(first.QueryState().front().GetState()->cbuffer().as<const float*>(), {5.f});
+}
+
+TEST(KVCacheStateTest, smoke_SetStateChecksTensorDesc_CPU) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(makeKVCacheNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+    auto state = request.QueryState().front();
+    const auto& desc = state.GetState()->getTensorDesc();
+
+    // the blob is used as the state buffer in place, so it has to match the state exactly
+    auto wrongPrecision = InferenceEngine::make_shared_blob<int32_t>({InferenceEngine::Precision::I32, desc.getDims(),
+                                                                     desc.getLayout()});
+    wrongPrecision->allocate();
+    ASSERT_THROW(state.SetState(wrongPrecision), InferenceEngine::details::InferenceEngineException);
+
+    // the same size, but other dimensions
+    auto wrongDims = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                              {cacheShape[0], cacheShape[2], cacheShape[1], cacheShape[3]},
+                                                              InferenceEngine::Layout::NCHW});
+    wrongDims->allocate();
+    ASSERT_THROW(state.SetState(wrongDims), InferenceEngine::details::InferenceEngineException);
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <exec_graph_info.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+namespace {
+/* Attention block with the scale and the mask, the keys length isn't a multiple of the kernel block
+
+    q      k
+     \    /
+     MatMul(transpose_b)
+        |
+     Multiply(scale)
+        |
+       Add -- mask
+        |
+     Softmax      v
+         \       /
+          MatMul
+*/
+const ngraph::Shape qShape = {2, 3, 40, 16};
+const ngraph::Shape kShape = {2, 3, 70, 16};
+const ngraph::Shape vShape = {2, 3, 70, 8};
+const ngraph::Shape maskShape = {2, 1, 1, 70};
+
+InferenceEngine::CNNNetwork makeAttentionNetwork() {
+    using namespace ngraph;
+
+    auto q = std::make_shared<opset1::Parameter>(element::f32, qShape);
+    q->set_friendly_name("q");
+    auto k = std::make_shared<opset1::Parameter>(element::f32, kShape);
+    k->set_friendly_name("k");
+    auto v = std::make_shared<opset1::Parameter>(element::f32, vShape);
+    v->set_friendly_name("v");
+    auto mask = std::make_shared<opset1::Parameter>(element::f32, maskShape);
+    mask->set_friendly_name("mask");
+
+    auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+    auto scale = std::make_shared<opset1::Multiply>(qk, opset1::Constant::create(element::f32, Shape{}, {0.25}));
+    auto add = std::make_shared<opset1::Add>(scale, mask);
+    auto softmax = std::make_shared<opset1::Softmax>(add, 3);
+    auto sv = std::make_shared<opset1::MatMul>(softmax, v);
+    sv->set_friendly_name("attention");
+
+    return InferenceEngine::CNNNetwork(std::make_shared<Function>(NodeVector{sv}, ParameterVector{q, k, v, mask}));
+}
+
+std::vector<float> infer(const std::string& fusionMode, const std::map<std::string, std::vector<float>>& inputs,
+                         bool& isFused) {
+    auto ie = PluginCache::get().ie();
+    // both networks are executed in FP32 to compare them with a tight threshold
+    std::map<std::string, std::string> config = {
+        {InferenceEngine::PluginConfigInternalParams::KEY_ATTENTION_FUSION_MODE, fusionMode},
+        {InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO}};
+    auto execNet = ie->LoadNetwork(makeAttentionNetwork(), CommonTestUtils::DEVICE_CPU, config);
+
+    isFused = false;
+    for (const auto& op : execNet.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        const auto type = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        if (type != rtInfo.end() &&
+            ngraph::as_type_ptr<ngraph::VariantWrapper<std::string>>(type->second)->get() == "ScaledDotProductAttention")
+            isFused = true;
+    }
+
+    auto request = execNet.CreateInferRequest();
+    for (const auto& input : inputs) {
+        auto blob = request.GetBlob(input.first);
+        std::copy(input.second.begin(), input.second.end(), blob->buffer().as<float*>());
+    }
+    request.Infer();
+    auto output = request.GetBlob("attention");
+    auto data = output->cbuffer().as<const float*>();
+    return std::vector<float>(data, data + output->size());
+}
+}  // namespace
+
+TEST(ScaledDotProductAttentionTest, smoke_FusedMatchesUnfused_CPU) {
+    std::mt19937 gen(0);
+    std::normal_distribution<float> dist;
+    auto generate = [&](const ngraph::Shape& shape) {
+        std::vector<float> data(ngraph::shape_size(shape));
+        for (auto& value : data)
+            value = dist(gen);
+        return data;
+    };
+    std::map<std::string, std::vector<float>> inputs = {
+        {"q", generate(qShape)}, {"k", generate(kShape)}, {"v", generate(vShape)}, {"mask", generate(maskShape)}};
+    // masked out keys of the second batch
+    std::fill(inputs["mask"].end() - 10, inputs["mask"].end(), -10000.f);
+
+    bool isFused = false;
+    auto reference = infer(InferenceEngine::PluginConfigParams::NO, inputs, isFused);
+    ASSERT_FALSE(isFused);
+    auto actual = infer(InferenceEngine::PluginConfigParams::YES, inputs, isFused);
+    ASSERT_TRUE(isFused);
+
+    ASSERT_EQ(reference.size(), actual.size());
+    for (size_t i = 0; i < reference.size(); i++)
+        ASSERT_NEAR(reference[i], actual[i], 1e-4f * std::max(1.f, std::fabs(reference[i]))) << "element " << i;
+}
@@ -0,0 +1,175 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <shared_test_classes/single_layer/activation.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ie_system_conf.h"
+
+using namespace CPUTestUtils;
+using ngraph::helpers::EltwiseTypes;
+using ngraph::helpers::ActivationTypes;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<std::vector<size_t>>,   // Input shapes
+        std::vector<EltwiseTypes>,          // Eltwise operations
+        ActivationTypes,                    // Activation after the first eltwise operation
+        CPUSpecificParams
+> SnippetsEltwiseChainTuple;
+
+// Chain of eltwise operations over network inputs, which is tokenized into a single Subgraph node and compared
+// with the reference. The subgraph keeps runtime info of the last operation of the chain, so layouts are forced
+// the same way as for single layers.
+class SnippetsEltwiseChainCPUTest : public testing::WithParamInterface<SnippetsEltwiseChainTuple>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon,
+                                    public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsEltwiseChainTuple> &obj) {
+        std::vector<std::vector<size_t>> inputShapes;
+        std::vector<EltwiseTypes> eltwiseOpTypes;
+        ActivationTypes activationType;
+        CPUSpecificParams cpuParams;
+        std::tie(inputShapes, eltwiseOpTypes, activationType, cpuParams) = obj.param;
+
+        std::ostringstream results;
+        for (int i = 0; i < inputShapes.size(); i++) {
+            results << "IS" << std::to_string(i) << "=" << CommonTestUtils::vec2str(inputShapes[i]) << "_";
+        }
+        for (int i = 0; i < eltwiseOpTypes.size(); i++) {
+            results << "Op" << std::to_string(i) << "=" << eltwiseOpTypes[i] << "_";
+        }
+        results << "Activation=" << LayerTestsDefinitions::activationNames[activationType];
+        results << CPUTestsBase::getTestCaseName(cpuParams);
+
+        return results.str();
+    }
+
+    // positive values keep divisions and powers away from singularities
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 10, 1, 4);
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<std::vector<size_t>> inputShapes;
+        std::vector<EltwiseTypes> eltwiseOpTypes;
+        ActivationTypes activationType;
+        CPUSpecificParams cpuParams;
+        std::tie(inputShapes, eltwiseOpTypes, activationType, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+        selectedType = getPrimitiveType();
+
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE, InferenceEngine::PluginConfigParams::YES});
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::NO});
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, inputShapes);
+        std::shared_ptr<ngraph::Node> lastNode = ngraph::builder::makeEltwise(params[0], params[1], eltwiseOpTypes[0]);
+        lastNode = ngraph::builder::makeActivation(lastNode, ngraph::element::f32, activationType);
+        for (size_t i = 1; i < eltwiseOpTypes.size(); i++) {
+            lastNode = ngraph::builder::makeEltwise(lastNode, params[i + 1], eltwiseOpTypes[i]);
+        }
+
+        function = makeNgraphFunction(ngraph::element::f32, params, lastNode, "SnippetsEltwiseChain");
+    }
+};
+
+TEST_P(SnippetsEltwiseChainCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // snippets are generated for AVX2 and newer instruction sets only
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        return;
+
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+    CheckPluginRelatedResults(executableNetwork, "Subgraph");
+}
+
+namespace {
+
+std::vector<std::vector<EltwiseTypes>> eltwiseOps = {
+        { EltwiseTypes::ADD, EltwiseTypes::MULTIPLY, EltwiseTypes::SUBTRACT },
+        { EltwiseTypes::DIVIDE, EltwiseTypes::SQUARED_DIFF, EltwiseTypes::POWER },
+};
+
+std::vector<ActivationTypes> activations = {
+        ActivationTypes::Sigmoid,
+        ActivationTypes::Tanh,
+        ActivationTypes::Negative
+};
+
+// the first input always has the output shape, the other ones are broadcasted per channel, per row, along spatial
+// dimensions or to a scalar; channels and rows are not multiples of the vector length, so tails are processed
+std::vector<std::vector<std::vector<size_t>>> inputShapes4D = {
+        {{1, 19, 5, 7}, {1, 19, 5, 7}, {1, 19, 5, 7}, {1, 19, 5, 7}},
+        {{2, 19, 5, 7}, {1, 19, 1, 1}, {2, 1, 5, 7}, {1, 1, 1, 1}},
+        {{2, 32, 3, 17}, {2, 32, 3, 1}, {2, 32, 1, 17}, {1, 32, 3, 17}},
+        {{1, 3, 67, 67}, {1, 3, 67, 67}, {1, 3, 1, 67}, {1, 1, 67, 67}},
+};
+
+std::vector<CPUSpecificParams> cpuParams4D = {
+        CPUSpecificParams({nchw}, {nchw}, {}, {}),
+        CPUSpecificParams({nhwc}, {nhwc}, {}, {}),
+        CPUSpecificParams({nChw16c}, {nChw16c}, {}, {}),
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEltwiseChain_4D, SnippetsEltwiseChainCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes4D),
+                                ::testing::ValuesIn(eltwiseOps),
+                                ::testing::ValuesIn(activations),
+                                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams4D))),
+                        SnippetsEltwiseChainCPUTest::getTestCaseName);
+
+std::vector<std::vector<std::vector<size_t>>> inputShapes5D = {
+        {{2, 19, 3, 4, 5}, {1, 19, 1, 1, 1}, {2, 1, 3, 4, 5}, {2, 19, 3, 4, 5}},
+        {{1, 16, 2, 3, 33}, {1, 16, 2, 3, 1}, {1, 1, 1, 1, 1}, {1, 16, 1, 3, 33}},
+};
+
+std::vector<CPUSpecificParams> cpuParams5D = {
+        CPUSpecificParams({ncdhw}, {ncdhw}, {}, {}),
+        CPUSpecificParams({ndhwc}, {ndhwc}, {}, {}),
+        CPUSpecificParams({nCdhw16c}, {nCdhw16c}, {}, {}),
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEltwiseChain_5D, SnippetsEltwiseChainCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes5D),
+                                ::testing::ValuesIn(eltwiseOps),
+                                ::testing::ValuesIn(activations),
+                                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams5D))),
+                        SnippetsEltwiseChainCPUTest::getTestCaseName);
+
+// inputs of different ranks are executed in the planar layout only
+std::vector<std::vector<std::vector<size_t>>> inputShapesPlanar = {
+        {{7, 19}, {19}, {7, 1}, {1}},
+        {{3, 5, 17}, {17}, {5, 1}, {3, 5, 17}},
+        {{1, 12, 5, 5}, {5, 5}, {12, 5, 5}, {1}},
+        {{2, 3, 4, 2, 3, 9}, {9}, {2, 3, 4, 2, 3, 9}, {3, 1}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEltwiseChain_Planar, SnippetsEltwiseChainCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapesPlanar),
+                                ::testing::ValuesIn(eltwiseOps),
+                                ::testing::Values(ActivationTypes::Sigmoid),
+                                ::testing::Values(emptyCPUSpec)),
+                        SnippetsEltwiseChainCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,229 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+
+#include "blob_factory.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/test_model/test_model.hpp"
+
+namespace {
+
+// input and initial states of one stream, the stream is scored once per input value
+struct Stream {
+    float seed;
+    std::vector<float> inputs;
+};
+
+using Values = std::vector<std::vector<float>>;
+
+class GNAStatePerRequestTest : public ::testing::TestWithParam<std::string> {
+protected:
+    InferenceEngine::ExecutableNetwork LoadNetwork(bool statePerRequest = true) {
+        auto model = FuncTestUtils::TestModel::getModelWithMultipleMemoryConnections(InferenceEngine::Precision::FP32);
+        auto ie = PluginCache::get().ie();
+        auto net = ie->ReadNetwork(model.model_xml_str, model.weights_blob);
+        net.addOutput("Memory_1");
+        net.addOutput("Memory_2");
+        const std::map<std::string, std::string> config = {
+            {GNA_CONFIG_KEY(DEVICE_MODE), GetParam()},
+            {"GNA_SCALE_FACTOR_0", "1024"},
+            {GNA_CONFIG_KEY(STATE_PER_REQUEST), statePerRequest ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)}
+        };
+        return ie->LoadNetwork(net, CommonTestUtils::DEVICE_GNA, config);
+    }
+
+    // values vary along the blob, so elements mixed up between streams or positions are noticed
+    static InferenceEngine::Blob::Ptr MakeBlob(const InferenceEngine::TensorDesc& desc, float value) {
+        auto blob = make_blob_with_precision(desc);
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            data[i] = value * (1.0f + 0.1f * static_cast<float>(i % 5));
+        }
+        return blob;
+    }
+
+    static void SetInputs(InferenceEngine::ExecutableNetwork& network, InferenceEngine::InferRequest& request, float value) {
+        for (const auto& input : network.GetInputsInfo()) {
+            request.SetBlob(input.first, MakeBlob(input.second->getTensorDesc(), value));
+        }
+    }
+
+    static void SetStates(InferenceEngine::InferRequest& request, float value) {
+        for (auto&& state : request.QueryState()) {
+            auto desc = state.GetState()->getTensorDesc();
+            desc.setPrecision(InferenceEngine::Precision::FP32);
+            state.SetState(MakeBlob(desc, value));
+        }
+    }
+
+    static Values GetStates(InferenceEngine::InferRequest& request) {
+        Values values;
+        for (auto&& state : request.QueryState()) {
+            auto blob = state.GetState();
+            auto data = blob->cbuffer().as<const float*>();
+            values.emplace_back(data, data + blob->size());
+        }
+        return values;
+    }
+
+    static Values GetOutputs(InferenceEngine::ExecutableNetwork& network, InferenceEngine::InferRequest& request) {
+        Values values;
+        for (const auto& output : network.GetOutputsInfo()) {
+            auto blob = request.GetBlob(output.first);
+            auto data = blob->cbuffer().as<const float*>();
+            values.emplace_back(data, data + blob->size());
+        }
+        return values;
+    }
+
+    /**
+     * @brief Scores the stream from its own initial states by a network with states shared by requests
+     * @return outputs after every input and states after the last one
+     */
+    std::pair<std::vector<Values>, Values> ScoreReference(const Stream& stream) {
+        auto network = LoadNetwork(false);
+        auto request = network.CreateInferRequest();
+        SetStates(request, stream.seed);
+        std::vector<Values> outputs;
+        for (auto input : stream.inputs) {
+            SetInputs(network, request, input);
+            request.Infer();
+            outputs.push_back(GetOutputs(network, request));
+        }
+        return {outputs, GetStates(request)};
+    }
+
+    static void ExpectNear(const Values& expected, const Values& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(expected[i].size(), actual[i].size());
+            for (size_t j = 0; j < expected[i].size(); j++) {
+                EXPECT_NEAR(expected[i][j], actual[i][j], 1e-3) << "blob " << i << ", element " << j;
+            }
+        }
+    }
+
+    static float MaxDifference(const Values& lhs, const Values& rhs) {
+        float difference = 0.0f;
+        for (size_t i = 0; i < std::min(lhs.size(), rhs.size()); i++) {
+            for (size_t j = 0; j < std::min(lhs[i].size(), rhs[i].size()); j++) {
+                difference = std::max(difference, std::fabs(lhs[i][j] - rhs[i][j]));
+            }
+        }
+        return difference;
+    }
+};
+
+TEST_P(GNAStatePerRequestTest, SetStateDoesNotAffectOtherRequests) {
+    auto network = LoadNetwork();
+    auto request = network.CreateInferRequest();
+    auto other = network.CreateInferRequest();
+
+    for (auto&& state : request.QueryState()) {
+        auto blob = make_blob_with_precision(state.GetState()->getTensorDesc());
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        std::fill(data, data + blob->size(), 13.0f);
+        state.SetState(blob);
+    }
+
+    for (const auto& values : GetStates(request)) {
+        for (auto value : values) {
+            EXPECT_NEAR(13.0f, value, 1e-3);
+        }
+    }
+    for (const auto& values : GetStates(other)) {
+        for (auto value : values) {
+            EXPECT_NEAR(0.0f, value, 1e-5);
+        }
+    }
+}
+
+TEST_P(GNAStatePerRequestTest, RequestsAreScoredWithOwnStates) {
+    const std::vector<Stream> streams = {{0.5f, {1.5f, 2.0f, 1.0f}}, {1.25f, {0.75f, 1.0f, 2.5f}}};
+
+    auto network = LoadNetwork();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (const auto& stream : streams) {
+        requests.push_back(network.CreateInferRequest());
+        SetStates(requests.back(), stream.seed);
+    }
+
+    // scoring of the streams is interleaved, so the model memory holds states of the other stream before every request
+    std::vector<std::vector<Values>> outputs(streams.size());
+    for (size_t step = 0; step < streams[0].inputs.size(); step++) {
+        for (size_t i = 0; i < streams.size(); i++) {
+            SetInputs(network, requests[i], streams[i].inputs[step]);
+            requests[i].Infer();
+            outputs[i].push_back(GetOutputs(network, requests[i]));
+        }
+    }
+
+    for (size_t i = 0; i < streams.size(); i++) {
+        const auto reference = ScoreReference(streams[i]);
+        for (size_t step = 0; step < streams[i].inputs.size(); step++) {
+            ExpectNear(reference.first[step], outputs[i][step]);
+        }
+        ExpectNear(reference.second, GetStates(requests[i]));
+    }
+
+    EXPECT_GT(MaxDifference(outputs[0].back(), outputs[1].back()), 1e-2);
+    EXPECT_GT(MaxDifference(GetStates(requests[0]), GetStates(requests[1])), 1e-2);
+}
+
+TEST_P(GNAStatePerRequestTest, AsyncRequestsAreScoredWithOwnStates) {
+    const std::vector<Stream> streams = {{0.5f, {1.5f, 2.0f}}, {0.75f, {1.0f, 0.5f}},
+                                         {1.0f, {2.0f, 1.25f}}, {1.25f, {0.75f, 1.75f}}};
+
+    auto network = LoadNetwork();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (const auto& stream : streams) {
+        requests.push_back(network.CreateInferRequest());
+        SetStates(requests.back(), stream.seed);
+    }
+
+    // every stream is scored twice, all of them are in flight at the same time
+    std::vector<std::vector<Values>> outputs(streams.size());
+    for (size_t step = 0; step < streams[0].inputs.size(); step++) {
+        for (size_t i = 0; i < streams.size(); i++) {
+            SetInputs(network, requests[i], streams[i].inputs[step]);
+            requests[i].StartAsync();
+        }
+        for (size_t i = 0; i < streams.size(); i++) {
+            ASSERT_EQ(InferenceEngine::OK, requests[i].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            outputs[i].push_back(GetOutputs(network, requests[i]));
+        }
+    }
+
+    for (size_t i = 0; i < streams.size(); i++) {
+        const auto reference = ScoreReference(streams[i]);
+        for (size_t step = 0; step < streams[i].inputs.size(); step++) {
+            ExpectNear(reference.first[step], outputs[i][step]);
+        }
+        ExpectNear(reference.second, GetStates(requests[i]));
+
+        for (size_t j = 0; j < i; j++) {
+            EXPECT_GT(MaxDifference(outputs[i].back(), outputs[j].back()), 1e-2) << "streams " << j << " and " << i;
+            EXPECT_GT(MaxDifference(GetStates(requests[i]), GetStates(requests[j])), 1e-2) << "streams " << j << " and " << i;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_GNAStatePerRequest, GNAStatePerRequestTest,
+                        ::testing::Values(InferenceEngine::GNAConfigParams::GNA_SW_FP32,
+                                          InferenceEngine::GNAConfigParams::GNA_SW_EXACT));
+
+}  // namespace
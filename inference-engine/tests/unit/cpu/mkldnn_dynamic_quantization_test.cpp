@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/dynamic_quantization.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+std::vector<float> referenceFullyConnected(const std::vector<float>& src, const std::vector<float>& weights,
+                                           const std::vector<float>& bias, size_t N, size_t OC, size_t IC) {
+    std::vector<float> dst(N * OC);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t oc = 0; oc < OC; oc++) {
+            float acc = bias.empty() ? 0.f : bias[oc];
+            for (size_t ic = 0; ic < IC; ic++)
+                acc += src[n * IC + ic] * weights[oc * IC + ic];
+            dst[n * OC + oc] = acc;
+        }
+    }
+    return dst;
+}
+}  // namespace
+
+TEST(DynamicQuantization, QuantizesEveryRowByItsAbsoluteMaximum) {
+    const size_t N = 2, IC = 4;
+    std::vector<float> src = {1.27f, -0.64f, 0.f, 0.01f,
+                              -254.f, 128.f, 2.f, 0.f};
+    std::vector<uint8_t> dst(N * IC);
+    std::vector<float> scales(N);
+
+    DynamicQuantization::quantize(src.data(), dst.data(), scales.data(), N, IC, DynamicQuantization::PerRow);
+
+    ASSERT_FLOAT_EQ(0.01f, scales[0]);
+    ASSERT_FLOAT_EQ(2.f, scales[1]);
+    ASSERT_EQ((std::vector<uint8_t>{255, 64, 128, 129, 1, 192, 129, 128}), dst);
+}
+
+TEST(DynamicQuantization, QuantizesWholeTensorBySingleScale) {
+    const size_t N = 2, IC = 2;
+    std::vector<float> src = {1.f, -0.5f,
+                              -2.54f, 0.f};
+    std::vector<uint8_t> dst(N * IC);
+    std::vector<float> scales(N);
+
+    DynamicQuantization::quantize(src.data(), dst.data(), scales.data(), N, IC, DynamicQuantization::PerTensor);
+
+    ASSERT_FLOAT_EQ(0.02f, scales[0]);
+    ASSERT_FLOAT_EQ(0.02f, scales[1]);
+    ASSERT_EQ((std::vector<uint8_t>{178, 103, 1, 128}), dst);
+}
+
+TEST(DynamicQuantization, QuantizesZeroSourceToZeroPoint) {
+    const size_t N = 1, IC = 3;
+    std::vector<float> src(N * IC, 0.f);
+    std::vector<uint8_t> dst(N * IC);
+    std::vector<float> scales(N);
+
+    DynamicQuantization::quantize(src.data(), dst.data(), scales.data(), N, IC, DynamicQuantization::PerRow);
+
+    ASSERT_FLOAT_EQ(1.f, scales[0]);
+    ASSERT_EQ((std::vector<uint8_t>{128, 128, 128}), dst);
+}
+
+TEST(DynamicQuantization, ComputesFullyConnectedWithinQuantizationError) {
+    const size_t N = 5, OC = 7, IC = 33;
+    std::vector<float> src(N * IC), weights(OC * IC), bias(OC);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = std::sin(static_cast<float>(i)) * (1 + i / IC);
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = std::cos(static_cast<float>(i) / 3) / (1 + i / IC);
+    for (size_t oc = 0; oc < OC; oc++)
+        bias[oc] = static_cast<float>(oc) / 4;
+    auto expected = referenceFullyConnected(src, weights, bias, N, OC, IC);
+
+    for (auto granularity : {DynamicQuantization::PerTensor, DynamicQuantization::PerRow}) {
+        DynamicQuantization quantization(weights.data(), OC, IC, bias, granularity);
+        std::vector<float> dst(N * OC);
+        quantization.execute(src.data(), dst.data(), N);
+
+        for (size_t n = 0; n < N; n++) {
+            // error of every product is limited by a half of quantization steps of source and weights
+            const float tolerance = 0.02f * (n + 1) * IC * (granularity == DynamicQuantization::PerTensor ? N : 1);
+            for (size_t oc = 0; oc < OC; oc++)
+                ASSERT_NEAR(expected[n * OC + oc], dst[n * OC + oc], tolerance) << "row " << n << " channel " << oc;
+        }
+    }
+}
@@ -0,0 +1,136 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/fused_attention.h"
+#include "utils/bfloat16.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+struct AttentionShape {
+    size_t B, H, Lq, Lk, D, Dv;
+};
+
+// k is [B, H, Lk, D], mask is [B, 1, 1, Lk]
+std::vector<float> referenceAttention(const AttentionShape& s, const std::vector<float>& q, const std::vector<float>& k,
+                                      const std::vector<float>& v, const std::vector<float>& mask, float scale) {
+    std::vector<float> dst(s.B * s.H * s.Lq * s.Dv);
+    std::vector<float> scores(s.Lk);
+    for (size_t bh = 0; bh < s.B * s.H; bh++) {
+        const size_t b = bh / s.H;
+        for (size_t i = 0; i < s.Lq; i++) {
+            float maxScore = -INFINITY;
+            for (size_t j = 0; j < s.Lk; j++) {
+                float dot = 0.f;
+                for (size_t d = 0; d < s.D; d++)
+                    dot += q[(bh * s.Lq + i) * s.D + d] * k[(bh * s.Lk + j) * s.D + d];
+                scores[j] = dot * scale + (mask.empty() ? 0.f : mask[b * s.Lk + j]);
+                maxScore = std::max(maxScore, scores[j]);
+            }
+            float sum = 0.f;
+            for (size_t j = 0; j < s.Lk; j++) {
+                scores[j] = std::exp(scores[j] - maxScore);
+                sum += scores[j];
+            }
+            for (size_t dv = 0; dv < s.Dv; dv++) {
+                float acc = 0.f;
+                for (size_t j = 0; j < s.Lk; j++)
+                    acc += scores[j] * v[(bh * s.Lk + j) * s.Dv + dv];
+                dst[(bh * s.Lq + i) * s.Dv + dv] = acc / sum;
+            }
+        }
+    }
+    return dst;
+}
+
+std::vector<float> makeData(size_t size, float step) {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = std::sin(step * i);
+    return data;
+}
+
+// [B, H, Lk, D] -> [B, H, D, Lk]
+std::vector<float> transposeKey(const AttentionShape& s, const std::vector<float>& k) {
+    std::vector<float> result(k.size());
+    for (size_t bh = 0; bh < s.B * s.H; bh++) {
+        for (size_t j = 0; j < s.Lk; j++) {
+            for (size_t d = 0; d < s.D; d++)
+                result[(bh * s.D + d) * s.Lk + j] = k[(bh * s.Lk + j) * s.D + d];
+        }
+    }
+    return result;
+}
+}  // namespace
+
+TEST(FusedAttention, ComputesBroadcastStridesOfMask) {
+    ASSERT_EQ((std::vector<size_t>{7, 0, 0, 1}), FusedAttention::getBroadcastStrides({2, 1, 1, 7}));
+    ASSERT_EQ((std::vector<size_t>{0, 0, 5, 1}), FusedAttention::getBroadcastStrides({3, 5}));
+    ASSERT_EQ((std::vector<size_t>{0, 0, 0, 0}), FusedAttention::getBroadcastStrides({1}));
+}
+
+TEST(FusedAttention, ComputesSameResultAsUnfusedAttention) {
+    // lengths are not multiples of the blocks to cover the tails
+    const AttentionShape s = {2, 3, FusedAttention::qBlock + 5, 2 * FusedAttention::kBlock + 3, 16, 8};
+    auto q = makeData(s.B * s.H * s.Lq * s.D, 0.37f);
+    auto k = makeData(s.B * s.H * s.Lk * s.D, 0.11f);
+    auto v = makeData(s.B * s.H * s.Lk * s.Dv, 0.53f);
+    std::vector<float> mask(s.B * s.Lk, 0.f);
+    for (size_t j = s.Lk - 10; j < s.Lk; j++)
+        mask[j] = -10000.f;
+    const float scale = 1.f / std::sqrt(static_cast<float>(s.D));
+    auto expected = referenceAttention(s, q, k, v, mask, scale);
+    auto maskStrides = FusedAttention::getBroadcastStrides({s.B, 1, 1, s.Lk});
+
+    for (bool transposeK : {true, false}) {
+        auto key = transposeK ? k : transposeKey(s, k);
+        FusedAttention attention(s.B, s.H, s.Lq, s.Lk, s.D, s.Dv, scale, transposeK, maskStrides);
+        std::vector<float> dst(expected.size());
+        attention.execute(q.data(), key.data(), v.data(), mask.data(), dst.data());
+
+        for (size_t i = 0; i < dst.size(); i++)
+            ASSERT_NEAR(expected[i], dst[i], 1e-5f) << "index " << i << " transposeK " << transposeK;
+    }
+}
+
+TEST(FusedAttention, ComputesWithoutMask) {
+    const AttentionShape s = {1, 2, 3, FusedAttention::kBlock + 1, 4, 5};
+    auto q = makeData(s.B * s.H * s.Lq * s.D, 0.7f);
+    auto k = makeData(s.B * s.H * s.Lk * s.D, 0.3f);
+    auto v = makeData(s.B * s.H * s.Lk * s.Dv, 0.9f);
+    auto expected = referenceAttention(s, q, k, v, {}, 2.f);
+
+    FusedAttention attention(s.B, s.H, s.Lq, s.Lk, s.D, s.Dv, 2.f, true, {});
+    std::vector<float> dst(expected.size());
+    attention.execute(q.data(), k.data(), v.data(), nullptr, dst.data());
+
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_NEAR(expected[i], dst[i], 1e-5f) << "index " << i;
+}
+
+TEST(FusedAttention, ComputesBF16Data) {
+    const AttentionShape s = {1, 2, 7, 9, 8, 8};
+    auto toBF16 = [](std::vector<float>& data) {
+        std::vector<bfloat16_t> result(data.begin(), data.end());
+        // reference is computed on the rounded values
+        data.assign(result.begin(), result.end());
+        return result;
+    };
+    auto q = makeData(s.B * s.H * s.Lq * s.D, 0.37f);
+    auto k = makeData(s.B * s.H * s.Lk * s.D, 0.11f);
+    auto v = makeData(s.B * s.H * s.Lk * s.Dv, 0.53f);
+    auto qBF16 = toBF16(q), kBF16 = toBF16(k), vBF16 = toBF16(v);
+    auto expected = referenceAttention(s, q, k, v, {}, 0.5f);
+
+    FusedAttention attention(s.B, s.H, s.Lq, s.Lk, s.D, s.Dv, 0.5f, true, {});
+    std::vector<bfloat16_t> dst(expected.size());
+    attention.execute(qBF16.data(), kBF16.data(), vBF16.data(), nullptr, dst.data());
+
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_NEAR(expected[i], static_cast<float>(dst[i]), 1e-2f) << "index " << i;
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "mkldnn_primitives_cache.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+
+namespace {
+std::shared_ptr<primitive> makePrimitive() {
+    return std::make_shared<primitive>();
+}
+
+convolution_forward::primitive_desc makeConvolution(const engine& eng, memory::dim stride, const primitive_attr& attr = {}) {
+    memory::desc src({1, 16, 8, 8}, memory::data_type::f32, memory::format_tag::nChw8c);
+    memory::desc weights({16, 16, 3, 3}, memory::data_type::f32, memory::format_tag::any);
+    memory::desc dst({1, 16, 8 / stride, 8 / stride}, memory::data_type::f32, memory::format_tag::nChw8c);
+    convolution_forward::desc desc(prop_kind::forward_scoring, algorithm::convolution_direct, src, weights, dst,
+                                   {stride, stride}, {1, 1}, {1, 1});
+    return convolution_forward::primitive_desc(desc, attr, eng);
+}
+}  // namespace
+
+TEST(PrimitivesCacheTest, ReturnsCachedPrimitiveForTheSameKey) {
+    MKLDNNPrimitivesCache cache;
+    auto first = cache.findOrCreate("key", makePrimitive);
+    auto second = cache.findOrCreate("key", makePrimitive);
+
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(1, cache.getHits());
+    ASSERT_EQ(1, cache.getMisses());
+    ASSERT_EQ(1, cache.getSize());
+}
+
+TEST(PrimitivesCacheTest, EvictsLeastRecentlyUsedPrimitive) {
+    MKLDNNPrimitivesCache cache;
+    cache.setCapacity(2);
+    auto first = cache.findOrCreate("first", makePrimitive);
+    cache.findOrCreate("second", makePrimitive);
+    // "first" becomes the most recently used one, so "second" is evicted by "third"
+    cache.findOrCreate("first", makePrimitive);
+    cache.findOrCreate("third", makePrimitive);
+
+    ASSERT_EQ(first, cache.findOrCreate("first", makePrimitive));
+    cache.findOrCreate("second", makePrimitive);
+    ASSERT_EQ(2, cache.getSize());
+    ASSERT_EQ(2, cache.getHits());
+    ASSERT_EQ(4, cache.getMisses());
+}
+
+TEST(PrimitivesCacheTest, ZeroCapacityDisablesCache) {
+    MKLDNNPrimitivesCache cache;
+    cache.setCapacity(0);
+    auto first = cache.findOrCreate("key", makePrimitive);
+    auto second = cache.findOrCreate("key", makePrimitive);
+
+    ASSERT_NE(first, second);
+    ASSERT_EQ(0, cache.getSize());
+}
+
+TEST(PrimitivesCacheTest, KeyDependsOnDescriptorAndAttributes) {
+    engine eng(engine::kind::cpu, 0);
+    primitive_attr scaled;
+    scaled.set_output_scales(0, {0.5f});
+    post_ops ops;
+    ops.append_eltwise(1.0f, algorithm::eltwise_relu, 0.0f, 0.0f);
+    primitive_attr relu;
+    relu.set_post_ops(ops);
+
+    auto key = MKLDNNPrimitivesCache::makeKey(makeConvolution(eng, 1));
+
+    ASSERT_FALSE(key.empty());
+    ASSERT_EQ(key, MKLDNNPrimitivesCache::makeKey(makeConvolution(eng, 1)));
+    ASSERT_NE(key, MKLDNNPrimitivesCache::makeKey(makeConvolution(eng, 2)));
+    ASSERT_NE(key, MKLDNNPrimitivesCache::makeKey(makeConvolution(eng, 1, scaled)));
+    ASSERT_NE(key, MKLDNNPrimitivesCache::makeKey(makeConvolution(eng, 1, relu)));
+}
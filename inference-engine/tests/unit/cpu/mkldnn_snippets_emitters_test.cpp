@@ -0,0 +1,200 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <snippets/op/subgraph.hpp>
+
+#include "emitters/cpu_generator.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu::x64;
+using ngraph::snippets::op::Subgraph;
+
+namespace {
+using kernel_t = void (*)(const jit_snippets_call_args*);
+using BodyBuilder = std::function<ngraph::NodeVector(const ngraph::ParameterVector&)>;
+using Reference = std::function<std::vector<float>(const std::vector<float>&)>;
+
+// the innermost dimension of full inputs and outputs, work amounts of the calls are not larger than it
+constexpr size_t maxWorkAmount = 100;
+// elements behind the processed ones, the kernel must not write them even for vector tails
+constexpr size_t guardSize = 16;
+constexpr float guardValue = -12345.f;
+
+float makeValue(size_t input, size_t idx) {
+    return 2.f * std::sin(0.7f * idx + 1.3f * input);
+}
+
+class SnippetsEmittersTest : public ::testing::TestWithParam<cpu_isa_t> {
+protected:
+    void SetUp() override {
+        if (!mayiuse(GetParam()))
+            GTEST_SKIP();
+    }
+
+    // inputs marked as broadcasted have the innermost dimension equal to 1, the kernel is called on work amounts
+    // which are not multiples of the vector length to cover the tail loop
+    void checkSnippet(const std::vector<bool>& broadcasted, const BodyBuilder& build, const Reference& reference) {
+        const ngraph::AxisVector order{0, 1, 2, 3};
+        const ngraph::Shape fullShape{1, 1, 1, maxWorkAmount};
+        ngraph::ParameterVector bodyParams;
+        ngraph::OutputVector inputs;
+        Subgraph::BlockedShapeVector inputShapes;
+        for (bool isBroadcasted : broadcasted) {
+            const ngraph::Shape shape{1, 1, 1, isBroadcasted ? 1 : maxWorkAmount};
+            bodyParams.push_back(std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape));
+            inputs.push_back(std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape));
+            inputShapes.emplace_back(shape, order, ngraph::element::f32);
+        }
+        const auto results = build(bodyParams);
+        Subgraph::BlockedShapeVector outputShapes(results.size(), Subgraph::BlockedShape{fullShape, order, ngraph::element::f32});
+
+        // the generator owns the code, so the subgraph is kept alive while the kernel is called
+        auto snippet = std::make_shared<Subgraph>(inputs, std::make_shared<ngraph::Function>(results, bodyParams));
+        snippet->set_generator(std::make_shared<CPUGenerator>(GetParam()));
+        auto schedule = snippet->generate(outputShapes, inputShapes);
+        auto kernel = (kernel_t)schedule.ptr;
+        ASSERT_NE(nullptr, kernel);
+
+        std::vector<std::vector<float>> src(broadcasted.size());
+        for (size_t i = 0; i < src.size(); i++) {
+            src[i].resize(broadcasted[i] ? 1 : maxWorkAmount + guardSize);
+            for (size_t j = 0; j < src[i].size(); j++)
+                src[i][j] = makeValue(i, j);
+        }
+        std::vector<std::vector<float>> dst(results.size(), std::vector<float>(maxWorkAmount + guardSize));
+
+        for (size_t workAmount : std::vector<size_t>{1, 7, 8, 15, 16, 17, 33, maxWorkAmount}) {
+            jit_snippets_call_args args;
+            for (size_t i = 0; i < src.size(); i++)
+                args.ptrs[i] = src[i].data();
+            for (size_t i = 0; i < dst.size(); i++) {
+                std::fill(dst[i].begin(), dst[i].end(), guardValue);
+                args.ptrs[src.size() + i] = dst[i].data();
+            }
+            args.work_amount = workAmount;
+            kernel(&args);
+
+            std::vector<float> values(src.size());
+            for (size_t j = 0; j < workAmount; j++) {
+                for (size_t i = 0; i < src.size(); i++)
+                    values[i] = src[i][broadcasted[i] ? 0 : j];
+                const auto expected = reference(values);
+                for (size_t i = 0; i < dst.size(); i++) {
+                    ASSERT_NEAR(expected[i], dst[i][j], 1e-4f * std::max(1.f, std::abs(expected[i])))
+                        << "output " << i << " index " << j << " work amount " << workAmount;
+                }
+            }
+            for (size_t i = 0; i < dst.size(); i++) {
+                for (size_t j = workAmount; j < dst[i].size(); j++)
+                    ASSERT_EQ(guardValue, dst[i][j]) << "output " << i << " is written at " << j << " work amount " << workAmount;
+            }
+        }
+    }
+};
+
+std::shared_ptr<ngraph::Node> scalar(float value) {
+    return ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {value});
+}
+
+std::string getIsaName(const testing::TestParamInfo<cpu_isa_t>& obj) {
+    return obj.param == avx512_common ? "avx512" : "avx2";
+}
+}  // namespace
+
+TEST_P(SnippetsEmittersTest, ComputesArithmetic) {
+    checkSnippet({false, false, false}, [](const ngraph::ParameterVector& p) -> ngraph::NodeVector {
+        auto sum = std::make_shared<ngraph::opset1::Add>(p[0], p[1]);
+        auto product = std::make_shared<ngraph::opset1::Multiply>(sum, p[2]);
+        auto difference = std::make_shared<ngraph::opset1::Subtract>(product, p[0]);
+        auto divisor = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Abs>(p[1]), scalar(1.f));
+        return {std::make_shared<ngraph::opset1::Divide>(difference, divisor)};
+    }, [](const std::vector<float>& v) -> std::vector<float> {
+        return {((v[0] + v[1]) * v[2] - v[0]) / (std::abs(v[1]) + 1.f)};
+    });
+}
+
+TEST_P(SnippetsEmittersTest, ComputesBinaryOperationsOnBroadcastedInputs) {
+    checkSnippet({false, true, true}, [](const ngraph::ParameterVector& p) -> ngraph::NodeVector {
+        auto maximum = std::make_shared<ngraph::opset1::Maximum>(p[0], p[1]);
+        auto minimum = std::make_shared<ngraph::opset1::Minimum>(std::make_shared<ngraph::opset1::Multiply>(p[0], p[2]), p[1]);
+        auto squaredDifference = std::make_shared<ngraph::opset1::SquaredDifference>(p[0], p[2]);
+        auto divisor = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Abs>(p[2]), scalar(0.5f));
+        auto floorMod = std::make_shared<ngraph::opset1::FloorMod>(p[0], divisor);
+        auto result = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Subtract>(maximum, minimum), squaredDifference);
+        return {std::make_shared<ngraph::opset1::Add>(result, floorMod)};
+    }, [](const std::vector<float>& v) -> std::vector<float> {
+        const float divisor = std::abs(v[2]) + 0.5f;
+        const float floorMod = v[0] - std::floor(v[0] / divisor) * divisor;
+        return {std::max(v[0], v[1]) - std::min(v[0] * v[2], v[1]) + (v[0] - v[2]) * (v[0] - v[2]) + floorMod};
+    });
+}
+
+TEST_P(SnippetsEmittersTest, ComputesFullOutputOfBroadcastedFirstInput) {
+    checkSnippet({true, false}, [](const ngraph::ParameterVector& p) -> ngraph::NodeVector {
+        return {std::make_shared<ngraph::opset1::Subtract>(std::make_shared<ngraph::opset1::Multiply>(p[0], scalar(3.f)), p[1])};
+    }, [](const std::vector<float>& v) -> std::vector<float> {
+        return {v[0] * 3.f - v[1]};
+    });
+}
+
+TEST_P(SnippetsEmittersTest, ComputesActivations) {
+    checkSnippet({false}, [](const ngraph::ParameterVector& p) -> ngraph::NodeVector {
+        auto relu = std::make_shared<ngraph::opset1::Relu>(std::make_shared<ngraph::opset1::Negative>(p[0]));
+        auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(p[0]);
+        auto tanh = std::make_shared<ngraph::opset1::Tanh>(p[0]);
+        auto exp = std::make_shared<ngraph::opset1::Exp>(std::make_shared<ngraph::opset1::Clamp>(p[0], -1., 1.));
+        auto elu = std::make_shared<ngraph::opset1::Elu>(p[0], 0.5);
+        auto sqrt = std::make_shared<ngraph::opset1::Sqrt>(std::make_shared<ngraph::opset1::Abs>(p[0]));
+        return {std::make_shared<ngraph::opset1::Add>(relu, sigmoid),
+                std::make_shared<ngraph::opset1::Multiply>(tanh, exp),
+                std::make_shared<ngraph::opset1::Subtract>(elu, sqrt)};
+    }, [](const std::vector<float>& v) -> std::vector<float> {
+        const float x = v[0];
+        const float elu = x > 0.f ? x : 0.5f * (std::exp(x) - 1.f);
+        return {std::max(-x, 0.f) + 1.f / (1.f + std::exp(-x)),
+                std::tanh(x) * std::exp(std::min(std::max(x, -1.f), 1.f)),
+                elu - std::sqrt(std::abs(x))};
+    });
+}
+
+TEST_P(SnippetsEmittersTest, ComputesPower) {
+    checkSnippet({false, false}, [](const ngraph::ParameterVector& p) -> ngraph::NodeVector {
+        auto base = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Abs>(p[0]), scalar(0.5f));
+        auto dynamic = std::make_shared<ngraph::opset1::Power>(base, p[1]);
+        auto square = std::make_shared<ngraph::opset1::Power>(p[1], scalar(2.f));
+        auto root = std::make_shared<ngraph::opset1::Power>(base, scalar(0.5f));
+        return {std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Add>(dynamic, square), root)};
+    }, [](const std::vector<float>& v) -> std::vector<float> {
+        const float base = std::abs(v[0]) + 0.5f;
+        return {std::pow(base, v[1]) + v[1] * v[1] + std::sqrt(base)};
+    });
+}
+
+TEST_P(SnippetsEmittersTest, ComputesMaximumNumberOfInputsAndOutputs) {
+    checkSnippet({false, true, false, true, false}, [](const ngraph::ParameterVector& p) -> ngraph::NodeVector {
+        std::shared_ptr<ngraph::Node> sum = p[0];
+        for (size_t i = 1; i < p.size(); i++)
+            sum = std::make_shared<ngraph::opset1::Add>(sum, std::make_shared<ngraph::opset1::Multiply>(p[i], scalar(i + 1.f)));
+        return {sum, std::make_shared<ngraph::opset1::Multiply>(p[1], p[4])};
+    }, [](const std::vector<float>& v) -> std::vector<float> {
+        float sum = v[0];
+        for (size_t i = 1; i < v.size(); i++)
+            sum += v[i] * (i + 1.f);
+        return {sum, v[1] * v[4]};
+    });
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEmitters, SnippetsEmittersTest,
+                        ::testing::Values(avx2, avx512_common),
+                        getIsaName);
@@ -0,0 +1,99 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "nodes/common/sparse_weights.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+template <typename src_t, typename wei_t>
+std::vector<float> referenceFullyConnected(const std::vector<src_t>& src, const std::vector<wei_t>& weights,
+                                           const std::vector<float>& bias, size_t N, size_t OC, size_t IC) {
+    std::vector<float> dst(N * OC);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t oc = 0; oc < OC; oc++) {
+            float acc = bias.empty() ? 0.f : bias[oc];
+            for (size_t ic = 0; ic < IC; ic++)
+                acc += static_cast<float>(src[n * IC + ic]) * static_cast<float>(weights[oc * IC + ic]);
+            dst[n * OC + oc] = acc;
+        }
+    }
+    return dst;
+}
+
+template <typename wei_t>
+std::vector<wei_t> makeSparseWeights(size_t OC, size_t IC) {
+    std::vector<wei_t> weights(OC * IC, 0);
+    // every fifth value is non zero
+    for (size_t i = 0; i < weights.size(); i += 5)
+        weights[i] = static_cast<wei_t>((i % 2 ? 1 : -1) * static_cast<int>(i % 7 + 1));
+    return weights;
+}
+
+std::vector<uint8_t> pack(const void* weights, Precision weightsPrc, size_t OC, size_t IC) {
+    std::vector<uint8_t> packed(SparseWeights::getPackedSize(weights, weightsPrc, OC, IC));
+    SparseWeights::pack(weights, weightsPrc, OC, IC, packed.data());
+    return packed;
+}
+}  // namespace
+
+TEST(SparseWeightsTest, ComputesFP32FullyConnected) {
+    const size_t N = 37, OC = 70, IC = 23;
+    auto weights = makeSparseWeights<float>(OC, IC);
+    std::vector<float> src(N * IC), bias(OC);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 11) * 0.25f - 1.f;
+    for (size_t i = 0; i < bias.size(); i++)
+        bias[i] = static_cast<float>(i) * 0.5f;
+
+    auto packed = pack(weights.data(), Precision::FP32, OC, IC);
+    SparseWeights sparseWeights(packed.data(), Precision::FP32, Precision::FP32, OC, IC, bias);
+    std::vector<float> dst(N * OC);
+    sparseWeights.execute(reinterpret_cast<const uint8_t*>(src.data()), dst.data(), N);
+
+    auto expected = referenceFullyConnected(src, weights, bias, N, OC, IC);
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_NEAR(expected[i], dst[i], 1e-4f) << "at " << i;
+}
+
+TEST(SparseWeightsTest, ComputesINT8FullyConnected) {
+    const size_t N = 5, OC = 9, IC = 130;
+    auto weights = makeSparseWeights<int8_t>(OC, IC);
+    std::vector<uint8_t> src(N * IC);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<uint8_t>(i % 251);
+
+    auto packed = pack(weights.data(), Precision::I8, OC, IC);
+    SparseWeights sparseWeights(packed.data(), Precision::I8, Precision::U8, OC, IC, {});
+    std::vector<float> dst(N * OC);
+    sparseWeights.execute(src.data(), dst.data(), N);
+
+    ASSERT_EQ(referenceFullyConnected(src, weights, {}, N, OC, IC), dst);
+}
+
+TEST(SparseWeightsTest, PacksOnlyNonZeroValues) {
+    const size_t OC = 16, IC = 64;
+    auto weights = makeSparseWeights<float>(OC, IC);
+
+    ASSERT_NEAR(0.8f, SparseWeights::getSparsity(weights.data(), Precision::FP32, weights.size()), 0.01f);
+    auto packed = pack(weights.data(), Precision::FP32, OC, IC);
+    SparseWeights sparseWeights(packed.data(), Precision::FP32, Precision::FP32, OC, IC, {});
+    ASSERT_EQ(OC * IC * sizeof(float), sparseWeights.getDenseSize());
+    ASSERT_EQ(packed.size(), sparseWeights.getPackedSize());
+    ASSERT_LT(sparseWeights.getPackedSize(), sparseWeights.getDenseSize() / 2);
+}
+
+TEST(SparseWeightsTest, ThrowsOnUnsupportedPrecisions) {
+    std::vector<float> weights(4, 1.f);
+    ASSERT_FALSE(SparseWeights::isSupported(Precision::BF16, Precision::FP32));
+    auto packed = pack(weights.data(), Precision::FP32, 2, 2);
+    ASSERT_THROW(SparseWeights(packed.data(), Precision::FP32, Precision::U8, 2, 2, {}), details::InferenceEngineException);
+    ASSERT_THROW(pack(weights.data(), Precision::I32, 2, 2), details::InferenceEngineException);
+}
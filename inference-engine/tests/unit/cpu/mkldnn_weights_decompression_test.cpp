@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/weights_decompression.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+template <typename wei_t>
+std::vector<float> referenceFullyConnected(const std::vector<float>& src, const std::vector<wei_t>& weights,
+                                           const std::vector<float>& scales, const std::vector<float>& shifts,
+                                           const std::vector<float>& bias, size_t N, size_t OC, size_t IC) {
+    std::vector<float> dst(N * OC);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t oc = 0; oc < OC; oc++) {
+            float acc = bias.empty() ? 0.f : bias[oc];
+            for (size_t ic = 0; ic < IC; ic++)
+                acc += src[n * IC + ic] * (weights[oc * IC + ic] * scales[oc] + shifts[oc]);
+            dst[n * OC + oc] = acc;
+        }
+    }
+    return dst;
+}
+
+std::vector<float> makeSource(size_t N, size_t IC) {
+    std::vector<float> src(N * IC);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 11) / 4 - 1;
+    return src;
+}
+}  // namespace
+
+TEST(WeightsDecompression, ComputesSameResultAsDecompressedU8Weights) {
+    // N and OC are not multiples of the blocks to cover the tails
+    const size_t N = 19, OC = 21, IC = 35;
+    std::vector<uint8_t> weights(OC * IC);
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = static_cast<uint8_t>(i * 7 % 256);
+    std::vector<float> scales(OC), shifts(OC), bias(OC);
+    for (size_t oc = 0; oc < OC; oc++) {
+        scales[oc] = 0.01f * (oc + 1);
+        shifts[oc] = -scales[oc] * 128;
+        bias[oc] = static_cast<float>(oc) / 2;
+    }
+    auto src = makeSource(N, IC);
+
+    WeightsDecompression decompression(Precision::U8, OC, IC, scales, shifts);
+    std::vector<float> dst(N * OC);
+    decompression.execute(src.data(), weights.data(), bias.data(), dst.data(), N);
+
+    auto expected = referenceFullyConnected(src, weights, scales, shifts, bias, N, OC, IC);
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_NEAR(expected[i], dst[i], 1e-3f) << "index " << i;
+}
+
+TEST(WeightsDecompression, ComputesSameResultAsDecompressedI8WeightsWithoutBias) {
+    const size_t N = 3, OC = 8, IC = 64;
+    std::vector<int8_t> weights(OC * IC);
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = static_cast<int8_t>(static_cast<int>(i % 255) - 127);
+    std::vector<float> scales(OC, 0.5f), shifts(OC, 0.f);
+    auto src = makeSource(N, IC);
+
+    WeightsDecompression decompression(Precision::I8, OC, IC, scales, shifts);
+    std::vector<float> dst(N * OC);
+    decompression.execute(src.data(), weights.data(), nullptr, dst.data(), N);
+
+    auto expected = referenceFullyConnected(src, weights, scales, shifts, {}, N, OC, IC);
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_NEAR(expected[i], dst[i], 1e-3f) << "index " << i;
+}
+
+TEST(WeightsDecompression, ThrowsOnUnsupportedConfiguration) {
+    ASSERT_TRUE(WeightsDecompression::isSupported(Precision::U8));
+    ASSERT_FALSE(WeightsDecompression::isSupported(Precision::FP32));
+    ASSERT_THROW(WeightsDecompression(Precision::FP32, 2, 2, {1.f, 1.f}, {0.f, 0.f}), details::InferenceEngineException);
+    ASSERT_THROW(WeightsDecompression(Precision::U8, 2, 2, {1.f}, {0.f, 0.f}), details::InferenceEngineException);
+}
+
+TEST(WeightsDecompression, ReportsCompressedSize) {
+    WeightsDecompression decompression(Precision::U8, 4, 8, std::vector<float>(4, 1.f), std::vector<float>(4, 0.f));
+    ASSERT_EQ(32, decompression.getCompressedSize());
+    ASSERT_EQ(128, decompression.getDecompressedSize());
+}
@@ -0,0 +1,253 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "runtime/floatmath.h"
+#include "runtime/cnn.h"
+#include "backend/gna_limitations.hpp"
+#include "gna_lib_ver_selector.hpp"
+
+namespace {
+
+class GNAFloatMathTest : public ::testing::Test {
+protected:
+    std::vector<float> random(size_t size) {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        std::vector<float> data(size);
+        for (auto& value : data) {
+            value = dist(generator);
+        }
+        return data;
+    }
+
+    // op(A) * op(B), where op(A) is MxK and op(B) is KxN, both matrices are dense row major
+    static std::vector<float> product(const std::vector<float>& A, bool transA, const std::vector<float>& B, bool transB,
+                                      int M, int N, int K) {
+        std::vector<float> result(M * N, 0.0f);
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                for (int k = 0; k < K; k++) {
+                    result[i * N + j] += (transA ? A[k * M + i] : A[i * K + k]) * (transB ? B[j * K + k] : B[k * N + j]);
+                }
+            }
+        }
+        return result;
+    }
+
+    std::mt19937 generator{42};
+};
+
+TEST_F(GNAFloatMathTest, sgemmMatchesNaiveProduct) {
+    // sizes are not multiples of any vector length or block size
+    const int M = 301, N = 3, K = 517;
+    auto A = random(M * K);
+    auto B = random(K * N);
+    auto C = random(M * N);
+    auto expected = C;
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < K; k++) {
+                expected[i * N + j] += A[i * K + k] * B[k * N + j];
+            }
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N, 1.0f, C.data(), N);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4f) << "at index " << i;
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemmSubsetComputesOnlyListedRows) {
+    const int M = 64, N = 2, K = 37;
+    const std::vector<uint32_t> outputs = {0, 13, 63};
+    const int L = static_cast<int>(outputs.size());
+    auto A = random(M * K);
+    auto B = random(K * N);
+    std::vector<float> C(L * N, 0.0f);
+    std::vector<float> expected(L * N, 0.0f);
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < K; k++) {
+                expected[l * N + j] += A[outputs[l] * K + k] * B[k * N + j];
+            }
+        }
+    }
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N, 1.0f, C.data(), N,
+                       outputs.data(), L);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4f) << "at index " << i;
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemvSplitMatchesNaiveProduct) {
+    const uint32_t N = 19, K1 = 21, K2 = 11;
+    auto A1 = random(K1);
+    auto A2 = random(K2);
+    auto X = random(N * (K1 + K2));
+    auto B = random(N);
+    std::vector<float> C(N);
+
+    sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+
+    for (uint32_t i = 0; i < N; i++) {
+        float expected = B[i];
+        for (uint32_t j = 0; j < K1; j++) {
+            expected += A1[j] * X[i * (K1 + K2) + j];
+        }
+        for (uint32_t j = 0; j < K2; j++) {
+            expected += A2[j] * X[i * (K1 + K2) + K1 + j];
+        }
+        ASSERT_NEAR(expected, C[i], 1e-4f) << "at row " << i;
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemmTransposedBScalesAndAccumulates) {
+    const int M = 45, N = 7, K = 259;
+    const float alpha = 0.5f, beta = 2.0f;
+    auto A = random(M * K);
+    auto B = random(N * K);
+    auto C = random(M * N);
+    auto expected = product(A, false, B, true, M, N, K);
+    for (size_t i = 0; i < expected.size(); i++) {
+        expected[i] = beta * C[i] + alpha * expected[i];
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, alpha, A.data(), K, B.data(), K, beta, C.data(), N);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4f) << "at index " << i;
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemmTransposedAMatchesNaiveProduct) {
+    const int M = 33, N = 5, K = 71;
+    auto A = random(K * M);
+    auto B = random(K * N);
+    auto C = random(M * N);
+    auto expected = product(A, true, B, false, M, N, K);
+    for (size_t i = 0; i < expected.size(); i++) {
+        expected[i] += C[i];
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), M, B.data(), N, 1.0f, C.data(), N);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4f) << "at index " << i;
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemmSubsetTransposedBComputesOnlyListedColumns) {
+    const int M = 9, N = 40, K = 23;
+    const float alpha = 2.0f, beta = 0.5f;
+    const std::vector<uint32_t> outputs = {39, 2, 17, 0};
+    const int L = static_cast<int>(outputs.size());
+    auto A = random(M * K);
+    auto B = random(N * K);
+    auto C = random(M * L);
+    auto full = product(A, false, B, true, M, N, K);
+    std::vector<float> expected(M * L);
+    for (int i = 0; i < M; i++) {
+        for (int l = 0; l < L; l++) {
+            expected[i * L + l] = beta * C[i * L + l] + alpha * full[i * N + outputs[l]];
+        }
+    }
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, alpha, A.data(), K, B.data(), K, beta, C.data(), L,
+                       outputs.data(), L);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4f) << "at index " << i;
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemmSubsetTransposedAComputesOnlyListedRows) {
+    const int M = 50, N = 3, K = 29;
+    const std::vector<uint32_t> outputs = {49, 1, 20};
+    const int L = static_cast<int>(outputs.size());
+    auto A = random(K * M);
+    auto B = random(K * N);
+    auto C = random(L * N);
+    auto full = product(A, true, B, false, M, N, K);
+    std::vector<float> expected(L * N);
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            expected[l * N + j] = C[l * N + j] + full[outputs[l] * N + j];
+        }
+    }
+
+    cblas_sgemm_subset(CblasRowMajor, CblasTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), M, B.data(), N, 1.0f, C.data(), N,
+                       outputs.data(), L);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4f) << "at index " << i;
+    }
+}
+
+#if GNA_LIB_VER == 2
+TEST_F(GNAFloatMathTest, cnn2DFilterMatchesNaiveConvolution) {
+    // the number of channels is not a multiple of the dot product lanes, kernels are padded to 16 bytes
+    const uint32_t IH = 7, IW = 6, IC = 5;
+    const uint32_t KH = 3, KW = 2, OC = 3;
+    const std::array<uint32_t, 2> stride = {2, 1};
+    const std::array<uint32_t, 2> padding = {1, 1};
+    const uint32_t OH = (IH + 2 * padding[0] - KH) / stride[0] + 1;
+    const uint32_t OW = (IW + 2 * padding[1] - KW) / stride[1] + 1;
+    const uint32_t kernelStride = ALIGN(KH * KW * IC, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+
+    auto input = random(IH * IW * IC);
+    auto filters = random(OC * kernelStride);
+    auto biases = random(OC);
+    std::vector<float> output(OH * OW * OC, 0.0f);
+
+    intel_dnn_component_t component;
+    // tensor types are not used by the software runtime, FP32 values are 4 bytes wide
+    const auto type = OvGnaTypeIntFromBytes(sizeof(float));
+    component.tensors.push_back({{1, IH, IW, IC}, type, OvGnaModeDefault});
+    component.tensors.push_back({{1, OH, OW, OC}, type, OvGnaModeDefault});
+    component.tensors.push_back({{OC, KH, KW, IC}, type, OvGnaModeDefault});
+    component.tensors.push_back({{OC}, type, OvGnaModeDefault});
+    component.op.conv2D.convStride = stride;
+    component.op.conv2D.zeroPadding = padding;
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv";
+
+    CNN2DFilter32(&component);
+
+    // all tensors are NHWC
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < OC; oc++) {
+                float expected = biases[oc];
+                for (uint32_t kh = 0; kh < KH; kh++) {
+                    for (uint32_t kw = 0; kw < KW; kw++) {
+                        const int ih = static_cast<int>(oh * stride[0] + kh) - static_cast<int>(padding[0]);
+                        const int iw = static_cast<int>(ow * stride[1] + kw) - static_cast<int>(padding[1]);
+                        if (ih < 0 || ih >= static_cast<int>(IH) || iw < 0 || iw >= static_cast<int>(IW)) {
+                            continue;
+                        }
+                        for (uint32_t c = 0; c < IC; c++) {
+                            expected += input[(ih * IW + iw) * IC + c] * filters[oc * kernelStride + (kh * KW + kw) * IC + c];
+                        }
+                    }
+                }
+                ASSERT_NEAR(expected, output[(oh * OW + ow) * OC + oc], 1e-4f) << "at " << oh << ", " << ow << ", " << oc;
+            }
+        }
+    }
+}
+#endif
+
+}  // namespace
@@ -23,7 +23,8 @@ const std::map<std::string, std::string>  supportedConfigKeysWithDefaults = {
     {GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT), "1.000000"},
     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(LIB_N_THREADS), "1"},
-    {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)}
+    {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)},
+    {GNA_CONFIG_KEY(STATE_PER_REQUEST), CONFIG_VALUE(NO)}
 };
 
 class GNAPluginConfigTest : public ::testing::Test {
@@ -186,3 +187,8 @@ TEST_F(GNAPluginConfigTest, GnaConfigSingleThreadTest) {
                     config.gnaFlags.gna_openmp_multithreading,
                     true);
 }
+
+TEST_F(GNAPluginConfigTest, GnaConfigStatePerRequestTest) {
+    SetAndCheckFlag(GNA_CONFIG_KEY(STATE_PER_REQUEST),
+                    config.gnaFlags.state_per_request);
+}
@@ -36,3 +36,14 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, countThreadsOfAllStreamsExecutors) {
+    ExecutorManagerImpl _manager;
+    auto executor = _manager.getExecutor("CPU");
+    IStreamsExecutor::Config config{"TestStreamsExecutor", 2};
+    auto streamsExecutor1 = _manager.getIdleCPUStreamsExecutor(config);
+    auto streamsExecutor2 = _manager.getIdleCPUStreamsExecutor(config);
+
+    ASSERT_NE(streamsExecutor1, streamsExecutor2);
+    ASSERT_EQ(5, _manager.getStreamsThreadsNumber());
+}
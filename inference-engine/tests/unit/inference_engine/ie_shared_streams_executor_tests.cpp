@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <threading/ie_executor_manager.hpp>
+#include <threading/ie_shared_streams_executor.hpp>
+#include <details/ie_exception.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+IStreamsExecutor::Config makePoolConfig(int streams) {
+    return IStreamsExecutor::Config{"TestSharedStreamsPool", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+}
+}  // namespace
+
+TEST(SharedStreamsExecutorTests, throwsOnWrongClientConfig) {
+    auto pool = std::make_shared<SharedStreamsPool>(makePoolConfig(1));
+
+    ASSERT_THROW(SharedStreamsExecutor(nullptr, {"client", 1, 1}), details::InferenceEngineException);
+    ASSERT_THROW(SharedStreamsExecutor(pool, {"client", 0, 1}), details::InferenceEngineException);
+    ASSERT_THROW(SharedStreamsExecutor(pool, {"client", 1, 0}), details::InferenceEngineException);
+}
+
+TEST(SharedStreamsExecutorTests, runningTasksDoNotExceedQuota) {
+    auto pool = std::make_shared<SharedStreamsPool>(makePoolConfig(4));
+    SharedStreamsExecutor executor{pool, {"client", 1, 2}};
+    std::atomic<int> running{0}, maxRunning{0}, maxStreamId{0};
+
+    std::vector<Task> tasks(32, [&] {
+        int current = ++running;
+        int expected = maxRunning;
+        while (current > expected && !maxRunning.compare_exchange_weak(expected, current)) {}
+        int streamId = executor.GetStreamId();
+        expected = maxStreamId;
+        while (streamId > expected && !maxStreamId.compare_exchange_weak(expected, streamId)) {}
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        --running;
+    });
+    executor.runAndWait(tasks);
+
+    ASSERT_LE(maxRunning, 2);
+    ASSERT_LT(maxStreamId, 2);
+    ASSERT_EQ(32, executor.GetStatistics()._tasks);
+    ASSERT_EQ(0, executor.GetStatistics()._queued);
+}
+
+TEST(SharedStreamsExecutorTests, clientsShareStreamsTimeByWeights) {
+    struct Record {
+        bool        _heavy;
+        uint64_t    _heavyTime, _lightTime, _heavyQueued, _lightQueued;
+    };
+    auto pool = std::make_shared<SharedStreamsPool>(makePoolConfig(1));
+    std::vector<Record> records;
+    {
+        SharedStreamsExecutor gate{pool, {"gate", 1, 1}};
+        SharedStreamsExecutor heavy{pool, {"heavy", 3, 1}};
+        SharedStreamsExecutor light{pool, {"light", 1, 1}};
+
+        // the single stream is blocked until both clients have queued all their tasks
+        std::promise<void> gateStarted, gateOpened;
+        auto gateOpenedFuture = gateOpened.get_future();
+        gate.run([&] {
+            gateStarted.set_value();
+            gateOpenedFuture.wait();
+        });
+        gateStarted.get_future().wait();
+
+        // statistics are taken by the running task, while no other task runs, so they are not affected by timing
+        auto makeTask = [&] (bool isHeavy) {
+            return [&, isHeavy] {
+                auto heavyStatistics = heavy.GetStatistics();
+                auto lightStatistics = light.GetStatistics();
+                records.push_back({isHeavy, heavyStatistics._executionTime, lightStatistics._executionTime,
+                                   heavyStatistics._queued, lightStatistics._queued});
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            };
+        };
+        for (int i = 0; i < 100; i++) {
+            heavy.run(makeTask(true));
+            light.run(makeTask(false));
+        }
+        gateOpened.set_value();
+    }
+    // destructors wait for the queued tasks
+    ASSERT_EQ(200u, records.size());
+
+    // while both clients have queued tasks the one with less execution time divided by weight runs next
+    const double epsilon = 1e-6;
+    size_t checked = 0;
+    for (auto&& record : records) {
+        const double heavyVirtualTime = record._heavyTime / 3.0;
+        const double lightVirtualTime = static_cast<double>(record._lightTime);
+        if (record._heavy && record._lightQueued > 0) {
+            ASSERT_LE(heavyVirtualTime, lightVirtualTime + epsilon);
+            checked++;
+        } else if (!record._heavy && record._heavyQueued > 0) {
+            ASSERT_LE(lightVirtualTime, heavyVirtualTime + epsilon);
+            checked++;
+        }
+    }
+    // the client which runs out of tasks first had all of them checked
+    ASSERT_GE(checked, 100u);
+    ASSERT_GT(records.back()._heavyTime + records.back()._lightTime, 0);
+}
+
+TEST(SharedStreamsExecutorTests, returnTheSamePoolForTheSameName) {
+    ExecutorManagerImpl _manager;
+    auto pool1 = _manager.getSharedStreamsPool(makePoolConfig(2));
+    auto pool2 = _manager.getSharedStreamsPool(makePoolConfig(2));
+
+    ASSERT_EQ(pool1, pool2);
+    ASSERT_EQ(2, _manager.getStreamsThreadsNumber());
+}
@@ -0,0 +1,134 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiling_cache.hpp>
+
+using namespace vpu;
+using namespace vpu::HWTilingNS;
+
+namespace {
+
+DimValues makeDims(int width, int height, int channels) {
+    DimValues dims;
+    dims.set(Dim::W, width);
+    dims.set(Dim::H, height);
+    dims.set(Dim::C, channels);
+    return dims;
+}
+
+ConvolutionOptions makeOptions(const std::string& name, int channels) {
+    return ConvolutionOptions(name, makeDims(56, 56, channels), makeDims(56, 56, channels), makeDims(56, 56, channels),
+                              3, 3, 1, 1, 1, 1, 1, false);
+}
+
+}  // namespace
+
+TEST(VPU_HWConvolutionTilingCache, KeyDoesNotDependOnStageName) {
+    const auto key1 = HWConvolutionTilingCache::makeKey(makeOptions("conv1", 64), Direction::INPUT_TO_OUTPUT, 1, 1024);
+    const auto key2 = HWConvolutionTilingCache::makeKey(makeOptions("conv2", 64), Direction::INPUT_TO_OUTPUT, 1, 1024);
+    EXPECT_EQ(key1, key2);
+
+    EXPECT_NE(key1, HWConvolutionTilingCache::makeKey(makeOptions("conv1", 128), Direction::INPUT_TO_OUTPUT, 1, 1024));
+    EXPECT_NE(key1, HWConvolutionTilingCache::makeKey(makeOptions("conv1", 64), Direction::OUTPUT_TO_INPUT, 1, 1024));
+    EXPECT_NE(key1, HWConvolutionTilingCache::makeKey(makeOptions("conv1", 64), Direction::INPUT_TO_OUTPUT, 1, 512));
+}
+
+TEST(VPU_HWConvolutionTilingCache, SearchIsDoneOnce) {
+    auto& cache = HWConvolutionTilingCache::get();
+    const auto key = HWConvolutionTilingCache::makeKey(makeOptions("conv", 17), Direction::INPUT_TO_OUTPUT, 3, 1);
+
+    int searches = 0;
+    const auto search = [&searches] {
+        ++searches;
+        return std::vector<TilingOption>{{1, 2, 3, 6, 0.5}};
+    };
+
+    const auto options1 = cache.findOrSearch(key, search);
+    const auto options2 = cache.findOrSearch(key, search);
+
+    EXPECT_EQ(1, searches);
+    ASSERT_EQ(1u, options2.size());
+    EXPECT_EQ(options1[0].numWidthTiles, options2[0].numWidthTiles);
+    EXPECT_EQ(options1[0].totalNumTiles, options2[0].totalNumTiles);
+}
+
+TEST(VPU_HWConvolutionTilingCache, ResultsAreLoadedFromFile) {
+    auto& cache = HWConvolutionTilingCache::get();
+    const auto key = HWConvolutionTilingCache::makeKey(makeOptions("conv", 19), Direction::INPUT_TO_OUTPUT, 2, 1);
+    const std::string filePath = "vpu_hw_conv_tiling_cache_test.txt";
+
+    {
+        std::ofstream file(filePath);
+        file << "VPU_HW_CONV_TILING_CACHE 1\n";
+        file << key << "=2 2 1 1 2 0.25 1 2 1 2 0.75\n";
+    }
+    cache.load(filePath);
+
+    const auto options = cache.findOrSearch(key, [] {
+        ADD_FAILURE() << "Search must not be called for the loaded entry";
+        return std::vector<TilingOption>{};
+    });
+
+    ASSERT_EQ(2u, options.size());
+    EXPECT_EQ(2, options[0].numWidthTiles);
+    EXPECT_DOUBLE_EQ(0.25, options[0].cost);
+    EXPECT_EQ(2, options[1].numHeightTiles);
+    EXPECT_DOUBLE_EQ(0.75, options[1].cost);
+
+    // The loaded and the searched entries are stored back
+    cache.findOrSearch(HWConvolutionTilingCache::makeKey(makeOptions("conv", 23), Direction::INPUT_TO_OUTPUT, 1, 1), [] {
+        return std::vector<TilingOption>{{1, 1, 1, 1, 1.0}};
+    });
+    cache.store(filePath);
+
+    std::ifstream file(filePath);
+    std::string header;
+    std::getline(file, header);
+    EXPECT_EQ("VPU_HW_CONV_TILING_CACHE 1", header);
+
+    bool keyFound = false;
+    for (std::string line; std::getline(file, line);) {
+        keyFound = keyFound || line.find(key + "=") == 0;
+    }
+    EXPECT_TRUE(keyFound);
+
+    file.close();
+    std::remove(filePath.c_str());
+}
+
+TEST(VPU_HWConvolutionTilingCache, MalformedLinesAreIgnored) {
+    auto& cache = HWConvolutionTilingCache::get();
+    const auto extraFieldsKey =
+        HWConvolutionTilingCache::makeKey(makeOptions("conv", 29), Direction::INPUT_TO_OUTPUT, 1, 1);
+    const auto truncatedKey =
+        HWConvolutionTilingCache::makeKey(makeOptions("conv", 31), Direction::INPUT_TO_OUTPUT, 1, 1);
+    const std::string filePath = "vpu_hw_conv_tiling_cache_malformed_test.txt";
+
+    {
+        std::ofstream file(filePath);
+        file << "VPU_HW_CONV_TILING_CACHE 1\n";
+        file << extraFieldsKey << "=1 1 1 1 1 0.25 7\n";
+        // The last line was cut while it was written, the cost would be read as 0.2 instead of 0.25
+        file << truncatedKey << "=1 1 1 1 1 0.2";
+    }
+    cache.load(filePath);
+    std::remove(filePath.c_str());
+
+    int searches = 0;
+    const auto search = [&searches] {
+        ++searches;
+        return std::vector<TilingOption>{{1, 1, 1, 1, 1.0}};
+    };
+    cache.findOrSearch(extraFieldsKey, search);
+    cache.findOrSearch(truncatedKey, search);
+
+    EXPECT_EQ(2, searches);
+}
@@ -0,0 +1,191 @@
+#!/usr/bin/python3
+
+# Copyright (C) 2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import logging as log
+import os
+import sys
+from argparse import ArgumentParser
+
+import numpy as np
+
+try:
+    from openvino.inference_engine import IECore
+except Exception as e:
+    exception_type = type(e).__name__
+    print("The following error happened while importing Python API module:\n[ {} ] {}".format(exception_type, e))
+    sys.exit(1)
+
+try:
+    import ngraph as ng
+except Exception as e:
+    exception_type = type(e).__name__
+    print("The following error happened while importing nGraph module:\n[ {} ] {}".format(exception_type, e))
+    sys.exit(1)
+
+INFERENCE_PRECISION = 'inferencePrecision'
+FP32_CONFIG = {'ENFORCE_BF16': 'NO', 'PERF_COUNT': 'YES'}
+BF16_CONFIG = {'ENFORCE_BF16': 'YES', 'PERF_COUNT': 'YES'}
+
+
+def build_parser():
+    parser = ArgumentParser(description='Mixed Precision Tool selects layers which are profitable to infer in BF16 '
+                                        'precision on CPU by comparing per layer accuracy and execution time of '
+                                        'FP32 and BF16 inferences')
+    parser.add_argument('-m', '--model', type=str, required=True,
+                        help='Path to an .xml file with a trained FP32 model')
+    parser.add_argument('-i', '--input', type=str, nargs='*', default=[],
+                        help='Paths to .npz files with calibration inputs. Every file holds arrays named after '
+                             'model inputs. Inputs are generated from normal distribution if empty')
+    parser.add_argument('-n', '--num_samples', type=int, default=4,
+                        help='Number of generated calibration inputs, used only if --input is empty. Default: 4')
+    parser.add_argument('-ni', '--num_iter', type=int, default=20,
+                        help='Number of inferences used to measure per layer execution time. Default: 20')
+    parser.add_argument('--max_error', type=float, default=0.01,
+                        help='Maximal normalized RMSE introduced by a layer executed in BF16. Default: 0.01')
+    parser.add_argument('--min_speedup', type=float, default=1.05,
+                        help='Minimal speedup of a layer executed in BF16 over FP32. Default: 1.05')
+    parser.add_argument('-o', '--output', type=str, default=None,
+                        help='Path to the output .xml file. Default: <model>_mixed.xml')
+    parser.add_argument('-v', '--verbose', action='store_true', help='Print per layer statistics')
+    return parser
+
+
+def load_inputs(net, paths: list, num_samples: int):
+    if paths:
+        samples = []
+        for path in paths:
+            data = np.load(path)
+            samples.append({name: data[name] for name in net.input_info})
+        return samples
+    rng = np.random.default_rng(0)
+    return [{name: rng.normal(size=info.input_data.shape).astype(np.float32)
+             for name, info in net.input_info.items()} for _ in range(num_samples)]
+
+
+def exec_graph_layers(exec_net):
+    """Maps original layers of the network to precisions and execution layers they were fused to"""
+    func = ng.function_from_cnn(exec_net.get_exec_graph_info())
+    layers = {}
+    for op in func.get_ordered_ops():
+        rt_info = op.get_rt_info()
+        precision = rt_info['runtimePrecision'].get()
+        for original in rt_info['originalLayersNames'].get().split(','):
+            if original:
+                layers[original] = (op.get_friendly_name(), precision)
+    return layers
+
+
+def measure_time(exec_net, samples: list, num_iter: int):
+    """Returns median execution time of every execution layer in microseconds"""
+    request = exec_net.requests[0]
+    times = {}
+    for i in range(num_iter):
+        request.infer(samples[i % len(samples)])
+        for name, counters in request.get_perf_counts().items():
+            if counters['status'] == 'EXECUTED':
+                times.setdefault(name, []).append(counters['real_time'])
+    return {name: float(np.median(values)) for name, values in times.items()}
+
+
+def infer_outputs(exec_net, samples: list):
+    request = exec_net.requests[0]
+    results = []
+    for sample in samples:
+        request.infer(sample)
+        results.append({name: blob.buffer.astype(np.float32) for name, blob in request.output_blobs.items()})
+    return results
+
+
+def normalized_rmse(reference: np.ndarray, actual: np.ndarray):
+    scale = np.sqrt(np.mean(np.square(reference)))
+    error = np.sqrt(np.mean(np.square(reference - actual)))
+    return float(error / scale) if scale > 0 else float(error)
+
+
+def measure_errors(fp32_outputs: list, bf16_outputs: list):
+    errors = {}
+    for reference, actual in zip(fp32_outputs, bf16_outputs):
+        for name, value in reference.items():
+            if name in actual:
+                errors[name] = max(errors.get(name, 0.), normalized_rmse(value, actual[name]))
+    return errors
+
+
+def select_layers(candidates: dict, errors: dict, fp32_time: dict, bf16_time: dict, fp32_layers: dict,
+                  bf16_layers: dict, max_error: float, min_speedup: float):
+    """Returns the error, the speedup and whether BF16 is selected for every candidate layer.
+    Candidates map layer names to names of the layers producing their inputs"""
+    selection = {}
+    for name, producers in candidates.items():
+        # error accumulated by previous layers is subtracted to get the error introduced by the layer itself
+        inputs_error = max([errors.get(producer, 0.) for producer in producers] + [0.])
+        error = max(errors.get(name, 0.) - inputs_error, 0.)
+        # fused layers share the time of the execution layer they were fused to
+        fp32 = fp32_time.get(fp32_layers.get(name, (None, None))[0], 0.)
+        bf16 = bf16_time.get(bf16_layers[name][0], 0.)
+        speedup = fp32 / bf16 if bf16 > 0 else 1.
+        selection[name] = (error, speedup, error <= max_error and speedup >= min_speedup)
+    return selection
+
+
+def main():
+    log.basicConfig(format='[ %(levelname)s ] %(message)s', level=log.INFO, stream=sys.stdout)
+    args = build_parser().parse_args()
+
+    ie = IECore()
+    if 'BF16' not in ie.get_metric('CPU', 'OPTIMIZATION_CAPABILITIES'):
+        log.error('CPU doesn\'t support BF16 inference')
+        return 1
+
+    model_bin = os.path.splitext(args.model)[0] + '.bin'
+    net = ie.read_network(args.model, model_bin)
+    samples = load_inputs(net, args.input, args.num_samples)
+
+    log.info('Measuring per layer execution time')
+    fp32_exec = ie.load_network(net, 'CPU', FP32_CONFIG)
+    bf16_exec = ie.load_network(net, 'CPU', BF16_CONFIG)
+    fp32_time = measure_time(fp32_exec, samples, args.num_iter)
+    bf16_time = measure_time(bf16_exec, samples, args.num_iter)
+    fp32_layers = exec_graph_layers(fp32_exec)
+    bf16_layers = exec_graph_layers(bf16_exec)
+    candidates = [name for name, (_, precision) in bf16_layers.items() if precision == 'BF16']
+    del fp32_exec, bf16_exec
+
+    log.info('Measuring per layer accuracy of {} BF16 candidates'.format(len(candidates)))
+    func = ng.function_from_cnn(net)
+    ops = {op.get_friendly_name(): op for op in func.get_ordered_ops()}
+    candidates = [name for name in candidates if name in ops and ops[name].get_output_size() == 1]
+    net.add_outputs(candidates)
+    errors = measure_errors(infer_outputs(ie.load_network(net, 'CPU', FP32_CONFIG), samples),
+                            infer_outputs(ie.load_network(net, 'CPU', BF16_CONFIG), samples))
+
+    producers = {name: [port.get_source_output().get_node().get_friendly_name() for port in ops[name].inputs()]
+                 for name in candidates}
+    selection = select_layers(producers, errors, fp32_time, bf16_time, fp32_layers, bf16_layers,
+                              args.max_error, args.min_speedup)
+    selected = 0
+    for name in candidates:
+        error, speedup, is_bf16 = selection[name]
+        ops[name].get_rt_info()[INFERENCE_PRECISION] = 'BF16' if is_bf16 else 'FP32'
+        selected += int(is_bf16)
+        if args.verbose:
+            log.info('{:<60} error {:.6f} speedup {:.3f} -> {}'.format(name, error, speedup,
+                                                                       'BF16' if is_bf16 else 'FP32'))
+
+    output_xml = args.output or os.path.splitext(args.model)[0] + '_mixed.xml'
+    # the network is read again to drop outputs added for accuracy measurement
+    result = ie.read_network(args.model, model_bin)
+    result_ops = {op.get_friendly_name(): op for op in ng.function_from_cnn(result).get_ordered_ops()}
+    for name in candidates:
+        result_ops[name].get_rt_info()[INFERENCE_PRECISION] = ops[name].get_rt_info()[INFERENCE_PRECISION].get()
+    result.serialize(output_xml, os.path.splitext(output_xml)[0] + '.bin')
+    log.info('{} of {} layers are selected for BF16 inference, the model is saved to {}'.format(
+        selected, len(candidates), output_xml))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main() or 0)
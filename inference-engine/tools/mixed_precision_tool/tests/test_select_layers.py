@@ -0,0 +1,55 @@
+# Copyright (C) 2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import os
+import sys
+import types
+
+import pytest
+
+# the selection doesn't need Inference Engine, so the tool is imported with stub modules if they are not installed
+for module in ['openvino', 'openvino.inference_engine', 'ngraph']:
+    sys.modules.setdefault(module, types.ModuleType(module))
+sys.modules['openvino.inference_engine'].IECore = getattr(sys.modules['openvino.inference_engine'], 'IECore', None)
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), os.pardir))
+
+from mixed_precision_tool import select_layers  # noqa: E402
+
+
+def select(errors, fp32_time, bf16_time, max_error=0.01, min_speedup=1.05):
+    # conv1 -> relu1 (fused to conv1) -> conv2
+    candidates = {'conv1': ['input'], 'relu1': ['conv1'], 'conv2': ['relu1']}
+    fp32_layers = {'conv1': ('conv1', 'FP32'), 'relu1': ('conv1', 'FP32'), 'conv2': ('conv2', 'FP32')}
+    bf16_layers = {'conv1': ('conv1', 'BF16'), 'relu1': ('conv1', 'BF16'), 'conv2': ('conv2', 'BF16')}
+    return select_layers(candidates, errors, fp32_time, bf16_time, fp32_layers, bf16_layers, max_error, min_speedup)
+
+
+def test_accurate_and_faster_layers_are_selected():
+    selection = select({'conv1': 0.001, 'relu1': 0.001, 'conv2': 0.002},
+                       {'conv1': 100., 'conv2': 200.}, {'conv1': 50., 'conv2': 100.})
+    assert all(is_bf16 for _, _, is_bf16 in selection.values())
+    assert selection['conv1'][1] == pytest.approx(2.)
+
+
+def test_error_of_inputs_is_not_counted():
+    # conv2 output error is mostly accumulated by conv1
+    selection = select({'conv1': 0.009, 'relu1': 0.009, 'conv2': 0.015},
+                       {'conv1': 100., 'conv2': 200.}, {'conv1': 50., 'conv2': 100.})
+    assert selection['conv2'][0] == pytest.approx(0.006)
+    assert selection['conv2'][2]
+
+
+def test_inaccurate_layer_is_kept_in_fp32():
+    selection = select({'conv1': 0.001, 'relu1': 0.001, 'conv2': 0.05},
+                       {'conv1': 100., 'conv2': 200.}, {'conv1': 50., 'conv2': 100.})
+    assert selection['conv1'][2]
+    assert not selection['conv2'][2]
+
+
+def test_slower_layer_is_kept_in_fp32():
+    selection = select({'conv1': 0.001, 'relu1': 0.001, 'conv2': 0.002},
+                       {'conv1': 100., 'conv2': 200.}, {'conv1': 50., 'conv2': 210.})
+    assert not selection['conv2'][2]
+    # fused layer shares the time of the execution layer
+    assert selection['relu1'][1] == pytest.approx(2.)
@@ -26,19 +26,39 @@ namespace ngraph
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
          *        the result of a folded operation.
+         *
+         *        By default independent constant subgraphs are evaluated concurrently before
+         *        the main traversal. Parallel evaluation can be disabled with the constructor
+         *        argument or with the NGRAPH_SERIAL_CONSTANT_FOLDING environment variable.
+         *        Folded values of a stage are released as soon as the next stage is folded.
+         *        Stages run on the backend set by runtime::parallel_set_backend(), Inference
+         *        Engine Core routes them to its own threading runtime.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
         public:
             NGRAPH_RTTI_DECLARATION;
+            explicit ConstantFolding(bool parallel = true);
+
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
         private:
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
+            /// \brief Replaces node outputs with folded values, returns true if anything
+            /// was replaced.
+            bool replace_with_folded(const std::shared_ptr<Node>& node,
+                                     const OutputVector& replacements);
+            /// \brief Evaluates constant subgraphs built of side effect free operations.
+            /// Subgraph nodes are grouped into stages by their depth, nodes of one stage are
+            /// independent and are evaluated concurrently.
+            bool parallel_subgraphs_folding(const std::shared_ptr<ngraph::Function>& f,
+                                            bool revalidate);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
             bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+
+            bool m_parallel;
         };
     } // namespace pass
 } // namespace ngraph
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Execution statistics of one transformation run by pass::Manager.
+        struct PassProfile
+        {
+            /// \brief Name of the transformation.
+            std::string name;
+            /// \brief Nesting level. Transformations run by a pass::Manager which is itself used
+            ///        inside of another transformation (like CommonOptimizations) have depth 1,
+            ///        their nested transformations have depth 2 and so on.
+            size_t depth = 0;
+            /// \brief Wall time of the transformation including nested transformations.
+            std::chrono::microseconds time{0};
+            /// \brief Number of nodes the transformation tried to match or process, including
+            ///        nested transformations.
+            size_t nodes_visited = 0;
+            /// \brief Number of successfully applied rewrites, including nested transformations.
+            size_t rewrites = 0;
+        };
+
+        /// \brief Collects PassProfile of every transformation executed by pass::Manager on the
+        ///        calling thread during the profiler lifetime.
+        ///
+        ///     pass::PassProfiler profiler;
+        ///     manager.run_passes(f);
+        ///     for (const auto& profile : profiler.get_profiles()) { ... }
+        ///
+        /// Profilers may be nested, the innermost one collects the statistics.
+        class NGRAPH_API PassProfiler
+        {
+        public:
+            PassProfiler();
+            ~PassProfiler();
+
+            PassProfiler(const PassProfiler&) = delete;
+            PassProfiler& operator=(const PassProfiler&) = delete;
+
+            /// \brief Returns statistics of executed transformations in the order they were
+            ///        started, so every transformation is followed by its nested ones.
+            const std::vector<PassProfile>& get_profiles() const { return m_profiles; }
+
+            /// \brief Adds visited nodes to the innermost running transformation of the active
+            ///        profiler of the calling thread. Does nothing if there is no profiler.
+            static void add_nodes_visited(size_t count);
+
+            /// \brief Adds applied rewrites to the innermost running transformation of the
+            ///        active profiler of the calling thread. Does nothing if there is no profiler.
+            static void add_rewrites(size_t count);
+
+            /// \brief Returns true if there is an active profiler on the calling thread.
+            static bool is_active();
+
+            /// \brief Adds statistics of a transformation which was measured by the caller (for
+            ///        example accumulated over all invocations of a matcher callback) as a nested
+            ///        transformation of the innermost running one. Counters of the profile are not
+            ///        added to the enclosing transformation. Does nothing if there is no profiler.
+            static void add_profile(const std::string& name,
+                                    std::chrono::microseconds time,
+                                    size_t nodes_visited,
+                                    size_t rewrites);
+
+        private:
+            friend class PassProfilingScope;
+
+            static PassProfiler*& active();
+
+            std::vector<PassProfile> m_profiles;
+            // Indices of transformations which are being executed, the innermost one is the last
+            std::vector<size_t> m_running;
+            PassProfiler* m_previous;
+        };
+
+        /// \brief Registers execution of one transformation in the active PassProfiler of the
+        ///        calling thread. Used by pass::Manager.
+        class NGRAPH_API PassProfilingScope
+        {
+        public:
+            explicit PassProfilingScope(const std::string& pass_name);
+            ~PassProfilingScope();
+
+            PassProfilingScope(const PassProfilingScope&) = delete;
+            PassProfilingScope& operator=(const PassProfilingScope&) = delete;
+
+        private:
+            PassProfiler* m_profiler;
+            std::chrono::steady_clock::time_point m_start;
+        };
+    }
+}
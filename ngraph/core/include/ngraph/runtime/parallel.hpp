@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Minimal number of elements processed by one thread in parallel_for_blocked.
+        ///        Smaller amounts of work are not worth waking up the worker threads.
+        constexpr size_t parallel_default_grain_size = 32768;
+
+        /// \brief Returns the maximal number of threads used by nGraph parallel primitives.
+        ///        Equals to the number of threads of the backend set by parallel_set_backend()
+        ///        or to the number of hardware threads, limited by the NGRAPH_NUM_THREADS
+        ///        environment variable.
+        NGRAPH_API
+        size_t parallel_get_max_threads();
+
+        /// \brief Function which executes func(ithr, nthr) for each ithr in [0, nthr) and waits
+        ///        for all of them to finish. func passed to the backend never throws.
+        using ParallelBackend =
+            std::function<void(size_t nthr, const std::function<void(size_t, size_t)>& func)>;
+
+        /// \brief Routes nGraph parallel primitives to an external threading runtime (e.g. the one
+        ///        of Inference Engine) instead of the internal thread pool, so that they don't
+        ///        oversubscribe the machine next to the threads of the runtime.
+        /// \param backend Executes parallel regions, empty function restores the internal pool.
+        /// \param max_threads Returns the number of threads available to the backend.
+        NGRAPH_API
+        void parallel_set_backend(ParallelBackend backend, std::function<size_t()> max_threads);
+
+        /// \brief Returns true if the calling thread executes a parallel region. Nested
+        ///        parallel regions are executed serially by the calling thread.
+        NGRAPH_API
+        bool parallel_in_region();
+
+        /// \brief Executes func(ithr, nthr) for each ithr in [0, nthr) using the parallel backend
+        ///        or the nGraph thread pool and waits for all of them to finish. The calling thread executes ithr = 0.
+        ///        Exceptions thrown by func are rethrown in the calling thread.
+        /// \param nthr Number of threads to use, 0 means parallel_get_max_threads().
+        /// \param func Function to execute.
+        NGRAPH_API
+        void parallel_nt(size_t nthr, const std::function<void(size_t, size_t)>& func);
+
+        /// \brief Splits n work items between team threads in the same way as Inference Engine
+        ///        splitter() does, so thread tid gets items [n_start, n_end).
+        template <typename T>
+        void splitter(const T& n, size_t team, size_t tid, T& n_start, T& n_end)
+        {
+            if (team <= 1 || n == 0)
+            {
+                n_start = 0;
+                n_end = n;
+            }
+            else
+            {
+                T n1 = (n + static_cast<T>(team) - 1) / static_cast<T>(team);
+                T n2 = n1 - 1;
+                T T1 = n - n2 * static_cast<T>(team);
+                n_end = static_cast<T>(tid) < T1 ? n1 : n2;
+                n_start = static_cast<T>(tid) <= T1
+                              ? static_cast<T>(tid) * n1
+                              : T1 * n1 + (static_cast<T>(tid) - T1) * n2;
+            }
+            n_end += n_start;
+        }
+
+        /// \brief Calls func(i) for each i in [0, work_amount) distributing the iterations
+        ///        between threads.
+        template <typename F>
+        void parallel_for(size_t work_amount, const F& func)
+        {
+            const size_t nthr = std::min(work_amount, parallel_get_max_threads());
+            if (nthr <= 1 || parallel_in_region())
+            {
+                for (size_t i = 0; i < work_amount; ++i)
+                {
+                    func(i);
+                }
+                return;
+            }
+            parallel_nt(nthr, [&](size_t ithr, size_t nthr) {
+                size_t start = 0, end = 0;
+                splitter(work_amount, nthr, ithr, start, end);
+                for (size_t i = start; i < end; ++i)
+                {
+                    func(i);
+                }
+            });
+        }
+
+        /// \brief Calls func(i0, i1) for each pair in [0, D0) x [0, D1) distributing the
+        ///        iterations between threads.
+        template <typename F>
+        void parallel_for2d(size_t D0, size_t D1, const F& func)
+        {
+            parallel_for(D0 * D1, [&](size_t i) { func(i / D1, i % D1); });
+        }
+
+        /// \brief Splits [0, work_amount) into contiguous blocks of at least grain_size items
+        ///        and calls func(start, end) for each block.
+        template <typename F>
+        void parallel_for_blocked(size_t work_amount,
+                                  const F& func,
+                                  size_t grain_size = parallel_default_grain_size)
+        {
+            const size_t nblocks = work_amount / std::max<size_t>(grain_size, 1);
+            const size_t nthr = std::min(nblocks, parallel_get_max_threads());
+            if (nthr <= 1 || parallel_in_region())
+            {
+                func(size_t(0), work_amount);
+                return;
+            }
+            parallel_nt(nthr, [&](size_t ithr, size_t nthr) {
+                size_t start = 0, end = 0;
+                splitter(work_amount, nthr, ithr, start, end);
+                if (start < end)
+                {
+                    func(start, end);
+                }
+            });
+        }
+    }
+}
@@ -21,6 +21,7 @@
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -126,10 +127,12 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for_blocked(shape_size(arg0_shape), [&](size_t start, size_t end) {
+                        for (size_t i = start; i < end; i++)
+                        {
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                        }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -203,10 +206,49 @@ namespace ngraph
                         }
 #else
 
+                        // Index of the outermost output dimension which is not 1. Slices of
+                        // the output along this dimension are broadcast independently.
+                        size_t outer = 1;
+                        while (outer < axis && output_shape[outer] == 1)
+                            ++outer;
+
                         if (axis == 0)
                         {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                                out[i] = elementwise_functor(arg0[i], arg1[i]);
+                            parallel_for_blocked(strides0[0], [&](size_t start, size_t end) {
+                                for (size_t i = start; i < end; ++i)
+                                    out[i] = elementwise_functor(arg0[i], arg1[i]);
+                            });
+                        }
+                        else if (output_shape[outer] > 1 && !parallel_in_region() &&
+                                 parallel_get_max_threads() > 1 &&
+                                 shape_size(output_shape) >= parallel_default_grain_size)
+                        {
+                            const size_t slice_rank = shape_rank - outer - 1;
+                            const Shape arg0_slice_shape(
+                                arg0_shape.end() - std::min(slice_rank, arg0_shape.size()),
+                                arg0_shape.end());
+                            const Shape arg1_slice_shape(
+                                arg1_shape.end() - std::min(slice_rank, arg1_shape.size()),
+                                arg1_shape.end());
+                            const size_t step0 =
+                                value_with_padding_or(arg0_shape, padding0, outer, 1) == 1
+                                    ? 0
+                                    : strides0[outer];
+                            const size_t step1 =
+                                value_with_padding_or(arg1_shape, padding1, outer, 1) == 1
+                                    ? 0
+                                    : strides1[outer];
+                            const size_t out_step = shape_size(output_shape) / output_shape[outer];
+
+                            parallel_for(output_shape[outer], [&](size_t i) {
+                                autobroadcast_binop(arg0 + i * step0,
+                                                    arg1 + i * step1,
+                                                    out + i * out_step,
+                                                    arg0_slice_shape,
+                                                    arg1_slice_shape,
+                                                    broadcast_spec,
+                                                    elementwise_functor);
+                            });
                         }
                         else if (strides0[axis] == 1 &&
                                  value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
@@ -18,6 +18,7 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/type/float16.hpp"
 
 namespace ngraph
@@ -30,10 +31,12 @@ namespace ngraph
             typename std::enable_if<!std::is_same<TO, char>::value>::type
                 convert(const TI* arg, TO* out, size_t count)
             {
-                for (size_t i = 0; i < count; ++i)
-                {
-                    out[i] = static_cast<TO>(arg[i]);
-                }
+                parallel_for_blocked(count, [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; ++i)
+                    {
+                        out[i] = static_cast<TO>(arg[i]);
+                    }
+                });
             }
 
             template <>
@@ -45,10 +48,12 @@ namespace ngraph
             typename std::enable_if<std::is_same<TO, char>::value>::type
                 convert(const TI* arg, TO* out, size_t count)
             {
-                for (size_t i = 0; i < count; ++i)
-                {
-                    out[i] = static_cast<char>(static_cast<bool>(arg[i]));
-                }
+                parallel_for_blocked(count, [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; ++i)
+                    {
+                        out[i] = static_cast<char>(static_cast<bool>(arg[i]));
+                    }
+                });
             }
 
         } // namespace reference
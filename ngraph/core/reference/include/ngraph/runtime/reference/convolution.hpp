@@ -24,6 +24,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
@@ -216,17 +217,18 @@ namespace ngraph
                 const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
                 const size_t filter_size = shape_size(filter_shape);
 
-                auto batch = in;
-                for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx)
-                {
-                    auto filter = f;
-                    for (size_t f_idx = 0; f_idx < filters_count; ++f_idx)
-                    {
-                        convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-                        filter += filter_size;
-                    }
-                    batch += batch_size;
-                }
+                // Output channels are computed independently of each other
+                const size_t out_channel_size = shape_size(out_shape) /
+                                                std::max<size_t>(batches_count * filters_count, 1);
+                parallel_for2d(batches_count, filters_count, [&](size_t batch_idx, size_t f_idx) {
+                    T* out_channel = out + (batch_idx * filters_count + f_idx) * out_channel_size;
+                    convolve_3D_channels(params,
+                                         in + batch_idx * batch_size,
+                                         batch_shape,
+                                         f + f_idx * filter_size,
+                                         filter_shape,
+                                         out_channel);
+                });
             }
 
             // DEPRECATED, can't be removed currently due to kmb-plugin dependency (#47799)
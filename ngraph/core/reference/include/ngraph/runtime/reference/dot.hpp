@@ -22,6 +22,7 @@
 #include <cfenv>
 #include <functional>
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -31,6 +32,77 @@ namespace ngraph
     {
         namespace reference
         {
+            namespace details
+            {
+                /// \brief Cache blocked multiplication of row-major matrices
+                ///        out[M, N] = arg0[M, K] * arg1[K, N]. Every output element accumulates
+                ///        its products in increasing K order, so results are identical to the
+                ///        generic dot implementation.
+                template <typename INPUT0, typename INPUT1, typename OUTPUT, typename ACCUMULATION>
+                void dot_2d(const INPUT0* arg0,
+                            const INPUT1* arg1,
+                            OUTPUT* out,
+                            size_t M,
+                            size_t K,
+                            size_t N)
+                {
+                    // A block of rows shares each loaded row of arg1 while the accumulators of
+                    // the block stay in L1.
+                    constexpr size_t block_m = 4;
+                    constexpr size_t block_n = 256;
+
+                    auto multiply_rows = [&](size_t row_block) {
+                        const size_t m_begin = row_block * block_m;
+                        const size_t m_count = std::min(block_m, M - m_begin);
+                        ACCUMULATION acc[block_m][block_n];
+                        for (size_t n_begin = 0; n_begin < N; n_begin += block_n)
+                        {
+                            const size_t n_count = std::min(block_n, N - n_begin);
+                            for (size_t m = 0; m < m_count; ++m)
+                            {
+                                std::fill(acc[m], acc[m] + n_count, ACCUMULATION(0));
+                            }
+                            for (size_t k = 0; k < K; ++k)
+                            {
+                                const INPUT1* arg1_row = arg1 + k * N + n_begin;
+                                for (size_t m = 0; m < m_count; ++m)
+                                {
+                                    const ACCUMULATION a =
+                                        static_cast<ACCUMULATION>(arg0[(m_begin + m) * K + k]);
+                                    ACCUMULATION* acc_row = acc[m];
+                                    for (size_t n = 0; n < n_count; ++n)
+                                    {
+                                        acc_row[n] =
+                                            acc_row[n] + a * static_cast<ACCUMULATION>(arg1_row[n]);
+                                    }
+                                }
+                            }
+                            for (size_t m = 0; m < m_count; ++m)
+                            {
+                                OUTPUT* out_row = out + (m_begin + m) * N + n_begin;
+                                for (size_t n = 0; n < n_count; ++n)
+                                {
+                                    out_row[n] = acc[m][n];
+                                }
+                            }
+                        }
+                    };
+
+                    const size_t row_blocks = (M + block_m - 1) / block_m;
+                    if (M * N * K < parallel_default_grain_size)
+                    {
+                        for (size_t row_block = 0; row_block < row_blocks; ++row_block)
+                        {
+                            multiply_rows(row_block);
+                        }
+                    }
+                    else
+                    {
+                        parallel_for(row_blocks, multiply_rows);
+                    }
+                }
+            }
+
             template <typename INPUT0,
                       typename INPUT1,
                       typename OUTPUT,
@@ -56,6 +128,22 @@ namespace ngraph
                     is_quantized = true;
                 }
 
+                if (!is_quantized)
+                {
+                    // Both arguments are row-major, so the dot product over trailing axes of
+                    // arg0 and leading axes of arg1 is a plain matrix multiplication.
+                    const size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
+                    const size_t M = shape_size(Shape(arg0_shape.begin(),
+                                                      arg0_shape.begin() + arg0_projected_rank));
+                    const size_t K = shape_size(Shape(arg0_shape.begin() + arg0_projected_rank,
+                                                      arg0_shape.end()));
+                    const size_t N = shape_size(Shape(arg1_shape.begin() + reduction_axes_count,
+                                                      arg1_shape.end()));
+                    details::dot_2d<INPUT0, INPUT1, OUTPUT, ACCUMULATION>(
+                        arg0, arg1, out, M, K, N);
+                    return;
+                }
+
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
                 // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
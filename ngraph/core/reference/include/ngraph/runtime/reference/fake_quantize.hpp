@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <cfenv>
 #include <cmath>
 #include <cstddef>
 #include <numeric>
 #include <utility>
 #include <vector>
 
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -115,8 +117,6 @@ namespace ngraph
                                const Shape& _out_high_shape,
                                size_t levels)
             {
-                auto initial_round_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
                 Shape in_low_shape(_in_low_shape);
                 Shape in_high_shape(_in_high_shape);
                 Shape out_low_shape(_out_low_shape);
@@ -183,64 +183,82 @@ namespace ngraph
                 check_trivial_broadcast(
                     out_high_shape, out_high_offsets, out_high_trivial_broadcast, out_high_aligned);
 
-                std::vector<size_t> current_dim(arg_shape.size(), 0);
+                auto quantize_range = [&](size_t start, size_t end) {
+                    // Rounding mode is a per thread setting
+                    auto initial_round_mode = std::fegetround();
+                    std::fesetround(FE_TONEAREST);
 
-                auto get_value = [&current_dim](bool is_trivial_broadcast,
-                                                bool is_aligned,
-                                                const T* data,
-                                                size_t idx,
-                                                const std::vector<size_t>& offsets) {
-                    T val;
-                    if (is_aligned)
+                    std::vector<size_t> current_dim(arg_shape.size(), 0);
+                    for (size_t i = arg_shape.size(), idx = start; i > 0; --i)
                     {
-                        val = data[idx];
+                        current_dim[i - 1] = idx % arg_shape[i - 1];
+                        idx /= arg_shape[i - 1];
                     }
-                    else if (is_trivial_broadcast)
-                    {
-                        val = data[0];
-                    }
-                    else
+
+                    auto get_value = [&current_dim](bool is_trivial_broadcast,
+                                                    bool is_aligned,
+                                                    const T* data,
+                                                    size_t idx,
+                                                    const std::vector<size_t>& offsets) {
+                        T val;
+                        if (is_aligned)
+                        {
+                            val = data[idx];
+                        }
+                        else if (is_trivial_broadcast)
+                        {
+                            val = data[0];
+                        }
+                        else
+                        {
+                            size_t index_offset = calc_full_broadcast_offset(current_dim, offsets);
+                            if (index_offset != 0)
+                            {
+                                NGRAPH_CHECK(idx >= index_offset, "Incorrect index offset value!");
+                            }
+                            val = data[idx - index_offset];
+                        }
+                        return val;
+                    };
+                    for (size_t i = start; i < end; ++i)
                     {
-                        size_t index_offset = calc_full_broadcast_offset(current_dim, offsets);
-                        if (index_offset != 0)
+                        T in_low_val = get_value(
+                            in_low_trivial_broadcast, in_low_aligned, in_low, i, in_low_offsets);
+                        T in_high_val = get_value(in_high_trivial_broadcast,
+                                                  in_high_aligned,
+                                                  in_high,
+                                                  i,
+                                                  in_high_offsets);
+                        T out_low_val = get_value(out_low_trivial_broadcast,
+                                                  out_low_aligned,
+                                                  out_low,
+                                                  i,
+                                                  out_low_offsets);
+                        T out_high_val = get_value(out_high_trivial_broadcast,
+                                                   out_high_aligned,
+                                                   out_high,
+                                                   i,
+                                                   out_high_offsets);
+                        if (arg[i] <= std::min(in_low_val, in_high_val))
                         {
-                            NGRAPH_CHECK(idx >= index_offset, "Incorrect index offset value!");
+                            out[i] = out_low_val;
                         }
-                        val = data[idx - index_offset];
+                        else if (arg[i] > std::max(in_low_val, in_high_val))
+                        {
+                            out[i] = out_high_val;
+                        }
+                        else
+                        {
+                            out[i] = nearbyint((arg[i] - in_low_val) /
+                                               (in_high_val - in_low_val) * (levels - 1)) /
+                                         (levels - 1) * (out_high_val - out_low_val) +
+                                     out_low_val;
+                        }
+                        increment_current_dim(current_dim, arg_shape, arg_shape.size() - 1);
                     }
-                    return val;
+                    std::fesetround(initial_round_mode);
                 };
-                for (size_t i = 0; i < shape_size(arg_shape); ++i)
-                {
-                    T in_low_val = get_value(
-                        in_low_trivial_broadcast, in_low_aligned, in_low, i, in_low_offsets);
-                    T in_high_val = get_value(
-                        in_high_trivial_broadcast, in_high_aligned, in_high, i, in_high_offsets);
-                    T out_low_val = get_value(
-                        out_low_trivial_broadcast, out_low_aligned, out_low, i, out_low_offsets);
-                    T out_high_val = get_value(out_high_trivial_broadcast,
-                                               out_high_aligned,
-                                               out_high,
-                                               i,
-                                               out_high_offsets);
-                    if (arg[i] <= std::min(in_low_val, in_high_val))
-                    {
-                        out[i] = out_low_val;
-                    }
-                    else if (arg[i] > std::max(in_low_val, in_high_val))
-                    {
-                        out[i] = out_high_val;
-                    }
-                    else
-                    {
-                        out[i] = nearbyint((arg[i] - in_low_val) / (in_high_val - in_low_val) *
-                                           (levels - 1)) /
-                                     (levels - 1) * (out_high_val - out_low_val) +
-                                 out_low_val;
-                    }
-                    increment_current_dim(current_dim, arg_shape, arg_shape.size() - 1);
-                }
-                std::fesetround(initial_round_mode);
+                parallel_for_blocked(shape_size(arg_shape), quantize_range);
             }
         }
     }
@@ -20,6 +20,7 @@
 
 #include "ngraph/coordinate_range.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
 #include "utils/span.hpp"
 
@@ -52,8 +53,6 @@ namespace ngraph
                     std::copy(begin(c3), end(c3), std::back_inserter(ret));
                     return ret;
                 }
-
-                const auto only_one = [] { return coordinates::index(Shape{1}); };
             } // namespace
             template <typename T, typename U>
             void gather(const T* const params,
@@ -85,50 +84,39 @@ namespace ngraph
 
                 const auto copy_size = shape_size(remainder_part_shape);
 
-                const size_t copy_round_in_batch =
-                    indices_shape.size() > 1
-                        ? shape_size(span(indices_shape.data(), indices_shape.size() - 1))
-                        : 1;
-                const size_t round_batch_offset = indices_shape.empty() ? 1 : indices_shape.back();
+                const size_t indices_count = shape_size(indices_shape);
+                const size_t outer_count = shape_size(to_shape(params_axes_part));
+
+                assert(!batch_shape.empty());
+                auto copy_slice = [&](size_t outer, size_t ii) {
+                    const auto batch_offset = outer * batch_size;
+                    assert(batch_offset < shape_size(params_shape));
+                    const auto positive_input_index = indices[ii] < 0
+                                                          ? batch_shape.front() + indices[ii]
+                                                          : indices[ii];
+
+                    const auto src_offset = batch_offset + copy_size * positive_input_index;
 
-                auto dst = out;
+                    const auto src_begin = next(params, src_offset);
+                    const auto src_end = next(src_begin, copy_size);
 
-                auto gather_range = params_axes_part.empty()
-                                        ? only_one()
-                                        : coordinates::index(to_shape(params_axes_part));
-                for (auto i : gather_range)
+                    std::copy(src_begin, src_end, out + (outer * indices_count + ii) * copy_size);
+                };
+
+                if (shape_size(out_shape) < parallel_default_grain_size)
                 {
-                    auto batch_index = i.begin_index;
-                    for (size_t batch = 0; batch != i.element_number;
-                         batch_index += i.step, ++batch)
+                    for (size_t outer = 0; outer < outer_count; ++outer)
                     {
-                        const auto batch_offset = batch_index * batch_size;
-                        assert(batch_offset < shape_size(params_shape));
-                        for (size_t round = 0; round != copy_round_in_batch; ++round)
+                        for (size_t ii = 0; ii < indices_count; ++ii)
                         {
-                            const U* input_indices = indices + round * round_batch_offset;
-                            const auto indices_no =
-                                indices_shape.empty() ? 1 : indices_shape.back();
-
-                            assert(!batch_shape.empty());
-                            for (size_t ii = 0; ii != indices_no; ++ii)
-                            {
-                                const auto positive_input_index =
-                                    input_indices[ii] < 0 ? batch_shape.front() + input_indices[ii]
-                                                          : input_indices[ii];
-
-                                const auto src_offset =
-                                    batch_offset + copy_size * positive_input_index;
-
-                                const auto src_begin = next(params, src_offset);
-                                const auto src_end = next(src_begin, copy_size);
-
-                                std::copy(src_begin, src_end, dst);
-                                dst += copy_size;
-                            }
+                            copy_slice(outer, ii);
                         }
                     }
                 }
+                else
+                {
+                    parallel_for2d(outer_count, indices_count, copy_slice);
+                }
             }
         } // namespace reference
     }     // namespace runtime
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
 #include "ngraph/util.hpp"
 
@@ -56,7 +57,7 @@ namespace ngraph
 
                 const size_t group_count = filter_shape[filter_group_axis];
 
-                const INPUT* group_batch = in;
+                const INPUT* const group_batch = in;
                 const Shape group_batch_shape = [&]() {
                     Shape new_shape{in_shape};
                     new_shape[in_batch_axis] = 1;
@@ -65,14 +66,14 @@ namespace ngraph
                 }();
                 const size_t group_batch_size = shape_size(group_batch_shape);
 
-                const FILTER* group_filter = f;
+                const FILTER* const group_filter = f;
                 const Shape group_filter_shape = [&]() {
                     Shape new_shape{++filter_shape.begin(), filter_shape.end()};
                     return new_shape;
                 }();
                 const size_t group_filter_size = shape_size(group_filter_shape);
 
-                OUTPUT* group_out = out;
+                OUTPUT* const group_out = out;
                 const Shape group_out_shape = [&]() {
                     Shape new_shape{out_shape};
                     new_shape[out_batch_axis] = 1;
@@ -86,27 +87,24 @@ namespace ngraph
                 // based)
                 Strides in_dilation(in_shape.size());
                 std::fill(in_dilation.begin(), in_dilation.end(), 1);
-                for (size_t batch_idx = 0; batch_idx < in_shape[in_batch_axis]; ++batch_idx)
-                {
-                    group_filter = f;
-                    for (size_t group_idx = 0; group_idx < group_count; ++group_idx)
-                    {
-                        runtime::reference::convolution(group_batch,
-                                                        group_filter,
-                                                        group_out,
-                                                        group_batch_shape,
-                                                        group_filter_shape,
-                                                        group_out_shape,
-                                                        strides,
-                                                        dilation,
-                                                        pads_begin,
-                                                        pads_end,
-                                                        in_dilation);
-                        group_batch += group_batch_size;
-                        group_filter += group_filter_size;
-                        group_out += group_out_size;
-                    }
-                }
+                // Groups are independent convolutions, the convolution of one group is computed
+                // by a single thread
+                parallel_for2d(
+                    in_shape[in_batch_axis], group_count, [&](size_t batch_idx, size_t group_idx) {
+                        const size_t group_offset = batch_idx * group_count + group_idx;
+                        runtime::reference::convolution(
+                            group_batch + group_offset * group_batch_size,
+                            group_filter + group_idx * group_filter_size,
+                            group_out + group_offset * group_out_size,
+                            group_batch_shape,
+                            group_filter_shape,
+                            group_out_shape,
+                            strides,
+                            dilation,
+                            pads_begin,
+                            pads_end,
+                            in_dilation);
+                    });
             }
         } // namespace reference
     }     // namespace runtime
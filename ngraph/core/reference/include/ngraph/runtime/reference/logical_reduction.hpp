@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -33,23 +34,13 @@ namespace ngraph
                                                   const AxisSet& reduction_axes,
                                                   bool keep_dims)
             {
-                CoordinateTransform output_transform(
-                    reduce(input_shape, reduction_axes, keep_dims));
+                const auto out_shape = reduce(input_shape, reduction_axes, keep_dims);
+                std::fill(out, out + shape_size(out_shape), 1);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(input_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] &&
-                        arg[input_transform.index(input_coord)];
-                }
+                strided::reduction_loop(input_shape, reduction_axes)
+                    .for_each([&](std::ptrdiff_t in_index, std::ptrdiff_t out_index) {
+                        out[out_index] = out[out_index] && arg[in_index];
+                    });
             }
 
             static inline void reduce_logical_or(const char* arg,
@@ -58,23 +49,13 @@ namespace ngraph
                                                  const AxisSet& reduction_axes,
                                                  bool keep_dims)
             {
-                CoordinateTransform output_transform(
-                    reduce(input_shape, reduction_axes, keep_dims));
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(input_shape);
+                const auto out_shape = reduce(input_shape, reduction_axes, keep_dims);
+                std::fill(out, out + shape_size(out_shape), 0);
 
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] ||
-                        arg[input_transform.index(input_coord)];
-                }
+                strided::reduction_loop(input_shape, reduction_axes)
+                    .for_each([&](std::ptrdiff_t in_index, std::ptrdiff_t out_index) {
+                        out[out_index] = out[out_index] || arg[in_index];
+                    });
             }
         }
     }
@@ -24,6 +24,7 @@
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/builder/autobroadcast.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/shape_util.hpp"
@@ -263,8 +264,7 @@ namespace ngraph
                 const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
                 const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
                 const size_t output_offset = shape_size(dot_output_shape);
-                for (size_t i = 0; i < output_batch_size; i++)
-                {
+                auto batch_dot = [&](size_t i) {
                     dot(arg0_update + i * arg0_offset,
                         arg1_update + i * arg1_offset,
                         out + i * output_offset,
@@ -272,6 +272,18 @@ namespace ngraph
                         dot_arg1_shape,
                         dot_output_shape,
                         1);
+                };
+                // Few big batches are better parallelized inside of dot
+                if (output_batch_size < parallel_get_max_threads())
+                {
+                    for (size_t i = 0; i < output_batch_size; i++)
+                    {
+                        batch_dot(i);
+                    }
+                }
+                else
+                {
+                    parallel_for(output_batch_size, batch_dot);
                 }
             }
         }
@@ -20,6 +20,7 @@
 #include <limits>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -40,26 +41,17 @@ namespace ngraph
                                : std::numeric_limits<T>::min();
 
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T max = out[output_transform.index(output_coord)];
-                    if (x > max)
-                    {
-                        out[output_transform.index(output_coord)] = x;
-                    }
-                }
+                std::fill(out, out + shape_size(out_shape), minval);
+
+                strided::reduction_loop(in_shape, reduction_axes)
+                    .for_each([&](std::ptrdiff_t in_index, std::ptrdiff_t out_index) {
+                        T x = arg[in_index];
+                        T max = out[out_index];
+                        if (x > max)
+                        {
+                            out[out_index] = x;
+                        }
+                    });
             }
         }
     }
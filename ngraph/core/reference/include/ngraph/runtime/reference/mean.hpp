@@ -17,7 +17,6 @@
 #pragma once
 
 #include <cmath>
-#include <map>
 #include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
@@ -40,52 +39,36 @@ namespace ngraph
                       bool keep_dims)
             {
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
+                std::vector<T> cs(shape_size(out_shape), T(0));
+                std::fill(out, out + shape_size(out_shape), T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
+                details::reduce_for_each(
+                    in_shape, reduction_axes, [&](size_t out_index, size_t arg_index) {
+                        T x = arg[arg_index];
+                        T& z = out[out_index];
 
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
+                        if (is_finite(x) && is_finite(z))
+                        {
+                            T& c = cs[out_index];
+                            T t = z + (x - c);
+                            c = (t - z) - (x - c);
+                            z = t;
+                        }
+                        else
+                        {
+                            z = z + x;
+                        }
+                    });
 
-                for (const Coordinate& input_coord : input_transform)
+                // Every output element is reduced from the same number of input elements
+                int count = 1;
+                for (const auto axis : reduction_axes)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
+                    count *= static_cast<int>(in_shape[axis]);
                 }
-
-                for (const Coordinate& output_coord : output_transform)
+                for (size_t i = 0; i < shape_size(out_shape); ++i)
                 {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
+                    out[i] = out[i] / count;
                 }
             }
         }
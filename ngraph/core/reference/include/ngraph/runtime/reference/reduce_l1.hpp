@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -35,24 +36,12 @@ namespace ngraph
                            bool keep_dims)
             {
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    size_t output_index = output_transform.index(output_coord);
-
-                    out[output_index] =
-                        out[output_index] + std::abs(arg[input_transform.index(input_coord)]);
-                }
+                strided::reduction_loop(in_shape, reduction_axes)
+                    .for_each([&](std::ptrdiff_t in_index, std::ptrdiff_t out_index) {
+                        out[out_index] = out[out_index] + std::abs(arg[in_index]);
+                    });
             }
         }
     }
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -35,29 +36,16 @@ namespace ngraph
                            bool keep_dims)
             {
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    size_t output_index = output_transform.index(output_coord);
-
-                    out[output_index] = out[output_index] +
-                                        arg[input_transform.index(input_coord)] *
-                                            arg[input_transform.index(input_coord)];
-                }
-                for (const Coordinate& output_coord : output_transform)
+                const size_t out_size = shape_size(out_shape);
+                std::fill(out, out + out_size, T(0));
+
+                strided::reduction_loop(in_shape, reduction_axes)
+                    .for_each([&](std::ptrdiff_t in_index, std::ptrdiff_t out_index) {
+                        out[out_index] = out[out_index] + arg[in_index] * arg[in_index];
+                    });
+                for (size_t i = 0; i < out_size; ++i)
                 {
-                    out[output_transform.index(output_coord)] =
-                        sqrt(out[output_transform.index(output_coord)]);
+                    out[i] = sqrt(out[i]);
                 }
             }
         }
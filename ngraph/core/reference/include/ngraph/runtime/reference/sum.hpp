@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -52,45 +53,102 @@ namespace ngraph
                 return true;
             }
 
-            template <typename T>
-            void sum(const T* arg,
-                     T* out,
-                     const Shape& in_shape,
-                     const AxisSet& reduction_axes,
-                     bool keep_dims)
+            namespace details
             {
-                auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
+                /// \brief Calls func(out_index, arg_index) for every element of the input tensor.
+                ///        Output elements are distributed between threads, input elements reduced
+                ///        into one output element are visited in row-major order by one thread.
+                template <typename F>
+                void reduce_for_each(const Shape& in_shape,
+                                     const AxisSet& reduction_axes,
+                                     const F& func)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
+                    const auto in_strides = row_major_strides(in_shape);
+                    Shape outer_shape, inner_shape;
+                    std::vector<size_t> outer_strides, inner_strides;
+                    for (size_t i = 0; i < in_shape.size(); ++i)
+                    {
+                        if (reduction_axes.count(i))
+                        {
+                            inner_shape.push_back(in_shape[i]);
+                            inner_strides.push_back(in_strides[i]);
+                        }
+                        else
+                        {
+                            outer_shape.push_back(in_shape[i]);
+                            outer_strides.push_back(in_strides[i]);
+                        }
+                    }
+                    const size_t inner_count = shape_size(inner_shape);
 
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
+                    auto reduce_output = [&](size_t out_index) {
+                        size_t arg_index = 0;
+                        for (size_t i = outer_shape.size(), idx = out_index; i > 0; --i)
+                        {
+                            arg_index += (idx % outer_shape[i - 1]) * outer_strides[i - 1];
+                            idx /= outer_shape[i - 1];
+                        }
+                        std::vector<size_t> inner_coord(inner_shape.size(), 0);
+                        for (size_t r = 0; r < inner_count; ++r)
+                        {
+                            func(out_index, arg_index);
+                            for (size_t i = inner_shape.size(); i > 0; --i)
+                            {
+                                arg_index += inner_strides[i - 1];
+                                if (++inner_coord[i - 1] < inner_shape[i - 1])
+                                {
+                                    break;
+                                }
+                                arg_index -= inner_strides[i - 1] * inner_shape[i - 1];
+                                inner_coord[i - 1] = 0;
+                            }
+                        }
+                    };
 
-                    if (is_finite(x) && is_finite(z))
+                    const size_t outer_count = shape_size(outer_shape);
+                    if (shape_size(in_shape) < parallel_default_grain_size)
                     {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
+                        for (size_t out_index = 0; out_index < outer_count; ++out_index)
+                        {
+                            reduce_output(out_index);
+                        }
                     }
                     else
                     {
-                        z = z + x;
+                        parallel_for(outer_count, reduce_output);
                     }
                 }
             }
+
+            template <typename T>
+            void sum(const T* arg,
+                     T* out,
+                     const Shape& in_shape,
+                     const AxisSet& reduction_axes,
+                     bool keep_dims)
+            {
+                auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
+                std::vector<T> cs(shape_size(out_shape), T(0));
+                std::fill(out, out + shape_size(out_shape), T(0));
+
+                details::reduce_for_each(
+                    in_shape, reduction_axes, [&](size_t out_index, size_t arg_index) {
+                        T x = arg[arg_index];
+                        T& z = out[out_index];
+
+                        if (is_finite(x) && is_finite(z))
+                        {
+                            T& c = cs[out_index];
+                            T t = z + (x - c);
+                            c = (t - z) - (x - c);
+                            z = t;
+                        }
+                        else
+                        {
+                            z = z + x;
+                        }
+                    });
+            }
         }
     }
 }
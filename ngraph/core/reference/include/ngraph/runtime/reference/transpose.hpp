@@ -24,6 +24,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -43,20 +44,18 @@ namespace ngraph
                     std::reverse(range_vector.begin(), range_vector.end());
                     axes_order = range_vector.data();
                 }
-                size_t cnt = 0;
+                AxisVector axis_order(axes_order, axes_order + arg_size.size());
+                Shape out_shape(arg_size.size());
                 for (size_t i = 0; i < arg_size.size(); ++i)
                 {
-                    size_t axes = axes_order[i];
-                    size_t start = 0;
-                    for (size_t j = 0; j < axes; ++j)
-                    {
-                        start += shape_size(arg_size[j]);
-                    }
-                    for (size_t j = start; j < start + shape_size(arg_size[axes]); ++j)
-                    {
-                        out[cnt++] = arg[j];
-                    }
+                    out_shape[i] = arg_size[axis_order[i]];
                 }
+                reshape(reinterpret_cast<const char*>(arg),
+                        reinterpret_cast<char*>(out),
+                        arg_size,
+                        axis_order,
+                        out_shape,
+                        sizeof(T));
             }
         }
     }
@@ -0,0 +1,371 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace strided
+            {
+                /// \brief Distance between neighbouring elements along each axis, in elements.
+                ///        Strides may be zero (broadcast, reduction) or negative (reverse).
+                using StrideVector = std::vector<std::ptrdiff_t>;
+
+                /// \brief Returns strides of a dense row-major tensor of the given shape.
+                inline StrideVector dense_strides(const Shape& shape)
+                {
+                    StrideVector strides(shape.size());
+                    std::ptrdiff_t stride = 1;
+                    for (size_t i = shape.size(); i > 0; --i)
+                    {
+                        strides[i - 1] = stride;
+                        stride *= static_cast<std::ptrdiff_t>(shape[i - 1]);
+                    }
+                    return strides;
+                }
+
+                namespace details
+                {
+                    template <size_t Rank>
+                    struct RowLoop
+                    {
+                        template <typename F>
+                        static void run(const size_t* size,
+                                        const std::ptrdiff_t* src_stride,
+                                        const std::ptrdiff_t* dst_stride,
+                                        std::ptrdiff_t src,
+                                        std::ptrdiff_t dst,
+                                        F& func)
+                        {
+                            for (size_t i = 0; i < size[0];
+                                 ++i, src += src_stride[0], dst += dst_stride[0])
+                            {
+                                RowLoop<Rank - 1>::run(
+                                    size + 1, src_stride + 1, dst_stride + 1, src, dst, func);
+                            }
+                        }
+                    };
+
+                    template <>
+                    struct RowLoop<0>
+                    {
+                        template <typename F>
+                        static void run(const size_t*,
+                                        const std::ptrdiff_t*,
+                                        const std::ptrdiff_t*,
+                                        std::ptrdiff_t src,
+                                        std::ptrdiff_t dst,
+                                        F& func)
+                        {
+                            func(src, dst);
+                        }
+                    };
+                }
+
+                /// \brief Iteration over an index space shared by a source and a destination
+                ///        tensor. Every point of the space is addressed in both tensors by an
+                ///        offset and per-axis strides, so copies, broadcasts, slices, transposes
+                ///        and reductions are all expressed as flat strided loops instead of
+                ///        per-element coordinate translation.
+                ///
+                ///        Points are always visited in row-major order of the index space.
+                ///        Unit axes and axes which are contiguous in both tensors are merged
+                ///        on construction, the remaining loop nest is unrolled at compile time
+                ///        for ranks 1 to 6.
+                class StridedLoop
+                {
+                public:
+                    StridedLoop(const Shape& shape,
+                                const StrideVector& src_strides,
+                                std::ptrdiff_t src_offset,
+                                const StrideVector& dst_strides,
+                                std::ptrdiff_t dst_offset)
+                        : m_src_offset(src_offset)
+                        , m_dst_offset(dst_offset)
+                    {
+                        for (size_t i = 0; i < shape.size(); ++i)
+                        {
+                            if (shape[i] == 0)
+                            {
+                                m_empty = true;
+                            }
+                            if (shape[i] == 1)
+                            {
+                                continue;
+                            }
+                            if (!m_size.empty() &&
+                                m_src_strides.back() ==
+                                    src_strides[i] * static_cast<std::ptrdiff_t>(shape[i]) &&
+                                m_dst_strides.back() ==
+                                    dst_strides[i] * static_cast<std::ptrdiff_t>(shape[i]))
+                            {
+                                m_size.back() *= shape[i];
+                                m_src_strides.back() = src_strides[i];
+                                m_dst_strides.back() = dst_strides[i];
+                            }
+                            else
+                            {
+                                m_size.push_back(shape[i]);
+                                m_src_strides.push_back(src_strides[i]);
+                                m_dst_strides.push_back(dst_strides[i]);
+                            }
+                        }
+                    }
+
+                    /// \brief Number of points in the index space.
+                    size_t count() const { return m_empty ? 0 : shape_size(m_size); }
+                    /// \brief Rank of the index space after merging of axes.
+                    size_t rank() const { return m_size.size(); }
+                    /// \brief Number of points in one innermost row.
+                    size_t row_size() const { return m_size.empty() ? 1 : m_size.back(); }
+                    std::ptrdiff_t src_row_stride() const
+                    {
+                        return m_src_strides.empty() ? 1 : m_src_strides.back();
+                    }
+                    std::ptrdiff_t dst_row_stride() const
+                    {
+                        return m_dst_strides.empty() ? 1 : m_dst_strides.back();
+                    }
+
+                    /// \brief Calls func(src_index, dst_index) for the first point of every
+                    ///        innermost row. The row has row_size() points and continues with
+                    ///        src_row_stride() and dst_row_stride() steps.
+                    template <typename F>
+                    void for_each_row(F&& func) const
+                    {
+                        if (m_empty)
+                        {
+                            return;
+                        }
+                        const size_t outer_rank = m_size.empty() ? 0 : m_size.size() - 1;
+                        const size_t* size = m_size.data();
+                        const std::ptrdiff_t* src = m_src_strides.data();
+                        const std::ptrdiff_t* dst = m_dst_strides.data();
+                        switch (outer_rank)
+                        {
+                        case 0:
+                            details::RowLoop<0>::run(
+                                size, src, dst, m_src_offset, m_dst_offset, func);
+                            break;
+                        case 1:
+                            details::RowLoop<1>::run(
+                                size, src, dst, m_src_offset, m_dst_offset, func);
+                            break;
+                        case 2:
+                            details::RowLoop<2>::run(
+                                size, src, dst, m_src_offset, m_dst_offset, func);
+                            break;
+                        case 3:
+                            details::RowLoop<3>::run(
+                                size, src, dst, m_src_offset, m_dst_offset, func);
+                            break;
+                        case 4:
+                            details::RowLoop<4>::run(
+                                size, src, dst, m_src_offset, m_dst_offset, func);
+                            break;
+                        case 5:
+                            details::RowLoop<5>::run(
+                                size, src, dst, m_src_offset, m_dst_offset, func);
+                            break;
+                        default: for_each_row_generic(outer_rank, func); break;
+                        }
+                    }
+
+                    /// \brief Calls func(src_index, dst_index) for every point of the index
+                    ///        space in row-major order.
+                    template <typename F>
+                    void for_each(F&& func) const
+                    {
+                        const size_t row = row_size();
+                        const std::ptrdiff_t src_step = src_row_stride();
+                        const std::ptrdiff_t dst_step = dst_row_stride();
+                        for_each_row([&](std::ptrdiff_t src, std::ptrdiff_t dst) {
+                            for (size_t i = 0; i < row; ++i, src += src_step, dst += dst_step)
+                            {
+                                func(src, dst);
+                            }
+                        });
+                    }
+
+                    /// \brief Returns the part of the index space whose outermost coordinate
+                    ///        lies in [begin, end). Parts of one loop may be run concurrently
+                    ///        if they write to disjoint destination elements.
+                    StridedLoop outer_part(size_t begin, size_t end) const
+                    {
+                        StridedLoop part(*this);
+                        if (!m_size.empty())
+                        {
+                            part.m_size[0] = end - begin;
+                            part.m_src_offset +=
+                                static_cast<std::ptrdiff_t>(begin) * m_src_strides[0];
+                            part.m_dst_offset +=
+                                static_cast<std::ptrdiff_t>(begin) * m_dst_strides[0];
+                        }
+                        return part;
+                    }
+
+                    /// \brief Extent of the outermost axis of the index space.
+                    size_t outer_size() const { return m_size.empty() ? 1 : m_size[0]; }
+
+                private:
+                    template <typename F>
+                    void for_each_row_generic(size_t outer_rank, F& func) const
+                    {
+                        std::vector<size_t> coord(outer_rank, 0);
+                        std::ptrdiff_t src = m_src_offset;
+                        std::ptrdiff_t dst = m_dst_offset;
+                        while (true)
+                        {
+                            func(src, dst);
+                            size_t axis = outer_rank;
+                            for (; axis > 0; --axis)
+                            {
+                                src += m_src_strides[axis - 1];
+                                dst += m_dst_strides[axis - 1];
+                                if (++coord[axis - 1] < m_size[axis - 1])
+                                {
+                                    break;
+                                }
+                                src -= m_src_strides[axis - 1] *
+                                       static_cast<std::ptrdiff_t>(m_size[axis - 1]);
+                                dst -= m_dst_strides[axis - 1] *
+                                       static_cast<std::ptrdiff_t>(m_size[axis - 1]);
+                                coord[axis - 1] = 0;
+                            }
+                            if (axis == 0)
+                            {
+                                return;
+                            }
+                        }
+                    }
+
+                    Shape m_size;
+                    StrideVector m_src_strides;
+                    StrideVector m_dst_strides;
+                    std::ptrdiff_t m_src_offset;
+                    std::ptrdiff_t m_dst_offset;
+                    bool m_empty = false;
+                };
+
+                namespace details
+                {
+                    template <typename T>
+                    void copy_rows(const char* src, char* dst, const StridedLoop& loop)
+                    {
+                        const size_t row = loop.row_size();
+                        const std::ptrdiff_t src_step = loop.src_row_stride();
+                        const std::ptrdiff_t dst_step = loop.dst_row_stride();
+                        const T* in = reinterpret_cast<const T*>(src);
+                        T* out = reinterpret_cast<T*>(dst);
+                        if (src_step == 1 && dst_step == 1)
+                        {
+                            loop.for_each_row([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                                std::memcpy(out + d, in + s, row * sizeof(T));
+                            });
+                        }
+                        else
+                        {
+                            loop.for_each_row([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                                for (size_t i = 0; i < row; ++i, s += src_step, d += dst_step)
+                                {
+                                    out[d] = in[s];
+                                }
+                            });
+                        }
+                    }
+
+                    inline void copy_rows(const char* src,
+                                          char* dst,
+                                          size_t elem_size,
+                                          const StridedLoop& loop)
+                    {
+                        switch (elem_size)
+                        {
+                        case 1: copy_rows<int8_t>(src, dst, loop); break;
+                        case 2: copy_rows<int16_t>(src, dst, loop); break;
+                        case 4: copy_rows<int32_t>(src, dst, loop); break;
+                        case 8: copy_rows<int64_t>(src, dst, loop); break;
+                        default:
+                        {
+                            const size_t row = loop.row_size();
+                            const std::ptrdiff_t src_step = loop.src_row_stride();
+                            const std::ptrdiff_t dst_step = loop.dst_row_stride();
+                            loop.for_each_row([&](std::ptrdiff_t s, std::ptrdiff_t d) {
+                                for (size_t i = 0; i < row; ++i, s += src_step, d += dst_step)
+                                {
+                                    std::memcpy(
+                                        dst + d * elem_size, src + s * elem_size, elem_size);
+                                }
+                            });
+                        }
+                        }
+                    }
+                }
+
+                /// \brief Copies elements of elem_size bytes from src to dst for every point of
+                ///        the loop. Destination points must not repeat. Large copies are split
+                ///        between threads along the outermost axis.
+                inline void
+                    copy(const char* src, char* dst, size_t elem_size, const StridedLoop& loop)
+                {
+                    if (loop.count() < parallel_default_grain_size || loop.outer_size() == 1)
+                    {
+                        details::copy_rows(src, dst, elem_size, loop);
+                        return;
+                    }
+                    parallel_for_blocked(
+                        loop.outer_size(),
+                        [&](size_t begin, size_t end) {
+                            details::copy_rows(src, dst, elem_size, loop.outer_part(begin, end));
+                        },
+                        1);
+                }
+
+                /// \brief Builds the loop of a reduction: the index space is the input tensor,
+                ///        the source is the dense input and the destination is the dense output
+                ///        with zero strides along the reduction axes.
+                inline StridedLoop reduction_loop(const Shape& in_shape,
+                                                  const AxisSet& reduction_axes)
+                {
+                    StrideVector out_strides(in_shape.size(), 0);
+                    std::ptrdiff_t stride = 1;
+                    for (size_t i = in_shape.size(); i > 0; --i)
+                    {
+                        if (reduction_axes.count(i - 1) == 0)
+                        {
+                            out_strides[i - 1] = stride;
+                            stride *= static_cast<std::ptrdiff_t>(in_shape[i - 1]);
+                        }
+                    }
+                    return StridedLoop(in_shape, dense_strides(in_shape), 0, out_strides, 0);
+                }
+            }
+        }
+    }
+}
@@ -15,7 +15,8 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/reference/broadcast.hpp"
-#include "ngraph/runtime/reference/tile.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -42,13 +43,44 @@ namespace ngraph
                 Shape adjusted_out_shape = out_shape;
                 adjusted_out_shape.insert(
                     adjusted_out_shape.begin(), output_rank - adjusted_out_shape.size(), 1);
-                std::vector<int64_t> repeats(output_rank);
-                for (size_t i = 0; i < repeats.size(); ++i)
+
+                adjusted_in_shape.insert(
+                    adjusted_in_shape.begin(), output_rank - adjusted_in_shape.size(), 1);
+
+                // Broadcast axes are read with zero stride, so every output element is copied
+                // directly from its source. An axis which is a multiple of the input one is
+                // split into a zero stride repeat axis and a copy of the input axis.
+                const auto in_strides = strided::dense_strides(adjusted_in_shape);
+                Shape loop_shape;
+                strided::StrideVector loop_in_strides;
+                for (size_t i = 0; i < output_rank; ++i)
                 {
-                    repeats[i] = adjusted_out_shape[i] / adjusted_in_shape[i];
+                    const size_t in_dim = adjusted_in_shape[i];
+                    const size_t out_dim = adjusted_out_shape[i];
+                    if (in_dim != out_dim)
+                    {
+                        NGRAPH_CHECK(in_dim != 0 && out_dim % in_dim == 0,
+                                     "Input shape ",
+                                     in_shape,
+                                     " can not be broadcast to ",
+                                     out_shape);
+                        loop_shape.push_back(out_dim / in_dim);
+                        loop_in_strides.push_back(0);
+                    }
+                    if (in_dim != 1 || in_dim == out_dim)
+                    {
+                        loop_shape.push_back(in_dim);
+                        loop_in_strides.push_back(in_strides[i]);
+                    }
                 }
-
-                return tile(arg, out, adjusted_in_shape, adjusted_out_shape, elem_size, repeats);
+                strided::copy(arg,
+                              out,
+                              elem_size,
+                              strided::StridedLoop(loop_shape,
+                                                   loop_in_strides,
+                                                   0,
+                                                   strided::dense_strides(loop_shape),
+                                                   0));
             }
         }
     }
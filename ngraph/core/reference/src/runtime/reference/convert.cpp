@@ -164,18 +164,20 @@ namespace ngraph
             {
                 auto converter = jit_convert_array::get<uint8_t, float16>();
 
-                if (converter)
-                {
-                    jit_convert_array::args_t args = {arg, out, count};
-                    converter(&args);
-                }
-                else
-                {
-                    for (size_t i = 0; i < count; ++i)
+                parallel_for_blocked(count, [&](size_t start, size_t end) {
+                    if (converter)
                     {
-                        out[i] = static_cast<float16>(arg[i]);
+                        jit_convert_array::args_t args = {arg + start, out + start, end - start};
+                        converter(&args);
                     }
-                }
+                    else
+                    {
+                        for (size_t i = start; i < end; ++i)
+                        {
+                            out[i] = static_cast<float16>(arg[i]);
+                        }
+                    }
+                });
             }
 
             template <>
@@ -183,18 +185,20 @@ namespace ngraph
             {
                 auto converter = jit_convert_array::get<float16, float>();
 
-                if (converter)
-                {
-                    jit_convert_array::args_t args = {arg, out, count};
-                    converter(&args);
-                }
-                else
-                {
-                    for (size_t i = 0; i < count; ++i)
+                parallel_for_blocked(count, [&](size_t start, size_t end) {
+                    if (converter)
                     {
-                        out[i] = static_cast<float>(arg[i]);
+                        jit_convert_array::args_t args = {arg + start, out + start, end - start};
+                        converter(&args);
                     }
-                }
+                    else
+                    {
+                        for (size_t i = start; i < end; ++i)
+                        {
+                            out[i] = static_cast<float>(arg[i]);
+                        }
+                    }
+                });
             }
         }
     }
@@ -16,95 +16,40 @@
 
 #include "ngraph/runtime/reference/pad.hpp"
 
+#include <cstring>
+
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
+
 namespace ngraph
 {
     namespace runtime
     {
         namespace reference
         {
-            void pad(const char* data,
-                     const char* pad_value,
-                     char* out,
-                     const size_t elem_size,
-                     const Shape& data_shape,
-                     const Shape& out_shape,
-                     const CoordinateDiff& padding_below,
-                     const CoordinateDiff& padding_above,
-                     const op::PadMode pad_mode)
+            namespace
             {
-                Coordinate input_start(data_shape.size(), 0); // start at (0,0,...,0)
-                Coordinate input_end = out_shape; // end at (d'0,d'1,...,d'n), the outer corner of
-                                                  // the post-padding shape
-
-                Strides input_strides(data_shape.size(), 1);
-
-                AxisVector input_axis_order(data_shape.size());
-                for (size_t i = 0; i < data_shape.size(); i++)
-                {
-                    input_axis_order[i] = i;
-                }
-
-                CoordinateTransform input_transform(data_shape,
-                                                    input_start,
-                                                    input_end,
-                                                    input_strides,
-                                                    input_axis_order,
-                                                    padding_below,
-                                                    padding_above);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                // depending on the data tensor element type, allocate enough bytes to fit a
-                // single value of this type
-                std::vector<char> v(elem_size, 0);
-
-                for (const Coordinate& in_coord : input_transform)
+                /// \brief Returns the coordinate of the data element which is written to the
+                ///        out_coord position of the padded axis.
+                ptrdiff_t source_coordinate(size_t out_coord,
+                                            ptrdiff_t padding_below,
+                                            ptrdiff_t data_dim,
+                                            op::PadMode pad_mode)
                 {
-                    if (output_it == output_transform.end())
-                        break;
-                    const Coordinate& out_coord = *output_it;
-
-                    std::fill(v.begin(), v.end(), 0);
-
+                    ptrdiff_t c = static_cast<ptrdiff_t>(out_coord);
                     switch (pad_mode)
                     {
-                    case op::PadMode::CONSTANT:
-                        // If the coordinate is out of bounds, substitute *pad_value.
-                        if (input_transform.has_source_coordinate(in_coord))
-                        {
-                            const auto* offset = data + input_transform.index(in_coord) * elem_size;
-                            std::copy(offset, offset + elem_size, v.begin());
-                        }
-                        else
-                        {
-                            std::copy(pad_value, pad_value + elem_size, v.begin());
-                        }
-                        break;
+                    case op::PadMode::CONSTANT: break;
                     case op::PadMode::EDGE:
                     {
-                        Coordinate c = in_coord; // have to copy because in_coord is const
-
-                        // Truncate each out-of-bound dimension.
-                        for (size_t i = 0; i < c.size(); i++)
+                        // Truncate out-of-bound coordinates.
+                        if (c < padding_below)
                         {
-                            if (static_cast<ptrdiff_t>(c[i]) < padding_below[i])
-                            {
-                                c[i] = padding_below[i];
-                            }
-
-                            if (static_cast<ptrdiff_t>(c[i]) >=
-                                (padding_below[i] + static_cast<ptrdiff_t>(data_shape[i])))
-                            {
-                                c[i] = static_cast<size_t>(
-                                    padding_below[i] + static_cast<ptrdiff_t>(data_shape[i]) - 1);
-                            }
+                            c = padding_below;
+                        }
+                        if (c >= padding_below + data_dim)
+                        {
+                            c = padding_below + data_dim - 1;
                         }
-                        const auto* offset = data + input_transform.index(c) * elem_size;
-                        std::copy(offset, offset + elem_size, v.begin());
                         break;
                     }
                     case op::PadMode::REFLECT:
@@ -135,77 +80,171 @@ namespace ngraph
                         // Note that this algorithm works because REFLECT padding only makes sense
                         // if each dim is >= 2.
                         // clang-format on
-                        Coordinate c = in_coord; // have to copy because in_coord is const
-
-                        for (size_t i = 0; i < c.size(); i++)
+                        bool done_reflecting = false;
+                        while (!done_reflecting)
                         {
-                            ptrdiff_t new_dim = c[i];
-                            bool done_reflecting = false;
-
-                            while (!done_reflecting)
+                            if (c < padding_below)
                             {
-                                if (new_dim < padding_below[i])
-                                {
-                                    ptrdiff_t distance_oob = padding_below[i] - new_dim;
-                                    new_dim = padding_below[i] + distance_oob;
-                                }
-                                else if (new_dim >=
-                                         padding_below[i] + static_cast<ptrdiff_t>(data_shape[i]))
-                                {
-                                    ptrdiff_t distance_oob =
-                                        new_dim - padding_below[i] -
-                                        (static_cast<ptrdiff_t>(data_shape[i]) - 1);
-                                    new_dim = padding_below[i] +
-                                              static_cast<ptrdiff_t>(data_shape[i]) - distance_oob -
-                                              1;
-                                }
-                                else
-                                {
-                                    done_reflecting = true;
-                                }
+                                ptrdiff_t distance_oob = padding_below - c;
+                                c = padding_below + distance_oob;
+                            }
+                            else if (c >= padding_below + data_dim)
+                            {
+                                ptrdiff_t distance_oob = c - padding_below - (data_dim - 1);
+                                c = padding_below + data_dim - distance_oob - 1;
+                            }
+                            else
+                            {
+                                done_reflecting = true;
                             }
-
-                            c[i] = static_cast<size_t>(new_dim);
                         }
-                        const auto* offset = data + input_transform.index(c) * elem_size;
-                        std::copy(offset, offset + elem_size, v.begin());
                         break;
                     }
                     case op::PadMode::SYMMETRIC:
                     {
-                        Coordinate c = in_coord; // have to copy because in_coord is const
-                        for (size_t i = 0; i < c.size(); i++)
+                        ptrdiff_t pos = padding_below - (c + 1);
+                        if (pos >= 0)
+                        {
+                            c = pos + padding_below;
+                        }
+                        else
                         {
-                            ptrdiff_t pos = padding_below[i] - (c[i] + 1);
-                            if (pos >= 0)
+                            pos = -(pos + 1);
+                            if (pos < data_dim)
                             {
-                                c[i] = static_cast<size_t>(pos + padding_below[i]);
+                                c = pos + padding_below;
                             }
                             else
                             {
-                                pos = -(pos + 1);
-                                ptrdiff_t src_dim = static_cast<ptrdiff_t>(data_shape[i]);
-                                if (pos < src_dim)
-                                {
-                                    c[i] = static_cast<size_t>(pos + padding_below[i]);
-                                }
-                                else
-                                {
-                                    c[i] = static_cast<size_t>(2 * (padding_below[i] + src_dim) -
-                                                               c[i] - 1);
-                                }
+                                c = 2 * (padding_below + data_dim) - c - 1;
                             }
                         }
-                        const auto* offset = data + input_transform.index(c) * elem_size;
-                        std::copy(offset, offset + elem_size, v.begin());
                         break;
                     }
                     }
+                    return c - padding_below;
+                }
+
+                void pad_constant(const char* data,
+                                  const char* pad_value,
+                                  char* out,
+                                  const size_t elem_size,
+                                  const Shape& data_shape,
+                                  const Shape& out_shape,
+                                  const CoordinateDiff& padding_below)
+                {
+                    const size_t out_size = shape_size(out_shape);
+                    for (size_t i = 0; i < out_size; ++i)
+                    {
+                        std::memcpy(out + i * elem_size, pad_value, elem_size);
+                    }
+
+                    // The part of the output which is not padding is a strided copy of the
+                    // corresponding (possibly cropped) part of the data.
+                    const auto data_strides = strided::dense_strides(data_shape);
+                    const auto out_strides = strided::dense_strides(out_shape);
+                    Shape copy_shape(data_shape.size());
+                    std::ptrdiff_t data_offset = 0;
+                    std::ptrdiff_t out_offset = 0;
+                    for (size_t i = 0; i < data_shape.size(); ++i)
+                    {
+                        const ptrdiff_t begin = std::max<ptrdiff_t>(padding_below[i], 0);
+                        const ptrdiff_t end =
+                            std::min<ptrdiff_t>(padding_below[i] + data_shape[i], out_shape[i]);
+                        if (end <= begin)
+                        {
+                            return;
+                        }
+                        copy_shape[i] = static_cast<size_t>(end - begin);
+                        data_offset += (begin - padding_below[i]) * data_strides[i];
+                        out_offset += begin * out_strides[i];
+                    }
+                    strided::copy(
+                        data,
+                        out,
+                        elem_size,
+                        strided::StridedLoop(
+                            copy_shape, data_strides, data_offset, out_strides, out_offset));
+                }
+            }
 
-                    std::copy(
-                        v.begin(), v.end(), out + output_transform.index(out_coord) * elem_size);
+            void pad(const char* data,
+                     const char* pad_value,
+                     char* out,
+                     const size_t elem_size,
+                     const Shape& data_shape,
+                     const Shape& out_shape,
+                     const CoordinateDiff& padding_below,
+                     const CoordinateDiff& padding_above,
+                     const op::PadMode pad_mode)
+            {
+                NGRAPH_CHECK(data_shape.size() == out_shape.size() &&
+                             padding_below.size() == data_shape.size() &&
+                             padding_above.size() == data_shape.size());
 
-                    ++output_it;
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    pad_constant(
+                        data, pad_value, out, elem_size, data_shape, out_shape, padding_below);
+                    return;
+                }
+                if (shape_size(out_shape) == 0)
+                {
+                    return;
+                }
+
+                // Every padded axis maps output coordinates to data coordinates independently,
+                // so the mapping is tabulated once per axis as offsets in the data tensor.
+                const size_t rank = data_shape.size();
+                const auto data_strides = strided::dense_strides(data_shape);
+                std::vector<std::vector<ptrdiff_t>> src_offsets(rank);
+                for (size_t i = 0; i < rank; ++i)
+                {
+                    src_offsets[i].resize(out_shape[i]);
+                    for (size_t c = 0; c < out_shape[i]; ++c)
+                    {
+                        src_offsets[i][c] =
+                            source_coordinate(c, padding_below[i], data_shape[i], pad_mode) *
+                            data_strides[i];
+                    }
+                }
+
+                if (rank == 0)
+                {
+                    std::memcpy(out, data, elem_size);
+                    return;
+                }
+
+                const size_t row_size = out_shape[rank - 1];
+                const std::vector<ptrdiff_t>& row_offsets = src_offsets[rank - 1];
+                std::vector<size_t> out_coord(rank - 1, 0);
+                char* dst = out;
+                while (true)
+                {
+                    ptrdiff_t row_offset = 0;
+                    for (size_t i = 0; i + 1 < rank; ++i)
+                    {
+                        row_offset += src_offsets[i][out_coord[i]];
+                    }
+                    for (size_t c = 0; c < row_size; ++c, dst += elem_size)
+                    {
+                        std::memcpy(
+                            dst, data + (row_offset + row_offsets[c]) * elem_size, elem_size);
+                    }
+
+                    size_t axis = rank - 1;
+                    for (; axis > 0; --axis)
+                    {
+                        if (++out_coord[axis - 1] < out_shape[axis - 1])
+                        {
+                            break;
+                        }
+                        out_coord[axis - 1] = 0;
+                    }
+                    if (axis == 0)
+                    {
+                        return;
+                    }
                 }
             }
         }
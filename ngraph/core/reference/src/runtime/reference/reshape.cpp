@@ -14,11 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cmath>
-#include <stdio.h>
-
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
 
 using namespace ngraph;
 
@@ -29,31 +27,24 @@ void runtime::reference::reshape(const char* arg,
                                  const Shape& out_shape,
                                  size_t elem_size)
 {
-    // Unfortunately we don't yet have a constructor for CoordinateTransform that lets
-    // us pass only source_space_shape
-    // and source_axis_order so we have to construct the defaults here.
-    Shape in_start_corner(in_shape.size(), 0); // (0,...0)
-    Strides in_strides(in_shape.size(), 1);    // (1,...,1)
-
-    CoordinateTransform input_transform(
-        in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-    CoordinateTransform output_transform(out_shape);
-
-    NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                 shape_size(output_transform.get_target_shape()));
-
-    CoordinateTransform::Iterator output_it = output_transform.begin();
-
-    for (const Coordinate& input_coord : input_transform)
+    NGRAPH_CHECK(in_axis_order.size() == in_shape.size() &&
+                 shape_size(in_shape) == shape_size(out_shape));
+
+    // The input is read in the order of transposed axes and the output is written densely.
+    const auto in_strides = strided::dense_strides(in_shape);
+    Shape transposed_shape(in_shape.size());
+    strided::StrideVector transposed_strides(in_shape.size());
+    for (size_t i = 0; i < in_shape.size(); ++i)
     {
-        if (output_it == output_transform.end())
-            break;
-        const Coordinate& output_coord = *output_it;
-
-        memcpy(out + output_transform.index(output_coord) * elem_size,
-               arg + input_transform.index(input_coord) * elem_size,
-               elem_size);
-
-        ++output_it;
+        transposed_shape[i] = in_shape[in_axis_order[i]];
+        transposed_strides[i] = in_strides[in_axis_order[i]];
     }
+    strided::copy(arg,
+                  out,
+                  elem_size,
+                  strided::StridedLoop(transposed_shape,
+                                       transposed_strides,
+                                       0,
+                                       strided::dense_strides(transposed_shape),
+                                       0));
 }
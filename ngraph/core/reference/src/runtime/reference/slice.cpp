@@ -16,10 +16,8 @@
 
 #include "ngraph/runtime/reference/slice.hpp"
 
-#include <cstring>
-
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_range.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
 
 namespace ngraph
 {
@@ -39,24 +37,27 @@ namespace ngraph
                 const CoordinateTransform input_transform(
                     arg_shape, lower_bounds, upper_bounds, strides);
 
-                const CoordinateTransform output_transform(out_shape);
-
                 NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
+                             shape_size(out_shape));
 
-                auto dst_mem = out;
-
-                for (auto range :
-                     coordinates::slice(arg_shape, lower_bounds, upper_bounds, strides))
+                const auto arg_strides = strided::dense_strides(arg_shape);
+                strided::StrideVector src_strides(arg_shape.size());
+                std::ptrdiff_t src_offset = 0;
+                for (size_t i = 0; i < arg_shape.size(); ++i)
                 {
-                    auto src_index = range.begin_index;
-                    for (size_t i = 0; i < range.element_number; src_index += range.step, ++i)
-                    {
-                        const auto src_mem = arg + src_index * elem_size;
-                        std::memcpy(dst_mem, src_mem, elem_size);
-                        std::advance(dst_mem, elem_size);
-                    }
+                    src_strides[i] = arg_strides[i] * static_cast<std::ptrdiff_t>(strides[i]);
+                    src_offset += arg_strides[i] * static_cast<std::ptrdiff_t>(lower_bounds[i]);
                 }
+
+                const Shape& slice_shape = input_transform.get_target_shape();
+                strided::copy(arg,
+                              out,
+                              elem_size,
+                              strided::StridedLoop(slice_shape,
+                                                   src_strides,
+                                                   src_offset,
+                                                   strided::dense_strides(slice_shape),
+                                                   0));
             }
         } // namespace reference
     }     // namespace runtime
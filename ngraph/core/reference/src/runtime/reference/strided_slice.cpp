@@ -14,40 +14,62 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cmath>
-#include <stdio.h>
-
 #include "ngraph/check.hpp"
-#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/reference/strided_slice.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
 
 using namespace ngraph;
 
 void runtime::reference::strided_slice(
     const char* arg, char* out, const Shape& arg_shape, const SlicePlan& sp, size_t elem_type)
 {
-    runtime::AlignedBuffer slice_out_buffer(shape_size(sp.reshape_in_shape) * elem_type);
-    slice(reinterpret_cast<const char*>(arg),
-          slice_out_buffer.get_ptr<char>(),
-          arg_shape,
-          Coordinate(sp.begins.begin(), sp.begins.end()),
-          Coordinate(sp.ends.begin(), sp.ends.end()),
-          Strides(sp.strides.begin(), sp.strides.end()),
-          sp.reshape_in_shape,
-          elem_type);
+    const Shape& slice_shape = sp.reshape_in_shape;
+    NGRAPH_CHECK(slice_shape.size() == arg_shape.size() &&
+                 shape_size(slice_shape) == shape_size(sp.reshape_out_shape));
+
+    // Slice, reshape and reverse are done as a single strided copy: the slice is described by
+    // the begin offset and multiplied strides, the reshape only inserts and removes unit axes
+    // and does not move elements, and a reversed axis becomes an axis with negative stride.
+    const auto arg_strides = strided::dense_strides(arg_shape);
+    strided::StrideVector src_strides(arg_shape.size());
+    std::ptrdiff_t src_offset = 0;
+    for (size_t i = 0; i < arg_shape.size(); ++i)
+    {
+        src_strides[i] = arg_strides[i] * sp.strides[i];
+        src_offset += arg_strides[i] * sp.begins[i];
+    }
 
-    runtime::AlignedBuffer reshape_out_buffer(shape_size(sp.reshape_out_shape) * elem_type);
-    opt_kernel::reshape(slice_out_buffer.get_ptr<char>(),
-                        reshape_out_buffer.get_ptr<char>(),
-                        sp.reshape_in_shape,
-                        get_default_order(sp.reshape_in_shape.size()),
-                        sp.reshape_out_shape,
-                        elem_type);
+    // Reversing of unit axes changes nothing, other axes of reshape_out_shape match axes of
+    // reshape_in_shape one by one.
+    std::vector<size_t> non_unit_axes;
+    for (size_t i = 0; i < slice_shape.size(); ++i)
+    {
+        if (slice_shape[i] != 1)
+        {
+            non_unit_axes.push_back(i);
+        }
+    }
+    size_t non_unit_index = 0;
+    for (size_t i = 0; i < sp.reshape_out_shape.size(); ++i)
+    {
+        if (sp.reshape_out_shape[i] == 1)
+        {
+            continue;
+        }
+        NGRAPH_CHECK(non_unit_index < non_unit_axes.size() &&
+                     slice_shape[non_unit_axes[non_unit_index]] == sp.reshape_out_shape[i]);
+        const size_t axis = non_unit_axes[non_unit_index++];
+        if (sp.reverse_axes.count(i) && slice_shape[axis] != 0)
+        {
+            src_offset += src_strides[axis] * static_cast<std::ptrdiff_t>(slice_shape[axis] - 1);
+            src_strides[axis] = -src_strides[axis];
+        }
+    }
 
-    reverse(reshape_out_buffer.get_ptr<char>(),
-            out,
-            sp.reshape_out_shape,
-            sp.reshape_out_shape,
-            sp.reverse_axes,
-            elem_type);
+    strided::copy(
+        arg,
+        out,
+        elem_type,
+        strided::StridedLoop(
+            slice_shape, src_strides, src_offset, strided::dense_strides(slice_shape), 0));
 }
@@ -16,19 +16,61 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 #include <ngraph/op/constant.hpp>
+#include "ngraph/env_util.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/fake_quantize.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/transpose.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/pass/pass_profiler.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    bool is_parallel_foldable(const Node* node)
+    {
+        // Only operations which rely on the default Node::constant_fold are evaluated out of
+        // the main traversal: it reads input Constants and creates new ones without touching
+        // the graph, so several nodes can be folded at the same time.
+        return dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(node) ||
+               dynamic_cast<const op::util::BinaryElementwiseComparison*>(node) ||
+               dynamic_cast<const op::util::BinaryElementwiseLogical*>(node) ||
+               dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(node) ||
+               dynamic_cast<const op::v0::Convert*>(node) ||
+               dynamic_cast<const op::v1::Transpose*>(node) ||
+               dynamic_cast<const op::v0::FakeQuantize*>(node) ||
+               dynamic_cast<const op::v0::Concat*>(node) || dynamic_cast<const op::v1::Select*>(node);
+    }
+}
+
+ngraph::pass::ConstantFolding::ConstantFolding(bool parallel)
+    : m_parallel(parallel && !getenv_bool("NGRAPH_SERIAL_CONSTANT_FOLDING"))
+{
+}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = pre_calculated_values_folding(f);
 
-    for (const auto& node : f->get_ordered_ops())
+    if (m_parallel && runtime::parallel_get_max_threads() > 1)
+    {
+        rewritten = parallel_subgraphs_folding(f, rewritten) || rewritten;
+    }
+
+    const auto ordered_ops = f->get_ordered_ops();
+    size_t folded = 0;
+    for (const auto& node : ordered_ops)
     {
         if (rewritten)
         {
@@ -38,32 +80,10 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
         OutputVector replacements(node->get_output_size());
         if (node->constant_fold(replacements, node->input_values()))
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i)
+            if (replace_with_folded(node, replacements))
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
-                {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
+                rewritten = true;
+                folded++;
             }
         }
         else
@@ -79,6 +99,135 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
         }
     }
 
+    PassProfiler::add_nodes_visited(ordered_ops.size());
+    PassProfiler::add_rewrites(folded);
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                        const OutputVector& replacements)
+{
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
+        {
+            if (replacements.size() == 1)
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::parallel_subgraphs_folding(
+    const std::shared_ptr<ngraph::Function>& f, bool revalidate)
+{
+    // Depth of the node in a constant subgraph: 0 for Constants, 1 + max depth of inputs
+    // for foldable nodes. Nodes with equal depth don't depend on each other.
+    unordered_map<const Node*, size_t> depths;
+    vector<vector<shared_ptr<Node>>> stages;
+    for (const auto& node : f->get_ordered_ops())
+    {
+        if (revalidate)
+        {
+            node->validate_and_infer_types();
+        }
+        if (is_type<op::Constant>(node))
+        {
+            depths[node.get()] = 0;
+            continue;
+        }
+        if (node->get_input_size() == 0 || !is_parallel_foldable(node.get()))
+        {
+            continue;
+        }
+
+        size_t depth = 0;
+        bool is_constant_subgraph = true;
+        for (const auto& input : node->input_values())
+        {
+            auto it = depths.find(input.get_node());
+            if (it == depths.end())
+            {
+                is_constant_subgraph = false;
+                break;
+            }
+            depth = std::max(depth, it->second + 1);
+        }
+        if (!is_constant_subgraph)
+        {
+            continue;
+        }
+        depths[node.get()] = depth;
+        if (stages.size() < depth)
+        {
+            stages.resize(depth);
+        }
+        stages[depth - 1].push_back(node);
+    }
+
+    // Nodes of a stage are evaluated concurrently and the graph is modified only between the
+    // stages, so evaluation never races with graph modifications. Folded values of a stage are
+    // owned by the graph afterwards and are released as soon as all their consumers are folded.
+    bool rewritten = false;
+    for (auto& stage : stages)
+    {
+        vector<OutputVector> stage_replacements(stage.size());
+        auto fold = [&](size_t i) {
+            const auto& node = stage[i];
+            for (const auto& input : node->input_values())
+            {
+                if (!is_type<op::Constant>(input.get_node()))
+                {
+                    // One of producers wasn't folded, the node is left to the main traversal
+                    return;
+                }
+            }
+            OutputVector outputs(node->get_output_size());
+            if (node->constant_fold(outputs, node->input_values()))
+            {
+                stage_replacements[i] = std::move(outputs);
+            }
+        };
+
+        // A single node of the stage may run its evaluate() in parallel instead
+        if (stage.size() == 1)
+        {
+            fold(0);
+        }
+        else
+        {
+            runtime::parallel_for(stage.size(), fold);
+        }
+
+        for (size_t i = 0; i < stage.size(); ++i)
+        {
+            if (!stage_replacements[i].empty())
+            {
+                rewritten = replace_with_folded(stage[i], stage_replacements[i]) || rewritten;
+            }
+        }
+        // Replaced nodes hold their inputs, which are folded values of the previous stage
+        vector<shared_ptr<Node>>().swap(stage);
+    }
     return rewritten;
 }
 
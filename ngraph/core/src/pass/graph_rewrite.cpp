@@ -27,6 +27,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/pass/pass_profiler.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -71,7 +72,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
 
-    bool rewritten = false;
+    size_t nodes_visited = 0;
+    size_t rewrites = 0;
     const auto& pass_config = get_pass_config();
 
     // Initialize execution queue with nodes in topological order
@@ -176,6 +178,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     {
         auto node = nodes_to_run.front();
         nodes_to_run.pop_front();
+        nodes_visited++;
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
         {
@@ -219,7 +222,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             {
                 if (run_matcher_pass(m_matchers[matcher_index], node))
                 {
-                    rewritten = true;
+                    rewrites++;
                     break;
                 }
             }
@@ -235,13 +238,15 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
                 if (run_matcher_pass(m_pass, node))
                 {
-                    rewritten = true;
+                    rewrites++;
                     break;
                 }
             }
         }
     }
-    return rewritten;
+    PassProfiler::add_nodes_visited(nodes_visited);
+    PassProfiler::add_rewrites(rewrites);
+    return rewrites > 0;
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
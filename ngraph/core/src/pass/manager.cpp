@@ -30,6 +30,7 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
+#include "ngraph/pass/pass_profiler.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
 
@@ -111,39 +112,37 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             continue;
         }
 
+        // This checks is to skip the graph transformation when the graph pass relies on
+        // static shape but the function state is dynamic.
+        if (pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic())
+        {
+            NGRAPH_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
+                         << "function is dynamic. Skipping this transformation";
+            continue;
+        }
+
         OV_ITT_SCOPED_TASK(itt::domains::nGraphPass_LT,
                            pass::perf_counters()[pass->get_type_info()]);
 
         pass_timer.start();
 
+        // Validate is not executed if the previous pass didn't change the function, so it is
+        // not profiled either
+        std::unique_ptr<PassProfilingScope> profiling_scope;
+        if (!dynamic_pointer_cast<Validate>(pass) || function_changed)
+        {
+            profiling_scope.reset(new PassProfilingScope(pass->get_name()));
+        }
+
         NGRAPH_SUPPRESS_DEPRECATED_START
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass))
         {
-            // This checks is to skip the graph transformation when the graph pass relies on
-            // static shape but the function state is dynamic.
-            if (matcher_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) &&
-                func->is_dynamic())
-            {
-                NGRAPH_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
-                             << "function is dynamic. Skipping this transformation";
-                continue;
-            }
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
             function_changed = GraphRewrite(matcher_pass).run_on_function(func);
         }
         else if (auto function_pass = dynamic_pointer_cast<FunctionPass>(pass))
         {
-            // This checks is to skip the graph transformation when the graph pass relies on
-            // static shape but the function state is dynamic.
-            if (function_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) &&
-                func->is_dynamic())
-            {
-                NGRAPH_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
-                             << "function is dynamic. Skipping this transformation";
-                continue;
-            }
-
             if (dynamic_pointer_cast<Validate>(pass))
             {
                 if (function_changed)
@@ -159,18 +158,22 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         }
         else if (auto node_pass = dynamic_pointer_cast<NodePass>(pass))
         {
-            if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic())
-            {
-                NGRAPH_DEBUG << "Pass " << pass->get_name() << " requires static shape but the "
-                             << "function is dynamic. Skipping this transformation";
-                continue;
-            }
+            size_t nodes_visited = 0;
+            size_t rewrites = 0;
             for (shared_ptr<Node> n : func->get_ops())
             {
-                function_changed |= node_pass->run_on_node(n);
+                nodes_visited++;
+                if (node_pass->run_on_node(n))
+                {
+                    function_changed = true;
+                    rewrites++;
+                }
             }
+            PassProfiler::add_nodes_visited(nodes_visited);
+            PassProfiler::add_rewrites(rewrites);
         }
         NGRAPH_SUPPRESS_DEPRECATED_END
+        profiling_scope.reset();
 
         if (m_visualize)
         {
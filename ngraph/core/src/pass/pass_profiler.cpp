@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/pass_profiler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+pass::PassProfiler*& pass::PassProfiler::active()
+{
+    static thread_local PassProfiler* profiler = nullptr;
+    return profiler;
+}
+
+pass::PassProfiler::PassProfiler()
+    : m_previous(active())
+{
+    active() = this;
+}
+
+pass::PassProfiler::~PassProfiler()
+{
+    active() = m_previous;
+}
+
+void pass::PassProfiler::add_nodes_visited(size_t count)
+{
+    auto profiler = active();
+    if (profiler && !profiler->m_running.empty())
+    {
+        profiler->m_profiles[profiler->m_running.back()].nodes_visited += count;
+    }
+}
+
+void pass::PassProfiler::add_rewrites(size_t count)
+{
+    auto profiler = active();
+    if (profiler && !profiler->m_running.empty())
+    {
+        profiler->m_profiles[profiler->m_running.back()].rewrites += count;
+    }
+}
+
+bool pass::PassProfiler::is_active()
+{
+    return active() != nullptr;
+}
+
+void pass::PassProfiler::add_profile(const string& name,
+                                     chrono::microseconds time,
+                                     size_t nodes_visited,
+                                     size_t rewrites)
+{
+    auto profiler = active();
+    if (profiler)
+    {
+        PassProfile profile;
+        profile.name = name;
+        profile.depth = profiler->m_running.size();
+        profile.time = time;
+        profile.nodes_visited = nodes_visited;
+        profile.rewrites = rewrites;
+        profiler->m_profiles.push_back(profile);
+    }
+}
+
+pass::PassProfilingScope::PassProfilingScope(const string& pass_name)
+    : m_profiler(PassProfiler::active())
+{
+    if (m_profiler)
+    {
+        PassProfile profile;
+        profile.name = pass_name;
+        profile.depth = m_profiler->m_running.size();
+        m_profiler->m_running.push_back(m_profiler->m_profiles.size());
+        m_profiler->m_profiles.push_back(profile);
+        m_start = chrono::steady_clock::now();
+    }
+}
+
+pass::PassProfilingScope::~PassProfilingScope()
+{
+    if (m_profiler)
+    {
+        const size_t index = m_profiler->m_running.back();
+        m_profiler->m_running.pop_back();
+        auto& profile = m_profiler->m_profiles[index];
+        profile.time =
+            chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - m_start);
+        // Counters of nested transformations are included into the enclosing one
+        if (!m_profiler->m_running.empty())
+        {
+            auto& parent = m_profiler->m_profiles[m_profiler->m_running.back()];
+            parent.nodes_visited += profile.nodes_visited;
+            parent.rewrites += profile.rewrites;
+        }
+    }
+}
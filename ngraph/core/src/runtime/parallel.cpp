@@ -0,0 +1,276 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    thread_local bool in_parallel_region = false;
+
+    class ParallelRegionGuard
+    {
+    public:
+        ParallelRegionGuard()
+            : m_previous(in_parallel_region)
+        {
+            in_parallel_region = true;
+        }
+        ~ParallelRegionGuard() { in_parallel_region = m_previous; }
+
+    private:
+        bool m_previous;
+    };
+
+    /// \brief Fixed-size pool of worker threads. The thread which submits a job takes part in
+    ///        its execution as thread 0, so the pool owns max_threads - 1 workers.
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(size_t max_threads)
+        {
+            for (size_t ithr = 1; ithr < max_threads; ++ithr)
+            {
+                m_workers.emplace_back(&ThreadPool::worker_loop, this, ithr);
+            }
+        }
+
+        ~ThreadPool()
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_job_cv.notify_all();
+            for (auto& worker : m_workers)
+            {
+                worker.join();
+            }
+        }
+
+        void run(size_t nthr, const function<void(size_t, size_t)>& func)
+        {
+            // The pool serves one job at a time. Other threads which want to run a parallel
+            // region at the same moment execute it by themselves instead of waiting.
+            unique_lock<mutex> submit_lock(m_submit_mutex, try_to_lock);
+            if (!submit_lock.owns_lock())
+            {
+                ParallelRegionGuard guard;
+                func(0, 1);
+                return;
+            }
+
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_job = &func;
+                m_job_nthr = nthr;
+                m_pending = nthr - 1;
+                m_error = nullptr;
+                ++m_generation;
+            }
+            m_job_cv.notify_all();
+
+            execute(0);
+
+            unique_lock<mutex> lock(m_mutex);
+            m_done_cv.wait(lock, [this] { return m_pending == 0; });
+            m_job = nullptr;
+            if (m_error)
+            {
+                rethrow_exception(m_error);
+            }
+        }
+
+    private:
+        void execute(size_t ithr)
+        {
+            ParallelRegionGuard guard;
+            try
+            {
+                (*m_job)(ithr, m_job_nthr);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(m_mutex);
+                if (!m_error)
+                {
+                    m_error = current_exception();
+                }
+            }
+        }
+
+        void worker_loop(size_t ithr)
+        {
+            size_t seen_generation = 0;
+            unique_lock<mutex> lock(m_mutex);
+            while (true)
+            {
+                m_job_cv.wait(lock,
+                              [&] { return m_stop || m_generation != seen_generation; });
+                if (m_stop)
+                {
+                    return;
+                }
+                seen_generation = m_generation;
+                if (ithr >= m_job_nthr)
+                {
+                    continue;
+                }
+
+                lock.unlock();
+                execute(ithr);
+                lock.lock();
+
+                if (--m_pending == 0)
+                {
+                    m_done_cv.notify_one();
+                }
+            }
+        }
+
+        vector<thread> m_workers;
+        mutex m_submit_mutex;
+        mutex m_mutex;
+        condition_variable m_job_cv;
+        condition_variable m_done_cv;
+        const function<void(size_t, size_t)>* m_job = nullptr;
+        size_t m_job_nthr = 0;
+        size_t m_pending = 0;
+        size_t m_generation = 0;
+        exception_ptr m_error;
+        bool m_stop = false;
+    };
+
+    size_t limit_threads(size_t nthr)
+    {
+        static const int32_t env_threads = getenv_int("NGRAPH_NUM_THREADS");
+        nthr = max<size_t>(nthr, 1);
+        if (env_threads > 0)
+        {
+            nthr = min<size_t>(nthr, static_cast<size_t>(env_threads));
+        }
+        return nthr;
+    }
+
+    size_t get_pool_threads()
+    {
+        static const size_t max_threads = limit_threads(thread::hardware_concurrency());
+        return max_threads;
+    }
+
+    ThreadPool& get_thread_pool()
+    {
+        static ThreadPool pool(get_pool_threads());
+        return pool;
+    }
+
+    struct Backend
+    {
+        runtime::ParallelBackend run;
+        function<size_t()> max_threads;
+    };
+
+    mutex backend_mutex;
+    shared_ptr<const Backend> backend;
+
+    shared_ptr<const Backend> get_backend()
+    {
+        lock_guard<mutex> lock(backend_mutex);
+        return backend;
+    }
+
+    size_t get_max_threads(const shared_ptr<const Backend>& backend)
+    {
+        return backend ? limit_threads(backend->max_threads()) : get_pool_threads();
+    }
+}
+
+void runtime::parallel_set_backend(ParallelBackend run, function<size_t()> max_threads)
+{
+    shared_ptr<const Backend> new_backend;
+    if (run)
+    {
+        NGRAPH_CHECK(max_threads, "Number of threads of the parallel backend is not set");
+        new_backend = make_shared<const Backend>(Backend{move(run), move(max_threads)});
+    }
+    lock_guard<mutex> lock(backend_mutex);
+    backend = move(new_backend);
+}
+
+size_t runtime::parallel_get_max_threads()
+{
+    return get_max_threads(get_backend());
+}
+
+bool runtime::parallel_in_region()
+{
+    return in_parallel_region;
+}
+
+void runtime::parallel_nt(size_t nthr, const function<void(size_t, size_t)>& func)
+{
+    const auto backend = get_backend();
+    const size_t max_threads = get_max_threads(backend);
+    if (nthr == 0 || nthr > max_threads)
+    {
+        nthr = max_threads;
+    }
+    if (nthr == 1 || in_parallel_region)
+    {
+        ParallelRegionGuard guard;
+        func(0, 1);
+        return;
+    }
+    if (backend)
+    {
+        // Exceptions must not escape the threads of the backend (e.g. OpenMP terminates the
+        // process), so the first one is kept and rethrown after all threads have finished.
+        mutex error_mutex;
+        exception_ptr error;
+        backend->run(nthr, [&](size_t ithr, size_t nthr) {
+            ParallelRegionGuard guard;
+            try
+            {
+                func(ithr, nthr);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(error_mutex);
+                if (!error)
+                {
+                    error = current_exception();
+                }
+            }
+        });
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+        return;
+    }
+    get_thread_pool().run(nthr, func);
+}
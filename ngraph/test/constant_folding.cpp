@@ -14,12 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset5.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -3168,3 +3172,162 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+static std::shared_ptr<Function> make_weights_decompression_function(size_t branches)
+{
+    ResultVector results;
+    for (size_t i = 0; i < branches; ++i)
+    {
+        const Shape weights_shape{64, 32, 3, 3};
+        std::vector<uint8_t> weights_values(shape_size(weights_shape));
+        for (size_t j = 0; j < weights_values.size(); ++j)
+        {
+            weights_values[j] = static_cast<uint8_t>((i + j * 7) % 256);
+        }
+        auto weights = make_shared<opset5::Constant>(element::u8, weights_shape, weights_values);
+        auto convert = make_shared<opset5::Convert>(weights, element::f32);
+        auto zero_point = opset5::Constant::create(element::f32, Shape{64, 1, 1, 1}, {128});
+        auto subtract = make_shared<opset5::Subtract>(convert, zero_point);
+        auto scale = opset5::Constant::create(element::f32, Shape{64, 1, 1, 1}, {0.5f + i});
+        auto multiply = make_shared<opset5::Multiply>(subtract, scale);
+        auto order = opset5::Constant::create(element::i64, Shape{4}, {1, 0, 3, 2});
+        auto transpose = make_shared<opset5::Transpose>(multiply, order);
+        transpose->set_friendly_name("weights_" + std::to_string(i));
+        results.push_back(make_shared<opset5::Result>(transpose));
+    }
+    return make_shared<Function>(results, ParameterVector{});
+}
+
+namespace
+{
+    // Executes parallel regions by a fixed number of threads, so the parallel path is taken
+    // regardless of the number of cores of the machine
+    class ScopedParallelBackend
+    {
+    public:
+        explicit ScopedParallelBackend(size_t nthr, function<void(size_t)> on_region = nullptr)
+        {
+            runtime::parallel_set_backend(
+                [this, on_region](size_t nthr, const function<void(size_t, size_t)>& func) {
+                    if (on_region)
+                    {
+                        on_region(m_regions);
+                    }
+                    m_regions++;
+                    vector<thread> threads;
+                    for (size_t ithr = 1; ithr < nthr; ++ithr)
+                    {
+                        threads.emplace_back(func, ithr, nthr);
+                    }
+                    func(0, nthr);
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+                },
+                [nthr] { return nthr; });
+        }
+        ~ScopedParallelBackend() { runtime::parallel_set_backend(nullptr, nullptr); }
+        size_t get_regions() const { return m_regions; }
+
+    private:
+        atomic<size_t> m_regions{0};
+    };
+}
+
+TEST(constant_folding, parallel_subgraphs_folding)
+{
+    const size_t branches = 4;
+    auto f = make_weights_decompression_function(branches);
+    auto f_serial = make_weights_decompression_function(branches);
+
+    {
+        ScopedParallelBackend backend(4);
+        ASSERT_EQ(runtime::parallel_get_max_threads(), 4);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.run_passes(f);
+        ASSERT_GT(backend.get_regions(), 0);
+    }
+
+    pass::Manager serial_pass_manager;
+    serial_pass_manager.register_pass<pass::ConstantFolding>(false);
+    serial_pass_manager.run_passes(f_serial);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Constant>(f), branches);
+    ASSERT_EQ(count_ops_of_type<opset5::Constant>(f_serial), branches);
+    for (size_t i = 0; i < branches; ++i)
+    {
+        auto folded = as_type_ptr<opset5::Constant>(
+            f->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        auto folded_serial = as_type_ptr<opset5::Constant>(
+            f_serial->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(folded);
+        ASSERT_TRUE(folded_serial);
+        ASSERT_EQ(folded->get_friendly_name(), "weights_" + std::to_string(i));
+        ASSERT_EQ(folded->get_shape(), (Shape{32, 64, 3, 3}));
+        ASSERT_EQ(folded->get_vector<float>(), folded_serial->get_vector<float>());
+    }
+}
+
+TEST(constant_folding, parallel_subgraphs_folding_partially_constant)
+{
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{2, 3});
+    auto weights = opset5::Constant::create(element::u8, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto convert = make_shared<opset5::Convert>(weights, element::f32);
+    auto scale = opset5::Constant::create(element::f32, Shape{1}, {2});
+    auto multiply = make_shared<opset5::Multiply>(convert, scale);
+    auto add = make_shared<opset5::Add>(data, multiply);
+    auto f = make_shared<Function>(add, ParameterVector{data});
+
+    ScopedParallelBackend backend(4);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Convert>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset5::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset5::Add>(f), 1);
+
+    auto folded = as_type_ptr<opset5::Constant>(add->input_value(1).get_node_shared_ptr());
+    ASSERT_TRUE(folded);
+    vector<float> expected{2, 4, 6, 8, 10, 12};
+    ASSERT_EQ(folded->get_vector<float>(), expected);
+}
+
+TEST(constant_folding, parallel_subgraphs_folding_releases_previous_stages)
+{
+    // two independent chains Convert -> Multiply, so every stage is evaluated in parallel
+    NodeVector chains;
+    vector<weak_ptr<Node>> sources;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        auto weights = opset5::Constant::create(element::u8, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+        auto convert = make_shared<opset5::Convert>(weights, element::f32);
+        auto scale = opset5::Constant::create(element::f32, Shape{}, {2.f + i});
+        chains.push_back(make_shared<opset5::Multiply>(convert, scale));
+        sources.push_back(weights);
+    }
+    auto f = make_shared<Function>(chains, ParameterVector{});
+    chains.clear();
+
+    vector<bool> expired_before_region;
+    ScopedParallelBackend backend(4, [&](size_t) {
+        expired_before_region.push_back(sources[0].expired() && sources[1].expired());
+    });
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    // the source weights are released once the Converts are folded, before the next stage
+    ASSERT_EQ(expired_before_region.size(), 2);
+    ASSERT_FALSE(expired_before_region[0]);
+    ASSERT_TRUE(expired_before_region[1]);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Constant>(f), 2);
+    auto folded = as_type_ptr<opset5::Constant>(
+        f->get_results().at(1)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(folded);
+    vector<float> expected{3, 6, 9, 12, 15, 18};
+    ASSERT_EQ(folded->get_vector<float>(), expected);
+}
@@ -301,3 +301,49 @@ TEST(op_eval, matmul_dynamic_broadcast_transpose1)
         ASSERT_EQ(read_vector<int64_t>(result), expected_result[i]);
     }
 }
+
+TEST(op_eval, matmul_large_batched)
+{
+    // Big enough to be split between threads both over batches and inside of a batch
+    const size_t batch = 3, M = 67, K = 129, N = 301;
+    auto arg0 = make_shared<op::Parameter>(element::i64, PartialShape::dynamic());
+    auto arg1 = make_shared<op::Parameter>(element::i64, PartialShape::dynamic());
+    auto matmul = make_shared<op::MatMul>(arg0, arg1, false, false);
+    auto fun = make_shared<Function>(OutputVector{matmul}, ParameterVector{arg0, arg1});
+
+    std::vector<int64_t> arg0_input(batch * M * K);
+    std::vector<int64_t> arg1_input(K * N);
+    for (size_t i = 0; i < arg0_input.size(); ++i)
+    {
+        arg0_input[i] = static_cast<int64_t>(i % 17) - 8;
+    }
+    for (size_t i = 0; i < arg1_input.size(); ++i)
+    {
+        arg1_input[i] = static_cast<int64_t>(i % 13) - 6;
+    }
+
+    std::vector<int64_t> expected_result(batch * M * N, 0);
+    for (size_t b = 0; b < batch; ++b)
+    {
+        for (size_t m = 0; m < M; ++m)
+        {
+            for (size_t n = 0; n < N; ++n)
+            {
+                int64_t sum = 0;
+                for (size_t k = 0; k < K; ++k)
+                {
+                    sum += arg0_input[(b * M + m) * K + k] * arg1_input[k * N + n];
+                }
+                expected_result[(b * M + m) * N + n] = sum;
+            }
+        }
+    }
+
+    auto result = make_shared<HostTensor>();
+    ASSERT_TRUE(
+        fun->evaluate({result},
+                      {make_host_tensor<element::Type_t::i64>(Shape{batch, M, K}, arg0_input),
+                       make_host_tensor<element::Type_t::i64>(Shape{K, N}, arg1_input)}));
+    EXPECT_EQ(result->get_shape(), (Shape{batch, M, N}));
+    ASSERT_EQ(read_vector<int64_t>(result), expected_result);
+}
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(parallel, parallel_for_visits_every_index_once)
+{
+    const size_t work_amount = 100003;
+    vector<atomic<int>> visits(work_amount);
+    for (auto& visit : visits)
+    {
+        visit = 0;
+    }
+
+    runtime::parallel_for(work_amount, [&](size_t i) { visits[i]++; });
+
+    for (const auto& visit : visits)
+    {
+        ASSERT_EQ(visit, 1);
+    }
+}
+
+TEST(parallel, parallel_for_blocked_covers_range)
+{
+    const size_t work_amount = 10 * runtime::parallel_default_grain_size + 7;
+    vector<int> data(work_amount, 0);
+
+    runtime::parallel_for_blocked(work_amount, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i)
+        {
+            data[i]++;
+        }
+    });
+
+    for (const auto& value : data)
+    {
+        ASSERT_EQ(value, 1);
+    }
+}
+
+TEST(parallel, nested_regions_run_serially)
+{
+    atomic<size_t> counter{0};
+    atomic<bool> nested_in_region{true};
+
+    runtime::parallel_for(64, [&](size_t) {
+        runtime::parallel_for(16, [&](size_t) {
+            nested_in_region = nested_in_region && runtime::parallel_in_region();
+            counter++;
+        });
+    });
+
+    EXPECT_EQ(counter, 64 * 16);
+    if (runtime::parallel_get_max_threads() > 1)
+    {
+        EXPECT_TRUE(nested_in_region);
+    }
+    EXPECT_FALSE(runtime::parallel_in_region());
+}
+
+TEST(parallel, exception_is_rethrown)
+{
+    EXPECT_THROW(runtime::parallel_nt(0,
+                                      [](size_t ithr, size_t nthr) {
+                                          if (ithr == nthr - 1)
+                                          {
+                                              throw runtime_error("parallel_nt");
+                                          }
+                                      }),
+                 runtime_error);
+}
+
+TEST(parallel, exception_is_rethrown_with_backend)
+{
+    // The backend doesn't handle exceptions: one escaping a std::thread terminates the process
+    runtime::parallel_set_backend(
+        [](size_t nthr, const function<void(size_t, size_t)>& func) {
+            vector<thread> threads;
+            for (size_t ithr = 1; ithr < nthr; ++ithr)
+            {
+                threads.emplace_back([&, ithr] { func(ithr, nthr); });
+            }
+            func(0, nthr);
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        },
+        [] { return size_t(4); });
+
+    EXPECT_THROW(runtime::parallel_nt(0,
+                                      [](size_t, size_t) { throw runtime_error("parallel_nt"); }),
+                 runtime_error);
+
+    runtime::parallel_set_backend(nullptr, nullptr);
+}
+
+TEST(parallel, splitter)
+{
+    for (size_t team = 1; team < 9; ++team)
+    {
+        size_t expected_start = 0;
+        for (size_t tid = 0; tid < team; ++tid)
+        {
+            size_t start = 0, end = 0;
+            runtime::splitter(size_t(13), team, tid, start, end);
+            EXPECT_EQ(start, expected_start);
+            EXPECT_LE(end - start, (13 + team - 1) / team);
+            expected_start = end;
+        }
+        EXPECT_EQ(expected_start, 13);
+    }
+}
@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/opsets/opset3.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/pass_profiler.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+class DivideToRelu : public pass::MatcherPass
+{
+public:
+    NGRAPH_RTTI_DECLARATION;
+    DivideToRelu()
+    {
+        auto divide = pattern::wrap_type<opset3::Divide>();
+        graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto root = m.get_match_root();
+            auto relu = make_shared<opset3::Relu>(root->input_value(0));
+            relu->set_friendly_name(root->get_friendly_name());
+            replace_node(root, relu);
+            return true;
+        };
+        auto m = make_shared<pattern::Matcher>(divide, "DivideToRelu");
+        register_matcher(m, callback);
+    }
+};
+
+class NestedDivideToRelu : public pass::FunctionPass
+{
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(shared_ptr<Function> f) override
+    {
+        pass::Manager manager;
+        manager.register_pass<DivideToRelu>();
+        manager.run_passes(f);
+        return true;
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(DivideToRelu, "DivideToRelu", 0);
+NGRAPH_RTTI_DEFINITION(NestedDivideToRelu, "NestedDivideToRelu", 0);
+
+namespace
+{
+    // Function with independent branches: Parameter -> Divide -> ... -> Divide -> Result
+    shared_ptr<Function> make_branches(size_t branches, size_t depth)
+    {
+        ParameterVector params;
+        OutputVector results;
+        for (size_t i = 0; i < branches; ++i)
+        {
+            auto param = make_shared<opset3::Parameter>(element::f32, Shape{2, 2});
+            Output<Node> value = param;
+            for (size_t j = 0; j < depth; ++j)
+            {
+                auto divisor = opset3::Constant::create(element::f32, Shape{}, {2.f});
+                value = make_shared<opset3::Divide>(value, divisor);
+            }
+            params.push_back(param);
+            results.push_back(value);
+        }
+        return make_shared<Function>(results, params);
+    }
+}
+
+TEST(pass_profiler, collects_counters)
+{
+    auto f = make_branches(1, 3);
+    const size_t ops = f->get_ordered_ops().size();
+
+    pass::PassProfiler profiler;
+    pass::Manager manager;
+    manager.register_pass<DivideToRelu>();
+    manager.run_passes(f);
+
+    const auto& profiles = profiler.get_profiles();
+    ASSERT_EQ(profiles.size(), 2);
+    EXPECT_EQ(profiles[0].name, "DivideToRelu");
+    EXPECT_EQ(profiles[0].depth, 0);
+    EXPECT_EQ(profiles[0].nodes_visited, ops);
+    EXPECT_EQ(profiles[0].rewrites, 3);
+    // Validate is executed because the function was changed
+    EXPECT_EQ(profiles[1].depth, 0);
+    EXPECT_EQ(profiles[1].rewrites, 0);
+}
+
+TEST(pass_profiler, nested_transformations)
+{
+    auto f = make_branches(1, 2);
+    const size_t ops = f->get_ordered_ops().size();
+
+    pass::PassProfiler profiler;
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<NestedDivideToRelu>();
+    manager.run_passes(f);
+
+    const auto& profiles = profiler.get_profiles();
+    ASSERT_EQ(profiles.size(), 3);
+    EXPECT_EQ(profiles[0].name, "NestedDivideToRelu");
+    EXPECT_EQ(profiles[0].depth, 0);
+    EXPECT_EQ(profiles[1].name, "DivideToRelu");
+    EXPECT_EQ(profiles[1].depth, 1);
+    EXPECT_EQ(profiles[2].depth, 1);
+    // Counters and time of nested transformations are included into the enclosing one
+    EXPECT_EQ(profiles[0].nodes_visited, ops);
+    EXPECT_EQ(profiles[0].rewrites, 2);
+    EXPECT_GE(profiles[0].time, profiles[1].time + profiles[2].time);
+}
+
+TEST(pass_profiler, innermost_profiler_collects)
+{
+    auto f = make_branches(1, 1);
+
+    pass::PassProfiler outer;
+    {
+        pass::PassProfiler inner;
+        pass::Manager manager;
+        manager.register_pass<DivideToRelu>();
+        manager.run_passes(f);
+        EXPECT_EQ(inner.get_profiles().size(), 2);
+    }
+    EXPECT_TRUE(outer.get_profiles().empty());
+}
+
+TEST(pass_profiler, add_profile)
+{
+    EXPECT_FALSE(pass::PassProfiler::is_active());
+    // Without a profiler the call is ignored
+    pass::PassProfiler::add_profile("Ignored", chrono::microseconds(1), 1, 1);
+
+    pass::PassProfiler profiler;
+    EXPECT_TRUE(pass::PassProfiler::is_active());
+    {
+        pass::PassProfilingScope scope("Enclosing");
+        pass::PassProfiler::add_rewrites(2);
+        pass::PassProfiler::add_profile("Measured", chrono::microseconds(5), 7, 1);
+    }
+
+    const auto& profiles = profiler.get_profiles();
+    ASSERT_EQ(profiles.size(), 2);
+    EXPECT_EQ(profiles[0].name, "Enclosing");
+    EXPECT_EQ(profiles[0].rewrites, 2);
+    EXPECT_EQ(profiles[0].nodes_visited, 0);
+    EXPECT_EQ(profiles[1].name, "Measured");
+    EXPECT_EQ(profiles[1].depth, 1);
+    EXPECT_EQ(profiles[1].time, chrono::microseconds(5));
+    EXPECT_EQ(profiles[1].nodes_visited, 7);
+    EXPECT_EQ(profiles[1].rewrites, 1);
+}
@@ -0,0 +1,204 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/reference/utils/strided_loop.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace ngraph::runtime::reference;
+
+namespace
+{
+    vector<float> iota_vector(size_t size)
+    {
+        vector<float> v(size);
+        iota(v.begin(), v.end(), 0.f);
+        return v;
+    }
+
+    // Transposes the input with the coordinate transform, as the reference kernels used to do.
+    vector<float> transpose_with_coordinate_transform(const vector<float>& in,
+                                                      const Shape& in_shape,
+                                                      const AxisVector& order)
+    {
+        vector<float> out(in.size());
+        CoordinateTransform input_transform(
+            in_shape, Coordinate(in_shape.size(), 0), in_shape, Strides(in_shape.size(), 1), order);
+        size_t out_index = 0;
+        for (const Coordinate& in_coord : input_transform)
+        {
+            out[out_index++] = in[input_transform.index(in_coord)];
+        }
+        return out;
+    }
+
+    strided::StridedLoop transpose_loop(const Shape& in_shape, const AxisVector& order)
+    {
+        const auto in_strides = strided::dense_strides(in_shape);
+        Shape out_shape(in_shape.size());
+        strided::StrideVector src_strides(in_shape.size());
+        for (size_t i = 0; i < in_shape.size(); ++i)
+        {
+            out_shape[i] = in_shape[order[i]];
+            src_strides[i] = in_strides[order[i]];
+        }
+        return strided::StridedLoop(
+            out_shape, src_strides, 0, strided::dense_strides(out_shape), 0);
+    }
+}
+
+TEST(strided_loop, dense_strides)
+{
+    EXPECT_EQ(strided::dense_strides(Shape{2, 3, 4}), (strided::StrideVector{12, 4, 1}));
+    EXPECT_EQ(strided::dense_strides(Shape{}), strided::StrideVector{});
+}
+
+TEST(strided_loop, contiguous_axes_are_merged)
+{
+    const Shape shape{2, 1, 3, 4};
+    const auto strides = strided::dense_strides(shape);
+    strided::StridedLoop loop(shape, strides, 0, strides, 0);
+    EXPECT_EQ(loop.rank(), 1);
+    EXPECT_EQ(loop.count(), 24);
+    EXPECT_EQ(loop.row_size(), 24);
+}
+
+TEST(strided_loop, empty_space)
+{
+    const Shape shape{2, 0, 3};
+    const auto strides = strided::dense_strides(shape);
+    strided::StridedLoop loop(shape, strides, 0, strides, 0);
+    EXPECT_EQ(loop.count(), 0);
+    size_t visited = 0;
+    loop.for_each([&](ptrdiff_t, ptrdiff_t) { visited++; });
+    EXPECT_EQ(visited, 0);
+}
+
+TEST(strided_loop, transpose)
+{
+    for (size_t rank = 1; rank <= 8; ++rank)
+    {
+        Shape in_shape(rank);
+        for (size_t i = 0; i < rank; ++i)
+        {
+            in_shape[i] = 2 + i % 3;
+        }
+        AxisVector order(rank);
+        iota(order.rbegin(), order.rend(), 0);
+        if (rank > 2)
+        {
+            swap(order[0], order[1]);
+        }
+
+        const auto in = iota_vector(shape_size(in_shape));
+        vector<float> out(in.size());
+        strided::copy(reinterpret_cast<const char*>(in.data()),
+                      reinterpret_cast<char*>(out.data()),
+                      sizeof(float),
+                      transpose_loop(in_shape, order));
+
+        EXPECT_EQ(out, transpose_with_coordinate_transform(in, in_shape, order))
+            << "rank " << rank;
+    }
+}
+
+TEST(strided_loop, broadcast_and_reverse)
+{
+    // Broadcast {3} to {2, 3} reading the input backwards.
+    const vector<float> in{1, 2, 3};
+    vector<float> out(6);
+    strided::StridedLoop loop(Shape{2, 3}, {0, -1}, 2, {3, 1}, 0);
+    strided::copy(reinterpret_cast<const char*>(in.data()),
+                  reinterpret_cast<char*>(out.data()),
+                  sizeof(float),
+                  loop);
+    EXPECT_EQ(out, (vector<float>{3, 2, 1, 3, 2, 1}));
+}
+
+TEST(strided_loop, reduction_visits_input_in_row_major_order)
+{
+    const Shape in_shape{2, 3, 4};
+    const auto in = iota_vector(shape_size(in_shape));
+    vector<ptrdiff_t> in_indices;
+    vector<float> out(3, 0.f);
+    strided::reduction_loop(in_shape, AxisSet{0, 2})
+        .for_each([&](ptrdiff_t in_index, ptrdiff_t out_index) {
+            in_indices.push_back(in_index);
+            out[out_index] += in[in_index];
+        });
+
+    vector<ptrdiff_t> expected_indices(in.size());
+    iota(expected_indices.begin(), expected_indices.end(), 0);
+    EXPECT_EQ(in_indices, expected_indices);
+    EXPECT_EQ(out, (vector<float>{0 + 1 + 2 + 3 + 12 + 13 + 14 + 15,
+                                  4 + 5 + 6 + 7 + 16 + 17 + 18 + 19,
+                                  8 + 9 + 10 + 11 + 20 + 21 + 22 + 23}));
+}
+
+TEST(benchmark, strided_loop_vs_coordinate_transform)
+{
+    const Shape in_shape{8, 64, 56, 56};
+    const AxisVector order{0, 2, 3, 1};
+    const auto in = iota_vector(shape_size(in_shape));
+
+    stopwatch timer;
+    timer.start();
+    const auto expected = transpose_with_coordinate_transform(in, in_shape, order);
+    timer.stop();
+    NGRAPH_INFO << "transpose with CoordinateTransform   " << timer.get_milliseconds() << "ms";
+
+    vector<float> out(in.size());
+    timer.start();
+    strided::copy(reinterpret_cast<const char*>(in.data()),
+                  reinterpret_cast<char*>(out.data()),
+                  sizeof(float),
+                  transpose_loop(in_shape, order));
+    timer.stop();
+    NGRAPH_INFO << "transpose with StridedLoop           " << timer.get_milliseconds() << "ms";
+    EXPECT_EQ(out, expected);
+
+    const AxisSet reduction_axes{2, 3};
+    const Shape out_shape = reduce(in_shape, reduction_axes, false);
+    vector<float> expected_sum(shape_size(out_shape), 0.f);
+    timer.start();
+    CoordinateTransform input_transform(in_shape);
+    CoordinateTransform output_transform(out_shape);
+    for (const Coordinate& input_coord : input_transform)
+    {
+        const Coordinate output_coord = reduce(input_coord, reduction_axes, false);
+        expected_sum[output_transform.index(output_coord)] +=
+            in[input_transform.index(input_coord)];
+    }
+    timer.stop();
+    NGRAPH_INFO << "reduction with CoordinateTransform   " << timer.get_milliseconds() << "ms";
+
+    vector<float> sum(shape_size(out_shape), 0.f);
+    timer.start();
+    strided::reduction_loop(in_shape, reduction_axes)
+        .for_each([&](ptrdiff_t in_index, ptrdiff_t out_index) { sum[out_index] += in[in_index]; });
+    timer.stop();
+    NGRAPH_INFO << "reduction with StridedLoop           " << timer.get_milliseconds() << "ms";
+    EXPECT_EQ(sum, expected_sum);
+}
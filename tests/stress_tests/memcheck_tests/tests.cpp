@@ -12,6 +12,11 @@
 
 #include <inference_engine.hpp>
 
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <string>
+
 using namespace InferenceEngine;
 
 
@@ -106,3 +111,157 @@ INSTANTIATE_TEST_CASE_P(MemCheckTests, MemCheckTestSuite,
                         ::testing::ValuesIn(
                                 generateTestsParams({"devices", "models"})),
                         getTestCaseName);
+
+
+/**
+ * @brief Test suite loading all models of the test config to one process with different streams settings.
+ *
+ * Every model is loaded once per streams setting from the test config. Memory consumption of every network
+ * is reported only: deltas of networks loaded after the first one include memory released by the previous
+ * ones and HWM never decreases. Total consumption is compared with the reference of the scenario if it is set,
+ * otherwise with the sum of the references of the networks. Reference of a network loaded with N streams is
+ * N references of its model loaded and inferred alone, so the check makes sure that networks hosted together
+ * don't cost more than separate processes.
+ */
+class MemCheckMultiNetworkTestSuite : public ::testing::TestWithParam<TestCase> {
+public:
+    struct Network {
+        TestCase params;
+        std::string streams;
+        std::array<long, MeasureValueMax> references;
+        std::array<long, MeasureValueMax> measures;
+        ExecutableNetwork exeNetwork;
+        std::vector<InferRequest> inferRequests;
+    };
+
+    std::string test_name, device;
+    int numiters = 1;
+    std::vector<Network> networks;
+    TestReferences test_refs;
+
+    void SetUp() override {
+        const ::testing::TestInfo* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        test_name = std::string(test_info->name()).substr(0, std::string(test_info->name()).find('/'));
+
+        const auto& test_params = GetParam();
+        device = test_params.device;
+        numiters = test_params.numiters;
+
+        std::vector<std::string> streams;
+        auto values = Environment::Instance().getTestConfig().child("attributes").child("streams");
+        for (pugi::xml_node val = values.first_child(); val; val = val.next_sibling())
+            streams.push_back(val.text().as_string());
+        if (streams.empty())
+            streams.push_back("1");
+
+        for (auto& model : generateTestsParams({"models"})) {
+            for (auto& stream : streams) {
+                Network network{TestCase(1, 1, 1, device, model.model, model.model_name, model.precision), stream};
+                TestReferences network_refs;
+                network_refs.collect_vm_values_for_test("infer_request_inference", network.params);
+                EXPECT_GT(network_refs.references[VMRSS], 0) << "Reference value of VmRSS of \"" << model.model_name
+                    << "\" is less than 0. Value: " << network_refs.references[VMRSS];
+                EXPECT_GT(network_refs.references[VMHWM], 0) << "Reference value of VmHWM of \"" << model.model_name
+                    << "\" is less than 0. Value: " << network_refs.references[VMHWM];
+                // every stream has its own graph and infer request, the same as a separate process
+                const long numStreams = std::stol(stream);
+                std::transform(network_refs.references.begin(), network_refs.references.end(),
+                               network.references.begin(), [numStreams](long value) { return value * numStreams; });
+                networks.push_back(network);
+            }
+        }
+
+        // scenario reference is optional, references of the networks limit it otherwise
+        test_refs.collect_vm_values_for_test(test_name, TestCase(1, 1, 1, device, "", "multi_network", "MIXED"));
+        for (auto measure : {VMRSS, VMHWM}) {
+            if (test_refs.references[measure] > 0)
+                continue;
+            test_refs.references[measure] = std::accumulate(networks.begin(), networks.end(), 0L,
+                [measure](long sum, const Network& network) { return sum + network.references[measure]; });
+        }
+    }
+};
+
+namespace {
+std::map<std::string, std::string> getStreamsConfig(const std::string& device, const std::string& streams) {
+    if (device.find("CPU") != std::string::npos)
+        return {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), streams}};
+    if (device.find("GPU") != std::string::npos)
+        return {{CONFIG_KEY(GPU_THROUGHPUT_STREAMS), streams}};
+    return {};
+}
+
+template <typename T>
+T getDeviceMetric(Core& ie, const std::string& device, const std::string& metric) {
+    std::vector<std::string> supportedMetrics = ie.GetMetric(device, METRIC_KEY(SUPPORTED_METRICS));
+    if (std::find(supportedMetrics.begin(), supportedMetrics.end(), metric) == supportedMetrics.end())
+        return T{};
+    return ie.GetMetric(device, metric).as<T>();
+}
+}  // namespace
+
+TEST_P(MemCheckMultiNetworkTestSuite, concurrent_networks_inference) {
+    log_info("Concurrent inference of " << networks.size() << " networks for device: \"" << device << "\"");
+    auto test_pipeline = [&]{
+        MemCheckPipeline memCheckPipeline;
+
+        Core ie;
+        ie.GetVersions(device);
+
+        for (auto& network : networks) {
+            auto start_measures = memCheckPipeline.measure();
+
+            CNNNetwork cnnNetwork = ie.ReadNetwork(network.params.model);
+            network.exeNetwork = ie.LoadNetwork(cnnNetwork, device, getStreamsConfig(device, network.streams));
+            unsigned int nireq = network.exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+
+            auto batchSize = cnnNetwork.getBatchSize();
+            batchSize = batchSize != 0 ? batchSize : 1;
+            const ConstInputsDataMap inputsInfo(network.exeNetwork.GetInputsInfo());
+            for (unsigned int i = 0; i < nireq; i++) {
+                network.inferRequests.push_back(network.exeNetwork.CreateInferRequest());
+                fillBlobs(network.inferRequests.back(), inputsInfo, batchSize);
+            }
+
+            network.measures = memCheckPipeline.measure();
+            std::transform(network.measures.begin(), network.measures.end(), start_measures.begin(),
+                           network.measures.begin(), std::minus<long>());
+        }
+
+        // all requests of all networks are in flight at the same time
+        for (int iter = 0; iter < numiters; iter++) {
+            for (auto& network : networks)
+                for (auto& inferRequest : network.inferRequests)
+                    inferRequest.StartAsync();
+            for (auto& network : networks)
+                for (auto& inferRequest : network.inferRequests)
+                    inferRequest.Wait(IInferRequest::WaitMode::RESULT_READY);
+        }
+
+        log_info("Memory consumption of networks after LoadNetwork and infer requests creation:");
+        log_info("NETWORK" << "\t\t" << "STREAMS" << "\t\t" << "INFER_REQUESTS" << "\t\t"
+                 << util::get_measure_values_headers());
+        for (auto& network : networks)
+            log_info(network.params.model_name << "\t\t" << network.streams << "\t\t" << network.inferRequests.size()
+                     << "\t\t" << util::get_measure_values_as_str(network.measures));
+
+        log_info("Weights cache of device, bytes: " << getDeviceMetric<uint64_t>(ie, device, METRIC_KEY(WEIGHTS_CACHE_BYTES))
+                 << ", reused bytes: " << getDeviceMetric<uint64_t>(ie, device, METRIC_KEY(WEIGHTS_CACHE_REUSED_BYTES)));
+        log_info("Threads of streams executors: "
+                 << getDeviceMetric<unsigned int>(ie, device, METRIC_KEY(STREAMS_EXECUTORS_THREADS)));
+
+        log_info("Memory consumption after Inference:");
+        memCheckPipeline.record_measures(test_name);
+
+        log_debug(memCheckPipeline.get_reference_record_for_test(test_name, "multi_network", "MIXED", device));
+        return memCheckPipeline.measure();
+    };
+
+    TestResult res = common_test_pipeline(test_pipeline, test_refs.references);
+    EXPECT_EQ(res.first, TestStatus::TEST_OK) << res.second;
+}
+
+INSTANTIATE_TEST_CASE_P(MemCheckTests, MemCheckMultiNetworkTestSuite,
+                        ::testing::ValuesIn(
+                                generateTestsParams({"devices", "iterations"})),
+                        getTestCaseName);
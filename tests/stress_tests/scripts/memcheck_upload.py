@@ -124,7 +124,9 @@ def parse_memcheck_log(log_path):
                 metrics=dict(zip(heading, values)),
                 test_name=test_name,
                 model_name=os.path.splitext(os.path.basename(model['path']))[0],
-                precision=next(pr for pr in PRECISSIONS if pr.upper() in model['precision'].upper()),
+                # multi-network scenarios have "MIXED" precision of networks
+                precision=next((pr for pr in PRECISSIONS if pr.upper() in model['precision'].upper()),
+                               model['precision']),
                 model=model['path'],
                 device=model['device'].upper(),
                 status='passed' if passed_match else 'failed' if failed_match else 'started'
@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+namespace TimeTest {
+/**
+ * @brief Get peak resident set size of the process
+ * @return peak RSS in kilobytes or 0 if it isn't available on the platform
+ */
+size_t getPeakRSSInKB();
+
+/**
+ * @brief Report peak resident set size of the process reached by the end of
+ * the step as `<step_name>_peak_rss_kb` statistics record
+ */
+void reportPeakRSS(const std::string &step_name);
+} // namespace TimeTest
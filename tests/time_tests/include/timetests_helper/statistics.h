@@ -0,0 +1,15 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+namespace TimeTest {
+/**
+ * @brief Writes custom statistics record, e.g. collected by a pipeline from
+ * the plugin, along with the records of timers
+ */
+void writeStatistics(const std::string &name, float value);
+} // namespace TimeTest
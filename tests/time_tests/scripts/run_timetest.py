@@ -60,9 +60,12 @@ def aggregate_stats(stats: dict):
 
 def prepare_executable_cmd(args: dict):
     """Generate common part of cmd from arguments to execute"""
-    return [str(args["executable"].resolve(strict=True)),
-            "-m", str(args["model"].resolve(strict=True)),
-            "-d", args["device"]]
+    cmd = [str(args["executable"].resolve(strict=True)),
+           "-m", str(args["model"].resolve(strict=True)),
+           "-d", args["device"]]
+    if args.get("page_cache"):
+        cmd += ["-page_cache", args["page_cache"]]
+    return cmd
 
 
 def run_timetest(args: dict, log=None):
@@ -131,6 +134,9 @@ def cli_parser():
                         default=3,
                         type=check_positive_int,
                         help='number of times to execute binary to aggregate statistics of')
+    parser.add_argument('-page_cache',
+                        choices=["cold", "warm"],
+                        help='state of the OS page cache for the model files before every run of binary')
     parser.add_argument('-s',
                         dest="stats_path",
                         type=Path,
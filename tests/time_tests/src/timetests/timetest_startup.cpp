@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <inference_engine.hpp>
+#include <iostream>
+#include <sstream>
+
+#include "common.h"
+#include "timetests_helper/memory.h"
+#include "timetests_helper/statistics.h"
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Reports LoadNetwork phases of the plugin as `load_network.<phase>`
+ * time records along with peak RSS reached by the end of each phase. Plugins
+ * without LOAD_NETWORK_PROFILE metric are skipped.
+ */
+void reportLoadNetworkPhases(const ExecutableNetwork &exeNetwork) {
+  const std::vector<std::string> supportedMetrics =
+      exeNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+  if (std::find(supportedMetrics.begin(), supportedMetrics.end(),
+                METRIC_KEY(LOAD_NETWORK_PROFILE)) == supportedMetrics.end())
+    return;
+
+  const std::vector<std::string> profile =
+      exeNetwork.GetMetric(METRIC_KEY(LOAD_NETWORK_PROFILE));
+  for (const auto &entry : profile) {
+    // entry format is "<phase>,<time_us>,<peak_rss_kb>"
+    std::istringstream stream(entry);
+    std::string phase, time, peak_rss;
+    if (!std::getline(stream, phase, ',') || !std::getline(stream, time, ',') ||
+        !std::getline(stream, peak_rss, ','))
+      continue;
+    const std::string name = "load_network." + phase;
+    TimeTest::writeStatistics(name, std::stof(time));
+    TimeTest::writeStatistics(name + "_peak_rss_kb", std::stof(peak_rss));
+  }
+}
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * In addition to the steps of the regular pipeline it tracks peak RSS by the
+ * end of each step and breaks LoadNetwork down into the plugin phases.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+    CNNNetwork cnnNetwork;
+    ExecutableNetwork exeNetwork;
+    InferRequest inferRequest;
+    size_t batchSize = 0;
+
+    {
+      SCOPED_TIMER(first_inference_latency);
+      {
+        SCOPED_TIMER(load_plugin);
+        ie.GetVersions(device);
+      }
+      TimeTest::reportPeakRSS("load_plugin");
+      {
+        SCOPED_TIMER(create_exenetwork);
+        if (TimeTest::fileExt(model) == "blob") {
+          SCOPED_TIMER(import_network);
+          exeNetwork = ie.ImportNetwork(model, device);
+        }
+        else {
+          {
+            SCOPED_TIMER(read_network);
+            cnnNetwork = ie.ReadNetwork(model);
+            batchSize = cnnNetwork.getBatchSize();
+          }
+          TimeTest::reportPeakRSS("read_network");
+
+          {
+            SCOPED_TIMER(load_network);
+            exeNetwork = ie.LoadNetwork(cnnNetwork, device);
+          }
+        }
+      }
+      TimeTest::reportPeakRSS("create_exenetwork");
+    }
+
+    {
+      SCOPED_TIMER(first_inference);
+      inferRequest = exeNetwork.CreateInferRequest();
+
+      {
+        SCOPED_TIMER(fill_inputs)
+        batchSize = batchSize != 0 ? batchSize : 1;
+        const InferenceEngine::ConstInputsDataMap inputsInfo(exeNetwork.GetInputsInfo());
+        fillBlobs(inferRequest, inputsInfo, batchSize);
+      }
+      inferRequest.Infer();
+    }
+    TimeTest::reportPeakRSS("first_inference");
+
+    // out of time tracking of the steps above
+    reportLoadNetworkPhases(exeNetwork);
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::details::InferenceEngineException &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
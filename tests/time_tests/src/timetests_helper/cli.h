@@ -30,6 +30,12 @@ static const char target_device_message[] =
 static const char statistics_path_message[] =
     "Required. Path to a file to write statistics.";
 
+/// @brief message for page cache argument
+static const char page_cache_message[] =
+    "Optional. State of the OS page cache for the model files before the run: "
+    "\"cold\" evicts them from the cache, \"warm\" preloads them. "
+    "By default the cache is left as is.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -48,6 +54,10 @@ DEFINE_string(d, "", target_device_message);
 /// It is a required parameter
 DEFINE_string(s, "", statistics_path_message);
 
+/// @brief Define parameter for set page cache state before the run <br>
+/// It is an optional parameter
+DEFINE_string(page_cache, "", page_cache_message);
+
 /**
  * @brief This function show a help message
  */
@@ -62,4 +72,6 @@ static void showUsage() {
             << std::endl;
   std::cout << "    -s \"<path>\"               " << statistics_path_message
             << std::endl;
+  std::cout << "    -page_cache \"<state>\"     " << page_cache_message
+            << std::endl;
 }
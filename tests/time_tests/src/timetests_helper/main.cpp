@@ -3,6 +3,7 @@
 //
 
 #include "cli.h"
+#include "page_cache.h"
 #include "statistics_writer.h"
 #include "timetests_helper/timer.h"
 
@@ -32,6 +33,12 @@ bool parseAndCheckCommandLine(int argc, char **argv) {
     throw std::logic_error(
         "Statistics file path is required but not set. Please set -s option.");
 
+  if (!FLAGS_page_cache.empty() && FLAGS_page_cache != coldPageCache &&
+      FLAGS_page_cache != warmPageCache)
+    throw std::logic_error("Incorrect page cache state \"" + FLAGS_page_cache +
+                           "\". Please set -page_cache option to \"" +
+                           coldPageCache + "\" or \"" + warmPageCache + "\".");
+
   return true;
 }
 
@@ -51,5 +58,8 @@ int main(int argc, char **argv) {
     return -1;
 
   StatisticsWriter::Instance().setFile(FLAGS_s);
+  // page cache is prepared out of the time tracking of the full run
+  if (!FLAGS_page_cache.empty())
+    preparePageCache(FLAGS_m, FLAGS_page_cache);
   return _runPipeline();
 }
\ No newline at end of file
@@ -0,0 +1,40 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "timetests_helper/memory.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "timetests_helper/statistics.h"
+
+namespace TimeTest {
+
+size_t getPeakRSSInKB() {
+  size_t peak_rss = 0;
+#ifdef __linux__
+  FILE *file = std::fopen("/proc/self/status", "r");
+  if (file == nullptr)
+    return peak_rss;
+  char line[128];
+  while (std::fgets(line, sizeof(line), file) != nullptr) {
+    if (std::strncmp(line, "VmHWM:", 6) == 0) {
+      unsigned long value = 0;
+      if (std::sscanf(line + 6, "%lu", &value) == 1)
+        peak_rss = static_cast<size_t>(value);
+      break;
+    }
+  }
+  std::fclose(file);
+#endif
+  return peak_rss;
+}
+
+void reportPeakRSS(const std::string &step_name) {
+  writeStatistics(step_name + "_peak_rss_kb",
+                  static_cast<float>(getPeakRSSInKB()));
+}
+
+} // namespace TimeTest
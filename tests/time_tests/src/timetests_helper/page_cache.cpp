@@ -0,0 +1,70 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "page_cache.h"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::vector<std::string> getModelFiles(const std::string &model_path) {
+  std::vector<std::string> files = {model_path};
+  auto pos = model_path.rfind('.');
+  if (pos != std::string::npos && model_path.substr(pos + 1) == "xml") {
+    std::string weights_path = model_path.substr(0, pos) + ".bin";
+    if (std::ifstream(weights_path).good())
+      files.push_back(weights_path);
+  }
+  return files;
+}
+
+void evictFromPageCache(const std::string &file_path) {
+#ifdef __linux__
+  int fd = open(file_path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Can't open \"" + file_path +
+                             "\" to evict it from the page cache");
+  // dirty pages are not evicted, so they are written back first
+  fdatasync(fd);
+  int status = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+  close(fd);
+  if (status != 0)
+    throw std::runtime_error("Can't evict \"" + file_path +
+                             "\" from the page cache");
+#else
+  std::cerr << "Cold page cache isn't supported on this platform, \""
+            << file_path << "\" is left as is\n";
+#endif
+}
+
+void loadToPageCache(const std::string &file_path) {
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file)
+    throw std::runtime_error("Can't open \"" + file_path +
+                             "\" to load it to the page cache");
+  std::vector<char> buffer(1 << 20);
+  while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+  }
+}
+
+} // namespace
+
+void preparePageCache(const std::string &model_path,
+                      const std::string &page_cache) {
+  for (const auto &file_path : getModelFiles(model_path)) {
+    if (page_cache == coldPageCache)
+      evictFromPageCache(file_path);
+    else if (page_cache == warmPageCache)
+      loadToPageCache(file_path);
+  }
+}
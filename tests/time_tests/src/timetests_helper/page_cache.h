@@ -0,0 +1,22 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+/// @brief page cache state values
+static constexpr char coldPageCache[] = "cold";
+static constexpr char warmPageCache[] = "warm";
+
+/**
+ * @brief Brings model files to the requested page cache state before a run.
+ *
+ * "cold" evicts the files from the OS page cache, so reading of the model
+ * hits the disk like the first start of a service on a fresh node. "warm"
+ * reads the files in advance, so they are served from memory like a restart.
+ * For IR models the weights file is handled together with the topology file.
+ */
+void preparePageCache(const std::string &model_path,
+                      const std::string &page_cache);
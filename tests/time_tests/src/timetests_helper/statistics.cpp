@@ -0,0 +1,14 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "timetests_helper/statistics.h"
+#include "statistics_writer.h"
+
+namespace TimeTest {
+
+void writeStatistics(const std::string &name, float value) {
+  StatisticsWriter::Instance().write({name, value});
+}
+
+} // namespace TimeTest
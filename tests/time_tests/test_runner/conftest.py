@@ -13,6 +13,8 @@ This plugin adds the following command-line options:
   Format: YAML file.
 * `--exe` - Path to a timetest binary to execute.
 * `--niter` - Number of times to run executable.
+* `--report` - Path to save machine-readable report of the run.
+  Format: JSON file.
 """
 
 import hashlib
@@ -66,6 +68,11 @@ def pytest_addoption(parser):
         type=Path,
         help="path to dump test config with references updated with statistics collected while run",
     )
+    helpers_args_parser.addoption(
+        "--report",
+        type=Path,
+        help="path to save JSON report with statistics, references and regressions of every test case",
+    )
     db_args_parser = parser.getgroup("timetest database use")
     db_args_parser.addoption(
         '--db_submit',
@@ -159,8 +166,10 @@ def test_info(request, pytestconfig):
     fixtures with timetests information which will be used for
     internal purposes.
     """
-    setattr(request.node._request, "test_info", {"orig_instance": request.node.funcargs["instance"],
+    setattr(request.node._request, "test_info", {"test_name": request.node.name,
+                                                 "orig_instance": request.node.funcargs["instance"],
                                                  "results": {},
+                                                 "regressions": [],
                                                  "db_info": {}})
     if not hasattr(pytestconfig, "session_info"):
         setattr(pytestconfig, "session_info", [])
@@ -194,7 +203,13 @@ def validate_test_case(request, test_info):
                     "path": {"type": "string"}
                 },
                 "required": ["path"]
-            }
+            },
+            "page_cache": {"enum": ["cold", "warm"]},
+            "thresholds": {
+                "type": "object",
+                "additionalProperties": {"type": "number", "minimum": 1}
+            },
+            "references": {"type": "object"}
         },
         "required": ["device", "model"],
         "additionalProperties": false
@@ -346,6 +361,34 @@ def prepare_tconf_with_refs(pytestconfig):
             yaml.safe_dump(upd_cases, tconf)
 
 
+@pytest.fixture(scope="session", autouse=True)
+def prepare_report(pytestconfig, executable, niter):
+    """Fixture for saving machine-readable report of the run with
+    statistics, references and regressions of every test case.
+    """
+    yield
+    report_path = pytestconfig.getoption('report')
+    if report_path:
+        logging.info("Save report of the run to {}".format(report_path))
+        report = {"timetest": str(executable.stem),
+                  "niter": niter,
+                  "cases": []}
+        for record in getattr(pytestconfig, "session_info", []):
+            instance = record["orig_instance"]
+            report["cases"].append({
+                "test_name": record["test_name"],
+                "device": instance["device"],
+                "model": instance["model"],
+                "page_cache": instance.get("page_cache"),
+                "results": record["results"],
+                "references": instance.get("references", {}),
+                "regressions": record["regressions"],
+                "status": "passed" if record["results"] and not record["regressions"] else "failed"
+            })
+        with open(report_path, "w") as report_file:
+            json.dump(report, report_file, indent=4)
+
+
 def pytest_generate_tests(metafunc):
     """Pytest hook for test generation.
 
@@ -374,7 +417,10 @@ def pytest_make_parametrize_id(config, val, argname):
     values = {key: val[key] for key in keys}
     values = list(get_dict_values(values))
 
-    return "-".join(["_".join([key, str(val)]) for key, val in zip(keys, values)])
+    test_id = "-".join(["_".join([key, str(val)]) for key, val in zip(keys, values)])
+    if "page_cache" in val:
+        test_id += "-page_cache_{}".format(val["page_cache"])
+    return test_id
 
 
 @pytest.mark.hookwrapper
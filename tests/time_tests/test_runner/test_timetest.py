@@ -10,6 +10,7 @@ Options[*]:
 --test_conf     Path to test config
 --exe           Path to timetest binary to execute
 --niter         Number of times to run executable
+--report        Path to save machine-readable report of the run
 
 [*] For more information see conftest.py
 """
@@ -25,6 +26,14 @@ from test_runner.utils import expand_env_vars
 REFS_FACTOR = 1.2      # 120%
 
 
+def get_refs_factor(instance, step_name):
+    """Get allowed ratio of current value to the reference for the step.
+    Steps with high variance, like ones reading a model from a cold page cache,
+    may override the default one via `thresholds` of the test case.
+    """
+    return instance.get("thresholds", {}).get(step_name, REFS_FACTOR)
+
+
 def test_timetest(instance, executable, niter, cl_cache_dir, test_info, temp_dir, validate_test_case,
                   prepare_db_info):
     """Parameterized test.
@@ -53,7 +62,8 @@ def test_timetest(instance, executable, niter, cl_cache_dir, test_info, temp_dir
         "executable": Path(executable),
         "model": Path(model_path),
         "device": instance["device"]["name"],
-        "niter": niter
+        "niter": niter,
+        "page_cache": instance.get("page_cache")
     }
     if exe_args["device"] == "GPU":
         # Generate cl_cache via additional timetest run
@@ -71,11 +81,17 @@ def test_timetest(instance, executable, niter, cl_cache_dir, test_info, temp_dir
 
     # Compare with references
     comparison_status = 0
-    for step_name, references in instance["references"].items():
+    for step_name, references in instance.get("references", {}).items():
+        refs_factor = get_refs_factor(instance, step_name)
         for metric, reference_val in references.items():
-            if aggr_stats[step_name][metric] > reference_val * REFS_FACTOR:
+            if aggr_stats[step_name][metric] > reference_val * refs_factor:
                 logging.error("Comparison failed for '{}' step for '{}' metric. Reference: {}. Current values: {}"
                               .format(step_name, metric, reference_val, aggr_stats[step_name][metric]))
+                test_info["regressions"].append({"step": step_name,
+                                                 "metric": metric,
+                                                 "reference": reference_val,
+                                                 "threshold": refs_factor,
+                                                 "value": aggr_stats[step_name][metric]})
                 comparison_status = 1
             else:
                 logging.info("Comparison passed for '{}' step for '{}' metric. Reference: {}. Current values: {}"